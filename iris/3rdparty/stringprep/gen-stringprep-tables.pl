@@ -27,17 +27,22 @@ my ($tablename);
 my ($varname);
 my ($starheader, $header);
 my ($profile) = "rfc3454";
-my ($filename) = "$profile.c";
+my ($filename) = "$profile.cpp";
 my ($headername) = "$profile.h";
+my ($lookupname) = "${profile}lookup.cpp";
 my ($line, $start, $end, @map);
+my (@tables, %ranges);
+
+# two-level lookup. code points are split to pages of 2^$shift
+my ($shift) = 7;
+my ($maxchar) = 0x10FFFF;
 
 open(FH, ">$filename") or die "cannot open $filename for writing";
 
 print FH "/* This file is automatically generated.  DO NOT EDIT!\n";
 print FH "   Instead, edit gen-stringprep-tables.pl and re-run.  */\n\n";
 
-print FH "#include <config.h>\n";
-print FH "#include \"stringprep.h\"\n";
+print FH "#include \"qstringprep.h\"\n";
 
 open(FHH, ">$headername") or die "cannot open $headername for writing";
 print FHH "/* This file is automatically generated.  DO NOT EDIT!\n";
@@ -91,6 +96,8 @@ while(<>) {
 
 	die "tables tried to map a range" if $end && $map[0];
 
+	push @{$ranges{$varname}}, [hex($start), hex($end ? $end : $start), $entries];
+
 	if ($map[3]) {
 	    printf FH "  { 0x%06s, 0x%06s, { 0x%06s,%*s/* %s */\n                   0x%06s, 0x%06s, 0x%06s }},\n",
 	    $start, $start, $map[0], $tab-length($line)-13, " ", $line,
@@ -119,6 +126,7 @@ while(<>) {
 	$tablename = $1;
 
 	($varname = $tablename) =~ tr/./_/;
+	push @tables, $varname;
 	$header =~ s/\n/\n * /s;
 
 	print FH "\n/*\n * $header */\n\n";
@@ -126,5 +134,101 @@ while(<>) {
     }
 }
 
-close FHH or die "cannot close $headername";
 close FH or die "cannot close $filename";
+
+# Lookup structure giving all the tables a code point is in with O(1):
+#   ${profile}_pages[cp >> shift] -> block of 2^shift entries in ${profile}_blocks
+#   ${profile}_blocks[block << shift | cp & mask] -> ${profile}_props entry
+# props hold a bit per table (in the order of ${profile}_tables) and the
+# position of the code point in each mapping table (B.*), so the mapping
+# is found without a search. Identical blocks and props are stored once.
+
+my (@mapping) = grep { /^B_/ } @tables;
+my (%bit, %slot, @mask, @pos);
+@bit{@tables} = (0..$#tables);
+@slot{@mapping} = (0..$#mapping);
+die "too many tables" if @tables > 32;
+
+foreach my $t (@tables) {
+    foreach my $r (@{$ranges{$t}}) {
+	my ($s, $e, $idx) = @$r;
+	for (my $c = $s; $c <= $e; $c++) {
+	    $mask[$c] |= 1 << $bit{$t};
+	    $pos[$c][$slot{$t}] = $idx if exists $slot{$t};
+	}
+    }
+}
+
+my (%propid, @props, %blockid, @blocks, @pages);
+for (my $page = 0; $page <= ($maxchar >> $shift); $page++) {
+    my (@ids);
+    for (my $c = $page << $shift; $c < ($page + 1) << $shift; $c++) {
+	my ($m) = $mask[$c] || 0;
+	my (@p) = map { defined $pos[$c][$_] ? $pos[$c][$_] : 0 } (0..$#mapping);
+	my ($key) = join(",", $m, @p);
+	if (!exists $propid{$key}) {
+	    $propid{$key} = scalar @props;
+	    push @props, [ $m, @p ];
+	}
+	push @ids, $propid{$key};
+    }
+    my ($key) = join(",", @ids);
+    if (!exists $blockid{$key}) {
+	$blockid{$key} = scalar @blocks;
+	push @blocks, [ @ids ];
+    }
+    push @pages, $blockid{$key};
+}
+die "too many props" if @props > 65536;
+die "too many blocks" if @blocks > 65536;
+
+print FHH "\n";
+print FHH "#define STRINGPREP_${profile}_LOOKUP_SHIFT $shift\n";
+print FHH "#define STRINGPREP_${profile}_LOOKUP_MAX 0x" . sprintf("%06X", $maxchar) . "\n";
+print FHH "#define N_STRINGPREP_${profile}_TABLES " . scalar(@tables) . "\n";
+print FHH "#define N_STRINGPREP_${profile}_MAP_TABLES " . scalar(@mapping) . "\n";
+print FHH "\n";
+print FHH "struct Stringprep_${profile}_props {\n";
+print FHH "    uint32_t tables; /* bit per table */\n";
+print FHH "    uint16_t map[N_STRINGPREP_${profile}_MAP_TABLES]; /* position in the mapping tables */\n";
+print FHH "};\n\n";
+print FHH "extern const Stringprep_table_element *const stringprep_${profile}_tables[N_STRINGPREP_${profile}_TABLES];\n";
+print FHH "extern const int stringprep_${profile}_map_slot[N_STRINGPREP_${profile}_TABLES];\n";
+print FHH "extern const uint16_t stringprep_${profile}_pages[];\n";
+print FHH "extern const uint16_t stringprep_${profile}_blocks[];\n";
+print FHH "extern const Stringprep_${profile}_props stringprep_${profile}_props[];\n";
+close FHH or die "cannot close $headername";
+
+sub print_values {
+    my ($fh, @v) = @_;
+    while (@v) {
+	print $fh "    " . join(", ", splice(@v, 0, 16)) . ",\n";
+    }
+}
+
+open(FHL, ">$lookupname") or die "cannot open $lookupname for writing";
+print FHL "/* This file is automatically generated.  DO NOT EDIT!\n";
+print FHL "   Instead, edit gen-stringprep-tables.pl and re-run.  */\n\n";
+print FHL "#include \"qstringprep.h\"\n";
+print FHL "#include \"$headername\"\n\n";
+print FHL "const Stringprep_table_element *const stringprep_${profile}_tables[] = {\n";
+print FHL join("", map { "    stringprep_${profile}_$_,\n" } @tables);
+print FHL "};\n\n";
+print FHL "const int stringprep_${profile}_map_slot[] = { ";
+print FHL join(", ", map { exists $slot{$_} ? $slot{$_} : -1 } @tables) . " };\n\n";
+print FHL "/* " . scalar(@pages) . " pages */\n";
+print FHL "const uint16_t stringprep_${profile}_pages[] = {\n";
+print_values(\*FHL, @pages);
+print FHL "};\n\n";
+print FHL "/* " . scalar(@blocks) . " blocks */\n";
+print FHL "const uint16_t stringprep_${profile}_blocks[] = {\n";
+print_values(\*FHL, map { @$_ } @blocks);
+print FHL "};\n\n";
+print FHL "/* " . scalar(@props) . " props */\n";
+print FHL "const Stringprep_${profile}_props stringprep_${profile}_props[] = {\n";
+foreach my $p (@props) {
+    my ($m, @p) = @$p;
+    printf FHL "    { 0x%05X, { %s } },\n", $m, join(", ", @p);
+}
+print FHL "};\n";
+close FHL or die "cannot close $lookupname";
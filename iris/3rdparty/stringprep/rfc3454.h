@@ -18,3 +18,19 @@
 #define N_STRINGPREP_rfc3454_C_9 2
 #define N_STRINGPREP_rfc3454_D_1 34
 #define N_STRINGPREP_rfc3454_D_2 360
+
+#define STRINGPREP_rfc3454_LOOKUP_SHIFT 7
+#define STRINGPREP_rfc3454_LOOKUP_MAX 0x10FFFF
+#define N_STRINGPREP_rfc3454_TABLES 17
+#define N_STRINGPREP_rfc3454_MAP_TABLES 3
+
+struct Stringprep_rfc3454_props {
+    uint32_t tables; /* bit per table */
+    uint16_t map[N_STRINGPREP_rfc3454_MAP_TABLES]; /* position in the mapping tables */
+};
+
+extern const Stringprep_table_element *const stringprep_rfc3454_tables[N_STRINGPREP_rfc3454_TABLES];
+extern const int stringprep_rfc3454_map_slot[N_STRINGPREP_rfc3454_TABLES];
+extern const uint16_t stringprep_rfc3454_pages[];
+extern const uint16_t stringprep_rfc3454_blocks[];
+extern const Stringprep_rfc3454_props stringprep_rfc3454_props[];
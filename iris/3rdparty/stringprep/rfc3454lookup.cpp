@@ -0,0 +1,2865 @@
+/* This file is automatically generated.  DO NOT EDIT!
+   Instead, edit gen-stringprep-tables.pl and re-run.  */
+
+#include "qstringprep.h"
+#include "rfc3454.h"
+
+const Stringprep_table_element *const stringprep_rfc3454_tables[] = {
+    stringprep_rfc3454_A_1,
+    stringprep_rfc3454_B_1,
+    stringprep_rfc3454_B_2,
+    stringprep_rfc3454_B_3,
+    stringprep_rfc3454_C_1_1,
+    stringprep_rfc3454_C_1_2,
+    stringprep_rfc3454_C_2_1,
+    stringprep_rfc3454_C_2_2,
+    stringprep_rfc3454_C_3,
+    stringprep_rfc3454_C_4,
+    stringprep_rfc3454_C_5,
+    stringprep_rfc3454_C_6,
+    stringprep_rfc3454_C_7,
+    stringprep_rfc3454_C_8,
+    stringprep_rfc3454_C_9,
+    stringprep_rfc3454_D_1,
+    stringprep_rfc3454_D_2,
+};
+
+const int stringprep_rfc3454_map_slot[] = { -1, 0, 1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 };
+
+/* 8704 pages */
+const uint16_t stringprep_rfc3454_pages[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 40, 40, 41, 42, 43, 44,
+    45, 46, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 55, 56, 57, 58, 59, 55, 55, 60, 61, 62, 63,
+    55, 55, 55, 55, 55, 55, 16, 16, 16, 16, 16, 16, 16, 64, 55, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 74, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 75,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 76, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 77,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 40, 40, 80, 16, 81, 82, 83, 83, 84, 85, 86, 87, 88, 89,
+    16, 16, 16, 16, 16, 16, 90, 16, 91, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    40, 92, 93, 94, 16, 16, 16, 16, 95, 96, 97, 98, 99, 100, 101, 102,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 104, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    40, 40, 40, 40, 105, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    106, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 103,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 107,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 107,
+};
+
+/* 108 blocks */
+const uint16_t stringprep_rfc3454_blocks[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 2, 2, 2, 2, 2,
+    2, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 2, 2, 2, 2, 0,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    31, 2, 2, 2, 2, 2, 2, 2, 2, 2, 29, 2, 2, 32, 2, 2,
+    2, 2, 2, 2, 2, 33, 2, 2, 2, 2, 29, 2, 2, 2, 2, 2,
+    34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 53, 54, 55, 56, 2, 57, 58, 59, 60, 61, 62, 63, 64,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 2, 29, 29, 29, 29, 29, 29, 29, 29,
+    65, 29, 66, 29, 67, 29, 68, 29, 69, 29, 70, 29, 71, 29, 72, 29,
+    73, 29, 74, 29, 75, 29, 76, 29, 77, 29, 78, 29, 79, 29, 80, 29,
+    81, 29, 82, 29, 83, 29, 84, 29, 85, 29, 86, 29, 87, 29, 88, 29,
+    89, 29, 90, 29, 91, 29, 92, 29, 29, 93, 29, 94, 29, 95, 29, 96,
+    29, 97, 29, 98, 29, 99, 29, 100, 29, 101, 102, 29, 103, 29, 104, 29,
+    105, 29, 106, 29, 107, 29, 108, 29, 109, 29, 110, 29, 111, 29, 112, 29,
+    113, 29, 114, 29, 115, 29, 116, 29, 117, 29, 118, 29, 119, 29, 120, 29,
+    121, 29, 122, 29, 123, 29, 124, 29, 125, 126, 29, 127, 29, 128, 29, 129,
+    29, 130, 131, 29, 132, 29, 133, 134, 29, 135, 136, 137, 29, 29, 138, 139,
+    140, 141, 29, 142, 143, 29, 144, 145, 146, 29, 29, 29, 147, 148, 29, 149,
+    150, 29, 151, 29, 152, 29, 153, 154, 29, 155, 29, 29, 156, 29, 157, 158,
+    29, 159, 160, 161, 29, 162, 29, 163, 164, 29, 29, 29, 165, 29, 29, 29,
+    29, 29, 29, 29, 166, 167, 29, 168, 169, 29, 170, 171, 29, 172, 29, 173,
+    29, 174, 29, 175, 29, 176, 29, 177, 29, 178, 29, 179, 29, 29, 180, 29,
+    181, 29, 182, 29, 183, 29, 184, 29, 185, 29, 186, 29, 187, 29, 188, 29,
+    189, 190, 191, 29, 192, 29, 193, 194, 195, 29, 196, 29, 197, 29, 198, 29,
+    199, 29, 200, 29, 201, 29, 202, 29, 203, 29, 204, 29, 205, 29, 206, 29,
+    207, 29, 208, 29, 209, 29, 210, 29, 211, 29, 212, 29, 213, 29, 214, 29,
+    215, 216, 217, 29, 218, 29, 219, 29, 220, 29, 221, 29, 222, 29, 223, 29,
+    224, 29, 225, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 2, 2, 29, 29, 29, 29, 29,
+    29, 29, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    29, 29, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    29, 29, 29, 29, 29, 2, 2, 2, 2, 2, 2, 2, 2, 2, 29, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    226, 226, 2, 2, 2, 227, 2, 2, 2, 2, 2, 2, 2, 2, 2, 228,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    216, 216, 216, 216, 2, 2, 216, 216, 216, 216, 229, 216, 216, 216, 2, 216,
+    216, 216, 216, 216, 2, 2, 230, 2, 231, 232, 233, 216, 234, 216, 235, 236,
+    237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252,
+    253, 254, 216, 255, 256, 257, 258, 259, 260, 261, 262, 263, 29, 29, 29, 29,
+    264, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 265, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216,
+    266, 267, 268, 269, 270, 271, 272, 29, 273, 29, 274, 29, 275, 29, 276, 29,
+    277, 29, 278, 29, 279, 29, 280, 29, 281, 29, 282, 29, 283, 29, 284, 29,
+    285, 286, 287, 29, 288, 289, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305,
+    306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    338, 29, 339, 29, 340, 29, 341, 29, 342, 29, 343, 29, 344, 29, 345, 29,
+    346, 29, 347, 29, 348, 29, 349, 29, 350, 29, 351, 29, 352, 29, 353, 29,
+    354, 29, 29, 2, 2, 2, 2, 216, 2, 2, 355, 29, 356, 29, 357, 29,
+    358, 29, 359, 29, 360, 29, 361, 29, 362, 29, 363, 29, 364, 29, 365, 29,
+    366, 29, 367, 29, 368, 29, 369, 29, 370, 29, 371, 29, 372, 29, 373, 29,
+    374, 29, 375, 29, 376, 29, 377, 29, 378, 29, 379, 29, 380, 29, 381, 29,
+    29, 382, 29, 383, 29, 384, 29, 385, 29, 386, 29, 387, 29, 388, 29, 216,
+    389, 29, 390, 29, 391, 29, 392, 29, 393, 29, 394, 29, 395, 29, 396, 29,
+    397, 29, 398, 29, 399, 29, 400, 29, 401, 29, 402, 29, 403, 29, 404, 29,
+    405, 29, 406, 29, 407, 29, 216, 216, 408, 29, 216, 216, 216, 216, 216, 216,
+    409, 29, 410, 29, 411, 29, 412, 29, 413, 29, 414, 29, 415, 29, 416, 29,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
+    432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447,
+    448, 449, 450, 451, 452, 453, 454, 216, 216, 29, 29, 29, 29, 29, 29, 29,
+    216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 455, 216, 29, 2, 216, 216, 216, 216, 216,
+    216, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 216, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 2, 2, 2, 456, 2,
+    456, 2, 2, 456, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 216, 216, 216, 216, 216,
+    456, 456, 456, 456, 456, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 2, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 456, 216, 216, 216, 456,
+    216, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 216, 216, 216, 216, 216,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 456, 456, 456,
+    2, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 2, 2, 2, 2, 2, 2, 2, 457, 2, 2,
+    2, 2, 2, 2, 2, 456, 456, 2, 2, 2, 2, 2, 2, 2, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 456, 456, 456, 456, 456, 216,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 216, 30,
+    456, 2, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 456, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 2, 2, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 2, 29, 29, 29,
+    29, 2, 2, 2, 2, 2, 2, 2, 2, 29, 29, 29, 29, 2, 216, 216,
+    29, 2, 2, 2, 2, 216, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 2, 2, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 2, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 29,
+    29, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29,
+    29, 216, 29, 216, 216, 216, 29, 29, 29, 29, 216, 216, 2, 216, 29, 29,
+    29, 2, 2, 2, 2, 216, 216, 29, 29, 216, 216, 29, 29, 2, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 29, 216, 216, 216, 216, 29, 29, 216, 29,
+    29, 29, 2, 2, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 2, 2, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216,
+    216, 216, 2, 216, 216, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 29,
+    29, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29,
+    29, 216, 29, 29, 216, 29, 29, 216, 29, 29, 216, 216, 2, 216, 29, 29,
+    29, 2, 2, 216, 216, 216, 216, 2, 2, 216, 216, 2, 2, 2, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 29, 29, 29, 29, 216, 29, 216,
+    216, 216, 216, 216, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    2, 2, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 2, 2, 29, 216, 29, 29, 29, 29, 29, 29, 29, 216, 29, 216, 29,
+    29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29,
+    29, 216, 29, 29, 216, 29, 29, 29, 29, 29, 216, 216, 2, 29, 29, 29,
+    29, 2, 2, 2, 2, 2, 216, 2, 2, 29, 216, 29, 29, 2, 216, 216,
+    29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 216, 216, 216, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 2, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 29,
+    29, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29,
+    29, 216, 29, 29, 216, 216, 29, 29, 29, 29, 216, 216, 2, 29, 29, 2,
+    29, 2, 2, 2, 216, 216, 216, 29, 29, 216, 216, 29, 29, 2, 216, 216,
+    216, 216, 216, 216, 216, 216, 2, 29, 216, 216, 216, 216, 29, 29, 216, 29,
+    29, 29, 216, 216, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 2, 29, 216, 29, 29, 29, 29, 29, 29, 216, 216, 216, 29, 29,
+    29, 216, 29, 29, 29, 29, 216, 216, 216, 29, 29, 216, 29, 216, 29, 29,
+    216, 216, 216, 29, 29, 216, 216, 216, 29, 29, 29, 216, 216, 216, 29, 29,
+    29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 216, 216, 216, 216, 29, 29,
+    2, 29, 29, 216, 216, 216, 29, 29, 29, 216, 29, 29, 29, 2, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 29, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29,
+    29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 216, 216, 216, 216, 2, 2,
+    2, 29, 29, 29, 29, 216, 2, 2, 2, 216, 2, 2, 2, 2, 216, 216,
+    216, 216, 216, 216, 216, 2, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 216, 216, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29,
+    29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 216, 216, 216, 216, 29, 2,
+    29, 29, 29, 29, 29, 216, 2, 29, 29, 216, 29, 29, 2, 2, 216, 216,
+    216, 216, 216, 216, 216, 29, 29, 216, 216, 216, 216, 216, 216, 216, 29, 216,
+    29, 29, 216, 216, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29,
+    29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 29, 29,
+    29, 2, 2, 2, 216, 216, 29, 29, 29, 216, 29, 29, 29, 2, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 29, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 216, 216, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 2, 216, 216, 216, 216, 29,
+    29, 29, 2, 2, 2, 216, 2, 216, 29, 29, 29, 29, 29, 29, 29, 29,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 2, 29, 29, 2, 2, 2, 2, 2, 2, 2, 216, 216, 216, 216, 2,
+    29, 29, 29, 29, 29, 29, 29, 2, 2, 2, 2, 2, 2, 2, 2, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 29, 29, 216, 29, 216, 216, 29, 29, 216, 29, 216, 216, 29, 216, 216,
+    216, 216, 216, 216, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29,
+    216, 29, 29, 29, 216, 29, 216, 29, 216, 216, 29, 29, 216, 29, 29, 29,
+    29, 2, 29, 29, 2, 2, 2, 2, 2, 2, 216, 2, 2, 29, 216, 216,
+    29, 29, 29, 29, 29, 216, 29, 216, 2, 2, 2, 2, 2, 2, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 29, 29, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 2, 2, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 2, 29, 2, 29, 2, 2, 2, 2, 2, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216,
+    216, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 29,
+    2, 2, 2, 2, 2, 29, 2, 2, 29, 29, 29, 29, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 216, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 29, 29,
+    29, 29, 29, 29, 29, 29, 2, 29, 29, 29, 29, 29, 29, 216, 216, 29,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 216, 29, 29, 29, 29, 29, 216, 29, 29, 216, 29, 2, 2, 2,
+    2, 29, 2, 216, 216, 216, 2, 2, 29, 2, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 2, 2, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 29, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 216, 216, 216, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 216, 29, 216, 29, 29, 29, 29, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 216, 29, 216, 29, 29, 29, 29, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 216, 29, 216, 29, 29, 29, 29, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216,
+    29, 216, 29, 29, 29, 29, 216, 216, 29, 29, 29, 29, 29, 29, 29, 216,
+    29, 216, 29, 29, 29, 29, 216, 216, 29, 29, 29, 29, 29, 29, 29, 216,
+    29, 29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216,
+    29, 216, 29, 29, 29, 29, 216, 216, 29, 29, 29, 29, 29, 29, 29, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216,
+    216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    31, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 2, 2, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29,
+    29, 29, 2, 2, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 2, 2, 2, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 2, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 29, 29,
+    29, 216, 2, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 2, 2, 2, 2, 2, 2, 2, 29, 29,
+    29, 29, 29, 29, 29, 29, 2, 29, 29, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 29, 29, 29, 29, 29, 29, 29, 2, 29, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 458, 2, 2, 2, 2, 459, 460, 461, 30, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 2, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    462, 29, 463, 29, 464, 29, 465, 29, 466, 29, 467, 29, 468, 29, 469, 29,
+    470, 29, 471, 29, 472, 29, 473, 29, 474, 29, 475, 29, 476, 29, 477, 29,
+    478, 29, 479, 29, 480, 29, 481, 29, 482, 29, 483, 29, 484, 29, 485, 29,
+    486, 29, 487, 29, 488, 29, 489, 29, 490, 29, 491, 29, 492, 29, 493, 29,
+    494, 29, 495, 29, 496, 29, 497, 29, 498, 29, 499, 29, 500, 29, 501, 29,
+    502, 29, 503, 29, 504, 29, 505, 29, 506, 29, 507, 29, 508, 29, 509, 29,
+    510, 29, 511, 29, 512, 29, 513, 29, 514, 29, 515, 29, 516, 29, 517, 29,
+    518, 29, 519, 29, 520, 29, 521, 29, 522, 29, 523, 29, 524, 29, 525, 29,
+    526, 29, 527, 29, 528, 29, 529, 29, 530, 29, 531, 29, 532, 29, 533, 29,
+    534, 29, 535, 29, 536, 29, 537, 538, 539, 540, 541, 542, 216, 216, 216, 216,
+    543, 29, 544, 29, 545, 29, 546, 29, 547, 29, 548, 29, 549, 29, 550, 29,
+    551, 29, 552, 29, 553, 29, 554, 29, 555, 29, 556, 29, 557, 29, 558, 29,
+    559, 29, 560, 29, 561, 29, 562, 29, 563, 29, 564, 29, 565, 29, 566, 29,
+    567, 29, 568, 29, 569, 29, 570, 29, 571, 29, 572, 29, 573, 29, 574, 29,
+    575, 29, 576, 29, 577, 29, 578, 29, 579, 29, 580, 29, 581, 29, 582, 29,
+    583, 29, 584, 29, 585, 29, 586, 29, 587, 29, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 588, 589, 590, 591, 592, 593, 594, 595,
+    29, 29, 29, 29, 29, 29, 216, 216, 596, 597, 598, 599, 600, 601, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 602, 603, 604, 605, 606, 607, 608, 609,
+    29, 29, 29, 29, 29, 29, 29, 29, 610, 611, 612, 613, 614, 615, 616, 617,
+    29, 29, 29, 29, 29, 29, 216, 216, 618, 619, 620, 621, 622, 623, 216, 216,
+    624, 29, 625, 29, 626, 29, 627, 29, 216, 628, 216, 629, 216, 630, 216, 631,
+    29, 29, 29, 29, 29, 29, 29, 29, 632, 633, 634, 635, 636, 637, 638, 639,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216,
+    640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+    656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+    672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687,
+    29, 29, 688, 689, 690, 216, 691, 692, 693, 694, 695, 696, 697, 2, 698, 2,
+    2, 2, 699, 700, 701, 216, 702, 703, 704, 705, 706, 707, 708, 2, 2, 2,
+    29, 29, 709, 710, 216, 216, 711, 712, 713, 714, 715, 716, 216, 2, 2, 2,
+    29, 29, 717, 718, 719, 29, 720, 721, 722, 723, 724, 725, 726, 2, 2, 2,
+    216, 216, 727, 728, 729, 216, 730, 731, 732, 733, 734, 735, 736, 2, 2, 216,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 737, 738, 739, 740, 741,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 30, 30, 226, 226, 226, 226, 226, 31,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 216, 216, 216, 216, 2, 216, 216, 216, 216, 216, 216, 216, 31,
+    742, 30, 30, 30, 216, 216, 216, 216, 216, 216, 743, 743, 743, 743, 743, 743,
+    2, 29, 216, 216, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 29,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 744, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 745, 746, 2, 2, 2, 747, 2, 748, 29, 749, 750, 751, 29, 29,
+    752, 753, 754, 29, 2, 755, 756, 2, 2, 757, 758, 759, 760, 761, 2, 2,
+    762, 763, 764, 2, 765, 2, 766, 2, 767, 2, 768, 769, 770, 771, 2, 29,
+    772, 773, 2, 774, 29, 29, 29, 29, 29, 29, 2, 216, 216, 29, 775, 776,
+    2, 2, 2, 2, 2, 777, 29, 29, 29, 29, 2, 2, 216, 216, 216, 216,
+    216, 216, 216, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 29, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803,
+    804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 216, 216, 2, 2, 216, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 2, 2, 2, 2, 216, 2, 2, 2, 2, 216, 216, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 216, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 2, 216, 2,
+    2, 2, 2, 216, 216, 216, 2, 216, 2, 2, 2, 2, 2, 2, 2, 216,
+    216, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 216, 216, 216, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    216, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 216, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    820, 820, 820, 820, 820, 820, 820, 820, 820, 820, 820, 820, 216, 216, 216, 216,
+    31, 2, 2, 2, 2, 29, 29, 29, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 29, 29, 29, 29, 29, 29, 29, 29, 29, 2, 2, 2, 2, 2, 2,
+    2, 29, 29, 29, 29, 29, 2, 2, 29, 29, 29, 29, 29, 2, 2, 2,
+    216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 216, 216, 2, 2, 2, 2, 29, 29, 29,
+    2, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 2, 29, 29, 29, 29,
+    216, 216, 216, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216,
+    216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 821, 29, 822, 29, 823, 29, 216, 216, 216, 216, 29, 29, 29, 29, 29,
+    824, 825, 826, 827, 828, 829, 830, 831, 29, 29, 832, 833, 834, 29, 29, 29,
+    835, 836, 837, 838, 839, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 840, 841, 842, 843, 29, 29, 29,
+    29, 29, 29, 29, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855,
+    856, 857, 29, 858, 29, 29, 859, 860, 861, 862, 29, 863, 29, 864, 865, 29,
+    29, 29, 29, 29, 29, 29, 29, 866, 29, 867, 868, 29, 869, 870, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+    871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+    871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+    871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+    871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+    871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+    871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+    871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871, 871,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    873, 874, 875, 876, 877, 878, 879, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 880, 881, 882, 883, 884, 216, 216, 216, 216, 216, 456, 2, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 2, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 216, 456, 456, 456, 456, 456, 216, 456, 216,
+    456, 456, 216, 456, 456, 216, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 2, 2,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    216, 216, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 216, 216, 216, 216, 216, 216, 216, 216,
+    885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+    885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885, 885,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 216, 216, 216,
+    886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 216, 216, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 216, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 216, 2, 2, 2, 2, 216, 216, 216, 216,
+    456, 456, 456, 456, 456, 216, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456,
+    456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 216, 216, 902,
+    216, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917,
+    918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 2, 2, 2, 2, 2,
+    2, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216,
+    216, 216, 29, 29, 29, 29, 29, 29, 216, 216, 29, 29, 29, 29, 29, 29,
+    216, 216, 29, 29, 29, 29, 29, 29, 216, 216, 29, 29, 29, 216, 216, 216,
+    2, 2, 2, 2, 2, 2, 2, 216, 2, 2, 2, 2, 2, 2, 2, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 929, 929, 929, 929, 930, 885, 885,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216,
+    29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945, 946,
+    947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962,
+    963, 964, 965, 966, 967, 968, 216, 216, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 2, 2, 2, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30, 2, 2, 2, 2, 2,
+    2, 2, 2, 29, 29, 2, 2, 2, 2, 2, 2, 2, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 2, 2, 2, 2, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984,
+    985, 986, 987, 988, 989, 990, 991, 992, 993, 994, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+    1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 29, 29,
+    29, 29, 29, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
+    1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044,
+    1045, 1046, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 1047, 216, 1048, 1049,
+    216, 216, 1050, 216, 216, 1051, 1052, 216, 216, 1053, 1054, 1055, 1056, 216, 1057, 1058,
+    1059, 1060, 1061, 1062, 1063, 1064, 29, 29, 29, 29, 216, 29, 216, 29, 29, 29,
+    29, 216, 29, 29, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080,
+    1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 1091, 1092, 216, 1093, 1094, 1095, 1096, 216, 216, 1097, 1098, 1099,
+    1100, 1101, 1102, 1103, 1104, 216, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 216, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 1112, 1113, 216, 1114, 1115, 1116, 1117, 216,
+    1118, 1119, 1120, 1121, 1122, 216, 1123, 216, 216, 216, 1124, 1125, 1126, 1127, 1128, 1129,
+    1130, 216, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 1131, 1132, 1133, 1134,
+    1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150,
+    1151, 1152, 1153, 1154, 1155, 1156, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172,
+    1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
+    1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216,
+    1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232,
+    1233, 1234, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 1235, 1236, 1237, 1238,
+    1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254,
+    1255, 1256, 1257, 1258, 1259, 1260, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276,
+    1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 216, 216, 216, 216, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294,
+    1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310,
+    1311, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 1312, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326,
+    1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 1338, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 1339, 1340, 1341, 1342,
+    1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358,
+    1359, 1360, 1361, 1362, 1363, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 1364, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374,
+    1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 1390, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406,
+    1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 1416, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 885, 885,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 1417, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+    1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+    1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+    1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+    1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+    1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+    1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872,
+    872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 872, 885, 885,
+};
+
+/* 1418 props */
+const Stringprep_rfc3454_props stringprep_rfc3454_props[] = {
+    { 0x00040, { 0, 0, 0 } },
+    { 0x00010, { 0, 0, 0 } },
+    { 0x00000, { 0, 0, 0 } },
+    { 0x1000C, { 0, 0, 0 } },
+    { 0x1000C, { 0, 1, 1 } },
+    { 0x1000C, { 0, 2, 2 } },
+    { 0x1000C, { 0, 3, 3 } },
+    { 0x1000C, { 0, 4, 4 } },
+    { 0x1000C, { 0, 5, 5 } },
+    { 0x1000C, { 0, 6, 6 } },
+    { 0x1000C, { 0, 7, 7 } },
+    { 0x1000C, { 0, 8, 8 } },
+    { 0x1000C, { 0, 9, 9 } },
+    { 0x1000C, { 0, 10, 10 } },
+    { 0x1000C, { 0, 11, 11 } },
+    { 0x1000C, { 0, 12, 12 } },
+    { 0x1000C, { 0, 13, 13 } },
+    { 0x1000C, { 0, 14, 14 } },
+    { 0x1000C, { 0, 15, 15 } },
+    { 0x1000C, { 0, 16, 16 } },
+    { 0x1000C, { 0, 17, 17 } },
+    { 0x1000C, { 0, 18, 18 } },
+    { 0x1000C, { 0, 19, 19 } },
+    { 0x1000C, { 0, 20, 20 } },
+    { 0x1000C, { 0, 21, 21 } },
+    { 0x1000C, { 0, 22, 22 } },
+    { 0x1000C, { 0, 23, 23 } },
+    { 0x1000C, { 0, 24, 24 } },
+    { 0x1000C, { 0, 25, 25 } },
+    { 0x10000, { 0, 0, 0 } },
+    { 0x00080, { 0, 0, 0 } },
+    { 0x00020, { 0, 0, 0 } },
+    { 0x00002, { 0, 0, 0 } },
+    { 0x1000C, { 0, 26, 26 } },
+    { 0x1000C, { 0, 27, 27 } },
+    { 0x1000C, { 0, 28, 28 } },
+    { 0x1000C, { 0, 29, 29 } },
+    { 0x1000C, { 0, 30, 30 } },
+    { 0x1000C, { 0, 31, 31 } },
+    { 0x1000C, { 0, 32, 32 } },
+    { 0x1000C, { 0, 33, 33 } },
+    { 0x1000C, { 0, 34, 34 } },
+    { 0x1000C, { 0, 35, 35 } },
+    { 0x1000C, { 0, 36, 36 } },
+    { 0x1000C, { 0, 37, 37 } },
+    { 0x1000C, { 0, 38, 38 } },
+    { 0x1000C, { 0, 39, 39 } },
+    { 0x1000C, { 0, 40, 40 } },
+    { 0x1000C, { 0, 41, 41 } },
+    { 0x1000C, { 0, 42, 42 } },
+    { 0x1000C, { 0, 43, 43 } },
+    { 0x1000C, { 0, 44, 44 } },
+    { 0x1000C, { 0, 45, 45 } },
+    { 0x1000C, { 0, 46, 46 } },
+    { 0x1000C, { 0, 47, 47 } },
+    { 0x1000C, { 0, 48, 48 } },
+    { 0x1000C, { 0, 49, 49 } },
+    { 0x1000C, { 0, 50, 50 } },
+    { 0x1000C, { 0, 51, 51 } },
+    { 0x1000C, { 0, 52, 52 } },
+    { 0x1000C, { 0, 53, 53 } },
+    { 0x1000C, { 0, 54, 54 } },
+    { 0x1000C, { 0, 55, 55 } },
+    { 0x1000C, { 0, 56, 56 } },
+    { 0x1000C, { 0, 57, 57 } },
+    { 0x1000C, { 0, 58, 58 } },
+    { 0x1000C, { 0, 59, 59 } },
+    { 0x1000C, { 0, 60, 60 } },
+    { 0x1000C, { 0, 61, 61 } },
+    { 0x1000C, { 0, 62, 62 } },
+    { 0x1000C, { 0, 63, 63 } },
+    { 0x1000C, { 0, 64, 64 } },
+    { 0x1000C, { 0, 65, 65 } },
+    { 0x1000C, { 0, 66, 66 } },
+    { 0x1000C, { 0, 67, 67 } },
+    { 0x1000C, { 0, 68, 68 } },
+    { 0x1000C, { 0, 69, 69 } },
+    { 0x1000C, { 0, 70, 70 } },
+    { 0x1000C, { 0, 71, 71 } },
+    { 0x1000C, { 0, 72, 72 } },
+    { 0x1000C, { 0, 73, 73 } },
+    { 0x1000C, { 0, 74, 74 } },
+    { 0x1000C, { 0, 75, 75 } },
+    { 0x1000C, { 0, 76, 76 } },
+    { 0x1000C, { 0, 77, 77 } },
+    { 0x1000C, { 0, 78, 78 } },
+    { 0x1000C, { 0, 79, 79 } },
+    { 0x1000C, { 0, 80, 80 } },
+    { 0x1000C, { 0, 81, 81 } },
+    { 0x1000C, { 0, 82, 82 } },
+    { 0x1000C, { 0, 83, 83 } },
+    { 0x1000C, { 0, 84, 84 } },
+    { 0x1000C, { 0, 85, 85 } },
+    { 0x1000C, { 0, 86, 86 } },
+    { 0x1000C, { 0, 87, 87 } },
+    { 0x1000C, { 0, 88, 88 } },
+    { 0x1000C, { 0, 89, 89 } },
+    { 0x1000C, { 0, 90, 90 } },
+    { 0x1000C, { 0, 91, 91 } },
+    { 0x1000C, { 0, 92, 92 } },
+    { 0x1000C, { 0, 93, 93 } },
+    { 0x1000C, { 0, 94, 94 } },
+    { 0x1000C, { 0, 95, 95 } },
+    { 0x1000C, { 0, 96, 96 } },
+    { 0x1000C, { 0, 97, 97 } },
+    { 0x1000C, { 0, 98, 98 } },
+    { 0x1000C, { 0, 99, 99 } },
+    { 0x1000C, { 0, 100, 100 } },
+    { 0x1000C, { 0, 101, 101 } },
+    { 0x1000C, { 0, 102, 102 } },
+    { 0x1000C, { 0, 103, 103 } },
+    { 0x1000C, { 0, 104, 104 } },
+    { 0x1000C, { 0, 105, 105 } },
+    { 0x1000C, { 0, 106, 106 } },
+    { 0x1000C, { 0, 107, 107 } },
+    { 0x1000C, { 0, 108, 108 } },
+    { 0x1000C, { 0, 109, 109 } },
+    { 0x1000C, { 0, 110, 110 } },
+    { 0x1000C, { 0, 111, 111 } },
+    { 0x1000C, { 0, 112, 112 } },
+    { 0x1000C, { 0, 113, 113 } },
+    { 0x1000C, { 0, 114, 114 } },
+    { 0x1000C, { 0, 115, 115 } },
+    { 0x1000C, { 0, 116, 116 } },
+    { 0x1000C, { 0, 117, 117 } },
+    { 0x1000C, { 0, 118, 118 } },
+    { 0x1000C, { 0, 119, 119 } },
+    { 0x1000C, { 0, 120, 120 } },
+    { 0x1000C, { 0, 121, 121 } },
+    { 0x1000C, { 0, 122, 122 } },
+    { 0x1000C, { 0, 123, 123 } },
+    { 0x1000C, { 0, 124, 124 } },
+    { 0x1000C, { 0, 125, 125 } },
+    { 0x1000C, { 0, 126, 126 } },
+    { 0x1000C, { 0, 127, 127 } },
+    { 0x1000C, { 0, 128, 128 } },
+    { 0x1000C, { 0, 129, 129 } },
+    { 0x1000C, { 0, 130, 130 } },
+    { 0x1000C, { 0, 131, 131 } },
+    { 0x1000C, { 0, 132, 132 } },
+    { 0x1000C, { 0, 133, 133 } },
+    { 0x1000C, { 0, 134, 134 } },
+    { 0x1000C, { 0, 135, 135 } },
+    { 0x1000C, { 0, 136, 136 } },
+    { 0x1000C, { 0, 137, 137 } },
+    { 0x1000C, { 0, 138, 138 } },
+    { 0x1000C, { 0, 139, 139 } },
+    { 0x1000C, { 0, 140, 140 } },
+    { 0x1000C, { 0, 141, 141 } },
+    { 0x1000C, { 0, 142, 142 } },
+    { 0x1000C, { 0, 143, 143 } },
+    { 0x1000C, { 0, 144, 144 } },
+    { 0x1000C, { 0, 145, 145 } },
+    { 0x1000C, { 0, 146, 146 } },
+    { 0x1000C, { 0, 147, 147 } },
+    { 0x1000C, { 0, 148, 148 } },
+    { 0x1000C, { 0, 149, 149 } },
+    { 0x1000C, { 0, 150, 150 } },
+    { 0x1000C, { 0, 151, 151 } },
+    { 0x1000C, { 0, 152, 152 } },
+    { 0x1000C, { 0, 153, 153 } },
+    { 0x1000C, { 0, 154, 154 } },
+    { 0x1000C, { 0, 155, 155 } },
+    { 0x1000C, { 0, 156, 156 } },
+    { 0x1000C, { 0, 157, 157 } },
+    { 0x1000C, { 0, 158, 158 } },
+    { 0x1000C, { 0, 159, 159 } },
+    { 0x1000C, { 0, 160, 160 } },
+    { 0x1000C, { 0, 161, 161 } },
+    { 0x1000C, { 0, 162, 162 } },
+    { 0x1000C, { 0, 163, 163 } },
+    { 0x1000C, { 0, 164, 164 } },
+    { 0x1000C, { 0, 165, 165 } },
+    { 0x1000C, { 0, 166, 166 } },
+    { 0x1000C, { 0, 167, 167 } },
+    { 0x1000C, { 0, 168, 168 } },
+    { 0x1000C, { 0, 169, 169 } },
+    { 0x1000C, { 0, 170, 170 } },
+    { 0x1000C, { 0, 171, 171 } },
+    { 0x1000C, { 0, 172, 172 } },
+    { 0x1000C, { 0, 173, 173 } },
+    { 0x1000C, { 0, 174, 174 } },
+    { 0x1000C, { 0, 175, 175 } },
+    { 0x1000C, { 0, 176, 176 } },
+    { 0x1000C, { 0, 177, 177 } },
+    { 0x1000C, { 0, 178, 178 } },
+    { 0x1000C, { 0, 179, 179 } },
+    { 0x1000C, { 0, 180, 180 } },
+    { 0x1000C, { 0, 181, 181 } },
+    { 0x1000C, { 0, 182, 182 } },
+    { 0x1000C, { 0, 183, 183 } },
+    { 0x1000C, { 0, 184, 184 } },
+    { 0x1000C, { 0, 185, 185 } },
+    { 0x1000C, { 0, 186, 186 } },
+    { 0x1000C, { 0, 187, 187 } },
+    { 0x1000C, { 0, 188, 188 } },
+    { 0x1000C, { 0, 189, 189 } },
+    { 0x1000C, { 0, 190, 190 } },
+    { 0x1000C, { 0, 191, 191 } },
+    { 0x1000C, { 0, 192, 192 } },
+    { 0x1000C, { 0, 193, 193 } },
+    { 0x1000C, { 0, 194, 194 } },
+    { 0x1000C, { 0, 195, 195 } },
+    { 0x1000C, { 0, 196, 196 } },
+    { 0x1000C, { 0, 197, 197 } },
+    { 0x1000C, { 0, 198, 198 } },
+    { 0x1000C, { 0, 199, 199 } },
+    { 0x1000C, { 0, 200, 200 } },
+    { 0x1000C, { 0, 201, 201 } },
+    { 0x1000C, { 0, 202, 202 } },
+    { 0x1000C, { 0, 203, 203 } },
+    { 0x1000C, { 0, 204, 204 } },
+    { 0x1000C, { 0, 205, 205 } },
+    { 0x1000C, { 0, 206, 206 } },
+    { 0x1000C, { 0, 207, 207 } },
+    { 0x1000C, { 0, 208, 208 } },
+    { 0x00001, { 0, 0, 0 } },
+    { 0x1000C, { 0, 209, 209 } },
+    { 0x1000C, { 0, 210, 210 } },
+    { 0x1000C, { 0, 211, 211 } },
+    { 0x1000C, { 0, 212, 212 } },
+    { 0x1000C, { 0, 213, 213 } },
+    { 0x1000C, { 0, 214, 214 } },
+    { 0x1000C, { 0, 215, 215 } },
+    { 0x1000C, { 0, 216, 216 } },
+    { 0x1000C, { 0, 217, 217 } },
+    { 0x02000, { 0, 0, 0 } },
+    { 0x0000C, { 0, 218, 218 } },
+    { 0x00002, { 1, 0, 0 } },
+    { 0x10004, { 0, 219, 0 } },
+    { 0x1000C, { 0, 220, 219 } },
+    { 0x1000C, { 0, 221, 220 } },
+    { 0x1000C, { 0, 222, 221 } },
+    { 0x1000C, { 0, 223, 222 } },
+    { 0x1000C, { 0, 224, 223 } },
+    { 0x1000C, { 0, 225, 224 } },
+    { 0x1000C, { 0, 226, 225 } },
+    { 0x1000C, { 0, 227, 226 } },
+    { 0x1000C, { 0, 228, 227 } },
+    { 0x1000C, { 0, 229, 228 } },
+    { 0x1000C, { 0, 230, 229 } },
+    { 0x1000C, { 0, 231, 230 } },
+    { 0x1000C, { 0, 232, 231 } },
+    { 0x1000C, { 0, 233, 232 } },
+    { 0x1000C, { 0, 234, 233 } },
+    { 0x1000C, { 0, 235, 234 } },
+    { 0x1000C, { 0, 236, 235 } },
+    { 0x1000C, { 0, 237, 236 } },
+    { 0x1000C, { 0, 238, 237 } },
+    { 0x1000C, { 0, 239, 238 } },
+    { 0x1000C, { 0, 240, 239 } },
+    { 0x1000C, { 0, 241, 240 } },
+    { 0x1000C, { 0, 242, 241 } },
+    { 0x1000C, { 0, 243, 242 } },
+    { 0x1000C, { 0, 244, 243 } },
+    { 0x1000C, { 0, 245, 244 } },
+    { 0x1000C, { 0, 246, 245 } },
+    { 0x1000C, { 0, 247, 246 } },
+    { 0x1000C, { 0, 248, 247 } },
+    { 0x1000C, { 0, 249, 248 } },
+    { 0x1000C, { 0, 250, 249 } },
+    { 0x1000C, { 0, 251, 250 } },
+    { 0x1000C, { 0, 252, 251 } },
+    { 0x1000C, { 0, 253, 252 } },
+    { 0x1000C, { 0, 254, 253 } },
+    { 0x1000C, { 0, 255, 254 } },
+    { 0x1000C, { 0, 256, 255 } },
+    { 0x1000C, { 0, 257, 256 } },
+    { 0x10004, { 0, 258, 0 } },
+    { 0x10004, { 0, 259, 0 } },
+    { 0x10004, { 0, 260, 0 } },
+    { 0x1000C, { 0, 261, 257 } },
+    { 0x1000C, { 0, 262, 258 } },
+    { 0x1000C, { 0, 263, 259 } },
+    { 0x1000C, { 0, 264, 260 } },
+    { 0x1000C, { 0, 265, 261 } },
+    { 0x1000C, { 0, 266, 262 } },
+    { 0x1000C, { 0, 267, 263 } },
+    { 0x1000C, { 0, 268, 264 } },
+    { 0x1000C, { 0, 269, 265 } },
+    { 0x1000C, { 0, 270, 266 } },
+    { 0x1000C, { 0, 271, 267 } },
+    { 0x1000C, { 0, 272, 268 } },
+    { 0x1000C, { 0, 273, 269 } },
+    { 0x1000C, { 0, 274, 270 } },
+    { 0x1000C, { 0, 275, 271 } },
+    { 0x1000C, { 0, 276, 272 } },
+    { 0x1000C, { 0, 277, 273 } },
+    { 0x1000C, { 0, 278, 274 } },
+    { 0x1000C, { 0, 279, 275 } },
+    { 0x1000C, { 0, 280, 276 } },
+    { 0x1000C, { 0, 281, 277 } },
+    { 0x1000C, { 0, 282, 278 } },
+    { 0x1000C, { 0, 283, 279 } },
+    { 0x1000C, { 0, 284, 280 } },
+    { 0x1000C, { 0, 285, 281 } },
+    { 0x1000C, { 0, 286, 282 } },
+    { 0x1000C, { 0, 287, 283 } },
+    { 0x1000C, { 0, 288, 284 } },
+    { 0x1000C, { 0, 289, 285 } },
+    { 0x1000C, { 0, 290, 286 } },
+    { 0x1000C, { 0, 291, 287 } },
+    { 0x1000C, { 0, 292, 288 } },
+    { 0x1000C, { 0, 293, 289 } },
+    { 0x1000C, { 0, 294, 290 } },
+    { 0x1000C, { 0, 295, 291 } },
+    { 0x1000C, { 0, 296, 292 } },
+    { 0x1000C, { 0, 297, 293 } },
+    { 0x1000C, { 0, 298, 294 } },
+    { 0x1000C, { 0, 299, 295 } },
+    { 0x1000C, { 0, 300, 296 } },
+    { 0x1000C, { 0, 301, 297 } },
+    { 0x1000C, { 0, 302, 298 } },
+    { 0x1000C, { 0, 303, 299 } },
+    { 0x1000C, { 0, 304, 300 } },
+    { 0x1000C, { 0, 305, 301 } },
+    { 0x1000C, { 0, 306, 302 } },
+    { 0x1000C, { 0, 307, 303 } },
+    { 0x1000C, { 0, 308, 304 } },
+    { 0x1000C, { 0, 309, 305 } },
+    { 0x1000C, { 0, 310, 306 } },
+    { 0x1000C, { 0, 311, 307 } },
+    { 0x1000C, { 0, 312, 308 } },
+    { 0x1000C, { 0, 313, 309 } },
+    { 0x1000C, { 0, 314, 310 } },
+    { 0x1000C, { 0, 315, 311 } },
+    { 0x1000C, { 0, 316, 312 } },
+    { 0x1000C, { 0, 317, 313 } },
+    { 0x1000C, { 0, 318, 314 } },
+    { 0x1000C, { 0, 319, 315 } },
+    { 0x1000C, { 0, 320, 316 } },
+    { 0x1000C, { 0, 321, 317 } },
+    { 0x1000C, { 0, 322, 318 } },
+    { 0x1000C, { 0, 323, 319 } },
+    { 0x1000C, { 0, 324, 320 } },
+    { 0x1000C, { 0, 325, 321 } },
+    { 0x1000C, { 0, 326, 322 } },
+    { 0x1000C, { 0, 327, 323 } },
+    { 0x1000C, { 0, 328, 324 } },
+    { 0x1000C, { 0, 329, 325 } },
+    { 0x1000C, { 0, 330, 326 } },
+    { 0x1000C, { 0, 331, 327 } },
+    { 0x1000C, { 0, 332, 328 } },
+    { 0x1000C, { 0, 333, 329 } },
+    { 0x1000C, { 0, 334, 330 } },
+    { 0x1000C, { 0, 335, 331 } },
+    { 0x1000C, { 0, 336, 332 } },
+    { 0x1000C, { 0, 337, 333 } },
+    { 0x1000C, { 0, 338, 334 } },
+    { 0x1000C, { 0, 339, 335 } },
+    { 0x1000C, { 0, 340, 336 } },
+    { 0x1000C, { 0, 341, 337 } },
+    { 0x1000C, { 0, 342, 338 } },
+    { 0x1000C, { 0, 343, 339 } },
+    { 0x1000C, { 0, 344, 340 } },
+    { 0x1000C, { 0, 345, 341 } },
+    { 0x1000C, { 0, 346, 342 } },
+    { 0x1000C, { 0, 347, 343 } },
+    { 0x1000C, { 0, 348, 344 } },
+    { 0x1000C, { 0, 349, 345 } },
+    { 0x1000C, { 0, 350, 346 } },
+    { 0x1000C, { 0, 351, 347 } },
+    { 0x1000C, { 0, 352, 348 } },
+    { 0x1000C, { 0, 353, 349 } },
+    { 0x1000C, { 0, 354, 350 } },
+    { 0x1000C, { 0, 355, 351 } },
+    { 0x1000C, { 0, 356, 352 } },
+    { 0x1000C, { 0, 357, 353 } },
+    { 0x1000C, { 0, 358, 354 } },
+    { 0x1000C, { 0, 359, 355 } },
+    { 0x1000C, { 0, 360, 356 } },
+    { 0x1000C, { 0, 361, 357 } },
+    { 0x1000C, { 0, 362, 358 } },
+    { 0x1000C, { 0, 363, 359 } },
+    { 0x1000C, { 0, 364, 360 } },
+    { 0x1000C, { 0, 365, 361 } },
+    { 0x1000C, { 0, 366, 362 } },
+    { 0x1000C, { 0, 367, 363 } },
+    { 0x1000C, { 0, 368, 364 } },
+    { 0x1000C, { 0, 369, 365 } },
+    { 0x1000C, { 0, 370, 366 } },
+    { 0x1000C, { 0, 371, 367 } },
+    { 0x1000C, { 0, 372, 368 } },
+    { 0x1000C, { 0, 373, 369 } },
+    { 0x1000C, { 0, 374, 370 } },
+    { 0x1000C, { 0, 375, 371 } },
+    { 0x1000C, { 0, 376, 372 } },
+    { 0x1000C, { 0, 377, 373 } },
+    { 0x1000C, { 0, 378, 374 } },
+    { 0x1000C, { 0, 379, 375 } },
+    { 0x1000C, { 0, 380, 376 } },
+    { 0x1000C, { 0, 381, 377 } },
+    { 0x1000C, { 0, 382, 378 } },
+    { 0x1000C, { 0, 383, 379 } },
+    { 0x1000C, { 0, 384, 380 } },
+    { 0x1000C, { 0, 385, 381 } },
+    { 0x1000C, { 0, 386, 382 } },
+    { 0x1000C, { 0, 387, 383 } },
+    { 0x1000C, { 0, 388, 384 } },
+    { 0x1000C, { 0, 389, 385 } },
+    { 0x1000C, { 0, 390, 386 } },
+    { 0x1000C, { 0, 391, 387 } },
+    { 0x1000C, { 0, 392, 388 } },
+    { 0x1000C, { 0, 393, 389 } },
+    { 0x1000C, { 0, 394, 390 } },
+    { 0x1000C, { 0, 395, 391 } },
+    { 0x1000C, { 0, 396, 392 } },
+    { 0x1000C, { 0, 397, 393 } },
+    { 0x1000C, { 0, 398, 394 } },
+    { 0x1000C, { 0, 399, 395 } },
+    { 0x1000C, { 0, 400, 396 } },
+    { 0x1000C, { 0, 401, 397 } },
+    { 0x1000C, { 0, 402, 398 } },
+    { 0x1000C, { 0, 403, 399 } },
+    { 0x1000C, { 0, 404, 400 } },
+    { 0x1000C, { 0, 405, 401 } },
+    { 0x1000C, { 0, 406, 402 } },
+    { 0x1000C, { 0, 407, 403 } },
+    { 0x1000C, { 0, 408, 404 } },
+    { 0x1000C, { 0, 409, 405 } },
+    { 0x1000C, { 0, 410, 406 } },
+    { 0x1000C, { 0, 411, 407 } },
+    { 0x1000C, { 0, 412, 408 } },
+    { 0x1000C, { 0, 413, 409 } },
+    { 0x1000C, { 0, 414, 410 } },
+    { 0x1000C, { 0, 415, 411 } },
+    { 0x1000C, { 0, 416, 412 } },
+    { 0x1000C, { 0, 417, 413 } },
+    { 0x1000C, { 0, 418, 414 } },
+    { 0x1000C, { 0, 419, 415 } },
+    { 0x1000C, { 0, 420, 416 } },
+    { 0x1000C, { 0, 421, 417 } },
+    { 0x1000C, { 0, 422, 418 } },
+    { 0x1000C, { 0, 423, 419 } },
+    { 0x1000C, { 0, 424, 420 } },
+    { 0x1000C, { 0, 425, 421 } },
+    { 0x1000C, { 0, 426, 422 } },
+    { 0x1000C, { 0, 427, 423 } },
+    { 0x1000C, { 0, 428, 424 } },
+    { 0x1000C, { 0, 429, 425 } },
+    { 0x1000C, { 0, 430, 426 } },
+    { 0x1000C, { 0, 431, 427 } },
+    { 0x1000C, { 0, 432, 428 } },
+    { 0x1000C, { 0, 433, 429 } },
+    { 0x1000C, { 0, 434, 430 } },
+    { 0x1000C, { 0, 435, 431 } },
+    { 0x1000C, { 0, 436, 432 } },
+    { 0x1000C, { 0, 437, 433 } },
+    { 0x1000C, { 0, 438, 434 } },
+    { 0x1000C, { 0, 439, 435 } },
+    { 0x1000C, { 0, 440, 436 } },
+    { 0x1000C, { 0, 441, 437 } },
+    { 0x1000C, { 0, 442, 438 } },
+    { 0x1000C, { 0, 443, 439 } },
+    { 0x1000C, { 0, 444, 440 } },
+    { 0x1000C, { 0, 445, 441 } },
+    { 0x08000, { 0, 0, 0 } },
+    { 0x08080, { 0, 0, 0 } },
+    { 0x00002, { 2, 0, 0 } },
+    { 0x00002, { 3, 0, 0 } },
+    { 0x00002, { 4, 0, 0 } },
+    { 0x00002, { 5, 0, 0 } },
+    { 0x1000C, { 0, 446, 442 } },
+    { 0x1000C, { 0, 447, 443 } },
+    { 0x1000C, { 0, 448, 444 } },
+    { 0x1000C, { 0, 449, 445 } },
+    { 0x1000C, { 0, 450, 446 } },
+    { 0x1000C, { 0, 451, 447 } },
+    { 0x1000C, { 0, 452, 448 } },
+    { 0x1000C, { 0, 453, 449 } },
+    { 0x1000C, { 0, 454, 450 } },
+    { 0x1000C, { 0, 455, 451 } },
+    { 0x1000C, { 0, 456, 452 } },
+    { 0x1000C, { 0, 457, 453 } },
+    { 0x1000C, { 0, 458, 454 } },
+    { 0x1000C, { 0, 459, 455 } },
+    { 0x1000C, { 0, 460, 456 } },
+    { 0x1000C, { 0, 461, 457 } },
+    { 0x1000C, { 0, 462, 458 } },
+    { 0x1000C, { 0, 463, 459 } },
+    { 0x1000C, { 0, 464, 460 } },
+    { 0x1000C, { 0, 465, 461 } },
+    { 0x1000C, { 0, 466, 462 } },
+    { 0x1000C, { 0, 467, 463 } },
+    { 0x1000C, { 0, 468, 464 } },
+    { 0x1000C, { 0, 469, 465 } },
+    { 0x1000C, { 0, 470, 466 } },
+    { 0x1000C, { 0, 471, 467 } },
+    { 0x1000C, { 0, 472, 468 } },
+    { 0x1000C, { 0, 473, 469 } },
+    { 0x1000C, { 0, 474, 470 } },
+    { 0x1000C, { 0, 475, 471 } },
+    { 0x1000C, { 0, 476, 472 } },
+    { 0x1000C, { 0, 477, 473 } },
+    { 0x1000C, { 0, 478, 474 } },
+    { 0x1000C, { 0, 479, 475 } },
+    { 0x1000C, { 0, 480, 476 } },
+    { 0x1000C, { 0, 481, 477 } },
+    { 0x1000C, { 0, 482, 478 } },
+    { 0x1000C, { 0, 483, 479 } },
+    { 0x1000C, { 0, 484, 480 } },
+    { 0x1000C, { 0, 485, 481 } },
+    { 0x1000C, { 0, 486, 482 } },
+    { 0x1000C, { 0, 487, 483 } },
+    { 0x1000C, { 0, 488, 484 } },
+    { 0x1000C, { 0, 489, 485 } },
+    { 0x1000C, { 0, 490, 486 } },
+    { 0x1000C, { 0, 491, 487 } },
+    { 0x1000C, { 0, 492, 488 } },
+    { 0x1000C, { 0, 493, 489 } },
+    { 0x1000C, { 0, 494, 490 } },
+    { 0x1000C, { 0, 495, 491 } },
+    { 0x1000C, { 0, 496, 492 } },
+    { 0x1000C, { 0, 497, 493 } },
+    { 0x1000C, { 0, 498, 494 } },
+    { 0x1000C, { 0, 499, 495 } },
+    { 0x1000C, { 0, 500, 496 } },
+    { 0x1000C, { 0, 501, 497 } },
+    { 0x1000C, { 0, 502, 498 } },
+    { 0x1000C, { 0, 503, 499 } },
+    { 0x1000C, { 0, 504, 500 } },
+    { 0x1000C, { 0, 505, 501 } },
+    { 0x1000C, { 0, 506, 502 } },
+    { 0x1000C, { 0, 507, 503 } },
+    { 0x1000C, { 0, 508, 504 } },
+    { 0x1000C, { 0, 509, 505 } },
+    { 0x1000C, { 0, 510, 506 } },
+    { 0x1000C, { 0, 511, 507 } },
+    { 0x1000C, { 0, 512, 508 } },
+    { 0x1000C, { 0, 513, 509 } },
+    { 0x1000C, { 0, 514, 510 } },
+    { 0x1000C, { 0, 515, 511 } },
+    { 0x1000C, { 0, 516, 512 } },
+    { 0x1000C, { 0, 517, 513 } },
+    { 0x1000C, { 0, 518, 514 } },
+    { 0x1000C, { 0, 519, 515 } },
+    { 0x1000C, { 0, 520, 516 } },
+    { 0x1000C, { 0, 521, 517 } },
+    { 0x1000C, { 0, 522, 518 } },
+    { 0x1000C, { 0, 523, 519 } },
+    { 0x1000C, { 0, 524, 520 } },
+    { 0x1000C, { 0, 525, 521 } },
+    { 0x1000C, { 0, 526, 522 } },
+    { 0x1000C, { 0, 527, 523 } },
+    { 0x1000C, { 0, 528, 524 } },
+    { 0x1000C, { 0, 529, 525 } },
+    { 0x1000C, { 0, 530, 526 } },
+    { 0x1000C, { 0, 531, 527 } },
+    { 0x1000C, { 0, 532, 528 } },
+    { 0x1000C, { 0, 533, 529 } },
+    { 0x1000C, { 0, 534, 530 } },
+    { 0x1000C, { 0, 535, 531 } },
+    { 0x1000C, { 0, 536, 532 } },
+    { 0x1000C, { 0, 537, 533 } },
+    { 0x1000C, { 0, 538, 534 } },
+    { 0x1000C, { 0, 539, 535 } },
+    { 0x1000C, { 0, 540, 536 } },
+    { 0x1000C, { 0, 541, 537 } },
+    { 0x1000C, { 0, 542, 538 } },
+    { 0x1000C, { 0, 543, 539 } },
+    { 0x1000C, { 0, 544, 540 } },
+    { 0x1000C, { 0, 545, 541 } },
+    { 0x1000C, { 0, 546, 542 } },
+    { 0x1000C, { 0, 547, 543 } },
+    { 0x1000C, { 0, 548, 544 } },
+    { 0x1000C, { 0, 549, 545 } },
+    { 0x1000C, { 0, 550, 546 } },
+    { 0x1000C, { 0, 551, 547 } },
+    { 0x1000C, { 0, 552, 548 } },
+    { 0x1000C, { 0, 553, 549 } },
+    { 0x1000C, { 0, 554, 550 } },
+    { 0x1000C, { 0, 555, 551 } },
+    { 0x1000C, { 0, 556, 552 } },
+    { 0x1000C, { 0, 557, 553 } },
+    { 0x1000C, { 0, 558, 554 } },
+    { 0x1000C, { 0, 559, 555 } },
+    { 0x1000C, { 0, 560, 556 } },
+    { 0x1000C, { 0, 561, 557 } },
+    { 0x1000C, { 0, 562, 558 } },
+    { 0x1000C, { 0, 563, 559 } },
+    { 0x1000C, { 0, 564, 560 } },
+    { 0x1000C, { 0, 565, 561 } },
+    { 0x1000C, { 0, 566, 562 } },
+    { 0x1000C, { 0, 567, 563 } },
+    { 0x1000C, { 0, 568, 564 } },
+    { 0x1000C, { 0, 569, 565 } },
+    { 0x1000C, { 0, 570, 566 } },
+    { 0x1000C, { 0, 571, 567 } },
+    { 0x1000C, { 0, 572, 568 } },
+    { 0x1000C, { 0, 573, 569 } },
+    { 0x1000C, { 0, 574, 570 } },
+    { 0x1000C, { 0, 575, 571 } },
+    { 0x1000C, { 0, 576, 572 } },
+    { 0x1000C, { 0, 577, 573 } },
+    { 0x1000C, { 0, 578, 574 } },
+    { 0x1000C, { 0, 579, 575 } },
+    { 0x1000C, { 0, 580, 576 } },
+    { 0x1000C, { 0, 581, 577 } },
+    { 0x1000C, { 0, 582, 578 } },
+    { 0x1000C, { 0, 583, 579 } },
+    { 0x1000C, { 0, 584, 580 } },
+    { 0x1000C, { 0, 585, 581 } },
+    { 0x1000C, { 0, 586, 582 } },
+    { 0x1000C, { 0, 587, 583 } },
+    { 0x1000C, { 0, 588, 584 } },
+    { 0x1000C, { 0, 589, 585 } },
+    { 0x1000C, { 0, 590, 586 } },
+    { 0x1000C, { 0, 591, 587 } },
+    { 0x1000C, { 0, 592, 588 } },
+    { 0x1000C, { 0, 593, 589 } },
+    { 0x1000C, { 0, 594, 590 } },
+    { 0x1000C, { 0, 595, 591 } },
+    { 0x1000C, { 0, 596, 592 } },
+    { 0x1000C, { 0, 597, 593 } },
+    { 0x1000C, { 0, 598, 594 } },
+    { 0x1000C, { 0, 599, 595 } },
+    { 0x1000C, { 0, 600, 596 } },
+    { 0x1000C, { 0, 601, 597 } },
+    { 0x1000C, { 0, 602, 598 } },
+    { 0x1000C, { 0, 603, 599 } },
+    { 0x1000C, { 0, 604, 600 } },
+    { 0x1000C, { 0, 605, 601 } },
+    { 0x1000C, { 0, 606, 602 } },
+    { 0x1000C, { 0, 607, 603 } },
+    { 0x1000C, { 0, 608, 604 } },
+    { 0x1000C, { 0, 609, 605 } },
+    { 0x1000C, { 0, 610, 606 } },
+    { 0x1000C, { 0, 611, 607 } },
+    { 0x1000C, { 0, 612, 608 } },
+    { 0x1000C, { 0, 613, 609 } },
+    { 0x1000C, { 0, 614, 610 } },
+    { 0x1000C, { 0, 615, 611 } },
+    { 0x1000C, { 0, 616, 612 } },
+    { 0x1000C, { 0, 617, 613 } },
+    { 0x1000C, { 0, 618, 614 } },
+    { 0x1000C, { 0, 619, 615 } },
+    { 0x1000C, { 0, 620, 616 } },
+    { 0x1000C, { 0, 621, 617 } },
+    { 0x1000C, { 0, 622, 618 } },
+    { 0x1000C, { 0, 623, 619 } },
+    { 0x1000C, { 0, 624, 620 } },
+    { 0x1000C, { 0, 625, 621 } },
+    { 0x1000C, { 0, 626, 622 } },
+    { 0x1000C, { 0, 627, 623 } },
+    { 0x1000C, { 0, 628, 624 } },
+    { 0x1000C, { 0, 629, 625 } },
+    { 0x1000C, { 0, 630, 626 } },
+    { 0x1000C, { 0, 631, 627 } },
+    { 0x1000C, { 0, 632, 628 } },
+    { 0x1000C, { 0, 633, 629 } },
+    { 0x1000C, { 0, 634, 630 } },
+    { 0x1000C, { 0, 635, 631 } },
+    { 0x1000C, { 0, 636, 632 } },
+    { 0x1000C, { 0, 637, 633 } },
+    { 0x1000C, { 0, 638, 634 } },
+    { 0x1000C, { 0, 639, 635 } },
+    { 0x1000C, { 0, 640, 636 } },
+    { 0x1000C, { 0, 641, 637 } },
+    { 0x1000C, { 0, 642, 638 } },
+    { 0x1000C, { 0, 643, 639 } },
+    { 0x1000C, { 0, 644, 640 } },
+    { 0x1000C, { 0, 645, 641 } },
+    { 0x1000C, { 0, 646, 642 } },
+    { 0x1000C, { 0, 647, 643 } },
+    { 0x1000C, { 0, 648, 644 } },
+    { 0x1000C, { 0, 649, 645 } },
+    { 0x1000C, { 0, 650, 646 } },
+    { 0x1000C, { 0, 651, 647 } },
+    { 0x1000C, { 0, 652, 648 } },
+    { 0x1000C, { 0, 653, 649 } },
+    { 0x1000C, { 0, 654, 650 } },
+    { 0x1000C, { 0, 655, 651 } },
+    { 0x1000C, { 0, 656, 652 } },
+    { 0x1000C, { 0, 657, 653 } },
+    { 0x1000C, { 0, 658, 654 } },
+    { 0x1000C, { 0, 659, 655 } },
+    { 0x1000C, { 0, 660, 656 } },
+    { 0x1000C, { 0, 661, 657 } },
+    { 0x1000C, { 0, 662, 658 } },
+    { 0x1000C, { 0, 663, 659 } },
+    { 0x1000C, { 0, 664, 660 } },
+    { 0x1000C, { 0, 665, 661 } },
+    { 0x1000C, { 0, 666, 662 } },
+    { 0x1000C, { 0, 667, 663 } },
+    { 0x1000C, { 0, 668, 664 } },
+    { 0x1000C, { 0, 669, 665 } },
+    { 0x1000C, { 0, 670, 666 } },
+    { 0x1000C, { 0, 671, 667 } },
+    { 0x1000C, { 0, 672, 668 } },
+    { 0x1000C, { 0, 673, 669 } },
+    { 0x1000C, { 0, 674, 670 } },
+    { 0x1000C, { 0, 675, 671 } },
+    { 0x1000C, { 0, 676, 672 } },
+    { 0x1000C, { 0, 677, 673 } },
+    { 0x1000C, { 0, 678, 674 } },
+    { 0x1000C, { 0, 679, 675 } },
+    { 0x1000C, { 0, 680, 676 } },
+    { 0x1000C, { 0, 681, 677 } },
+    { 0x1000C, { 0, 682, 678 } },
+    { 0x1000C, { 0, 683, 679 } },
+    { 0x1000C, { 0, 684, 680 } },
+    { 0x1000C, { 0, 685, 681 } },
+    { 0x1000C, { 0, 686, 682 } },
+    { 0x1000C, { 0, 687, 683 } },
+    { 0x1000C, { 0, 688, 684 } },
+    { 0x1000C, { 0, 689, 685 } },
+    { 0x1000C, { 0, 690, 686 } },
+    { 0x1000C, { 0, 691, 687 } },
+    { 0x1000C, { 0, 692, 688 } },
+    { 0x1000C, { 0, 693, 689 } },
+    { 0x1000C, { 0, 694, 690 } },
+    { 0x1000C, { 0, 695, 691 } },
+    { 0x1000C, { 0, 696, 692 } },
+    { 0x1000C, { 0, 697, 693 } },
+    { 0x1000C, { 0, 698, 694 } },
+    { 0x1000C, { 0, 699, 695 } },
+    { 0x1000C, { 0, 700, 696 } },
+    { 0x1000C, { 0, 701, 697 } },
+    { 0x1000C, { 0, 702, 698 } },
+    { 0x1000C, { 0, 703, 699 } },
+    { 0x1000C, { 0, 704, 700 } },
+    { 0x1000C, { 0, 705, 701 } },
+    { 0x1000C, { 0, 706, 702 } },
+    { 0x1000C, { 0, 707, 703 } },
+    { 0x1000C, { 0, 708, 704 } },
+    { 0x1000C, { 0, 709, 705 } },
+    { 0x1000C, { 0, 710, 706 } },
+    { 0x1000C, { 0, 711, 707 } },
+    { 0x1000C, { 0, 712, 708 } },
+    { 0x1000C, { 0, 713, 709 } },
+    { 0x1000C, { 0, 714, 710 } },
+    { 0x1000C, { 0, 715, 711 } },
+    { 0x1000C, { 0, 716, 712 } },
+    { 0x1000C, { 0, 717, 713 } },
+    { 0x1000C, { 0, 718, 714 } },
+    { 0x1000C, { 0, 719, 715 } },
+    { 0x1000C, { 0, 720, 716 } },
+    { 0x00022, { 6, 0, 0 } },
+    { 0x00082, { 7, 0, 0 } },
+    { 0x00082, { 8, 0, 0 } },
+    { 0x12000, { 0, 0, 0 } },
+    { 0x0A000, { 0, 0, 0 } },
+    { 0x00082, { 9, 0, 0 } },
+    { 0x02080, { 0, 0, 0 } },
+    { 0x00004, { 0, 721, 0 } },
+    { 0x10004, { 0, 722, 0 } },
+    { 0x00004, { 0, 723, 0 } },
+    { 0x10004, { 0, 724, 0 } },
+    { 0x00004, { 0, 725, 0 } },
+    { 0x10004, { 0, 726, 0 } },
+    { 0x10004, { 0, 727, 0 } },
+    { 0x10004, { 0, 728, 0 } },
+    { 0x10004, { 0, 729, 0 } },
+    { 0x10004, { 0, 730, 0 } },
+    { 0x10004, { 0, 731, 0 } },
+    { 0x10004, { 0, 732, 0 } },
+    { 0x00004, { 0, 733, 0 } },
+    { 0x10004, { 0, 734, 0 } },
+    { 0x10004, { 0, 735, 0 } },
+    { 0x10004, { 0, 736, 0 } },
+    { 0x10004, { 0, 737, 0 } },
+    { 0x10004, { 0, 738, 0 } },
+    { 0x00004, { 0, 739, 0 } },
+    { 0x00004, { 0, 740, 0 } },
+    { 0x00004, { 0, 741, 0 } },
+    { 0x10004, { 0, 742, 0 } },
+    { 0x1000C, { 0, 743, 717 } },
+    { 0x10004, { 0, 744, 0 } },
+    { 0x1000C, { 0, 745, 718 } },
+    { 0x1000C, { 0, 746, 719 } },
+    { 0x10004, { 0, 747, 0 } },
+    { 0x10004, { 0, 748, 0 } },
+    { 0x10004, { 0, 749, 0 } },
+    { 0x10004, { 0, 750, 0 } },
+    { 0x10004, { 0, 751, 0 } },
+    { 0x10004, { 0, 752, 0 } },
+    { 0x10004, { 0, 753, 0 } },
+    { 0x10004, { 0, 754, 0 } },
+    { 0x1000C, { 0, 755, 720 } },
+    { 0x1000C, { 0, 756, 721 } },
+    { 0x1000C, { 0, 757, 722 } },
+    { 0x1000C, { 0, 758, 723 } },
+    { 0x1000C, { 0, 759, 724 } },
+    { 0x1000C, { 0, 760, 725 } },
+    { 0x1000C, { 0, 761, 726 } },
+    { 0x1000C, { 0, 762, 727 } },
+    { 0x1000C, { 0, 763, 728 } },
+    { 0x1000C, { 0, 764, 729 } },
+    { 0x1000C, { 0, 765, 730 } },
+    { 0x1000C, { 0, 766, 731 } },
+    { 0x1000C, { 0, 767, 732 } },
+    { 0x1000C, { 0, 768, 733 } },
+    { 0x1000C, { 0, 769, 734 } },
+    { 0x1000C, { 0, 770, 735 } },
+    { 0x1000C, { 0, 771, 736 } },
+    { 0x1000C, { 0, 772, 737 } },
+    { 0x1000C, { 0, 773, 738 } },
+    { 0x1000C, { 0, 774, 739 } },
+    { 0x1000C, { 0, 775, 740 } },
+    { 0x1000C, { 0, 776, 741 } },
+    { 0x1000C, { 0, 777, 742 } },
+    { 0x1000C, { 0, 778, 743 } },
+    { 0x1000C, { 0, 779, 744 } },
+    { 0x1000C, { 0, 780, 745 } },
+    { 0x1000C, { 0, 781, 746 } },
+    { 0x1000C, { 0, 782, 747 } },
+    { 0x1000C, { 0, 783, 748 } },
+    { 0x1000C, { 0, 784, 749 } },
+    { 0x1000C, { 0, 785, 750 } },
+    { 0x1000C, { 0, 786, 751 } },
+    { 0x1000C, { 0, 787, 752 } },
+    { 0x1000C, { 0, 788, 753 } },
+    { 0x1000C, { 0, 789, 754 } },
+    { 0x1000C, { 0, 790, 755 } },
+    { 0x1000C, { 0, 791, 756 } },
+    { 0x1000C, { 0, 792, 757 } },
+    { 0x1000C, { 0, 793, 758 } },
+    { 0x1000C, { 0, 794, 759 } },
+    { 0x1000C, { 0, 795, 760 } },
+    { 0x1000C, { 0, 796, 761 } },
+    { 0x01000, { 0, 0, 0 } },
+    { 0x10004, { 0, 797, 0 } },
+    { 0x10004, { 0, 798, 0 } },
+    { 0x10004, { 0, 799, 0 } },
+    { 0x10004, { 0, 800, 0 } },
+    { 0x10004, { 0, 801, 0 } },
+    { 0x10004, { 0, 802, 0 } },
+    { 0x10004, { 0, 803, 0 } },
+    { 0x10004, { 0, 804, 0 } },
+    { 0x10004, { 0, 805, 0 } },
+    { 0x10004, { 0, 806, 0 } },
+    { 0x10004, { 0, 807, 0 } },
+    { 0x10004, { 0, 808, 0 } },
+    { 0x10004, { 0, 809, 0 } },
+    { 0x10004, { 0, 810, 0 } },
+    { 0x10004, { 0, 811, 0 } },
+    { 0x10004, { 0, 812, 0 } },
+    { 0x10004, { 0, 813, 0 } },
+    { 0x10004, { 0, 814, 0 } },
+    { 0x10004, { 0, 815, 0 } },
+    { 0x10004, { 0, 816, 0 } },
+    { 0x10004, { 0, 817, 0 } },
+    { 0x10004, { 0, 818, 0 } },
+    { 0x10004, { 0, 819, 0 } },
+    { 0x10004, { 0, 820, 0 } },
+    { 0x10004, { 0, 821, 0 } },
+    { 0x10004, { 0, 822, 0 } },
+    { 0x10004, { 0, 823, 0 } },
+    { 0x10004, { 0, 824, 0 } },
+    { 0x10004, { 0, 825, 0 } },
+    { 0x10004, { 0, 826, 0 } },
+    { 0x10004, { 0, 827, 0 } },
+    { 0x10004, { 0, 828, 0 } },
+    { 0x10004, { 0, 829, 0 } },
+    { 0x10004, { 0, 830, 0 } },
+    { 0x10004, { 0, 831, 0 } },
+    { 0x10004, { 0, 832, 0 } },
+    { 0x10004, { 0, 833, 0 } },
+    { 0x10004, { 0, 834, 0 } },
+    { 0x10004, { 0, 835, 0 } },
+    { 0x10004, { 0, 836, 0 } },
+    { 0x10004, { 0, 837, 0 } },
+    { 0x10004, { 0, 838, 0 } },
+    { 0x10004, { 0, 839, 0 } },
+    { 0x10004, { 0, 840, 0 } },
+    { 0x10004, { 0, 841, 0 } },
+    { 0x10004, { 0, 842, 0 } },
+    { 0x10004, { 0, 843, 0 } },
+    { 0x10004, { 0, 844, 0 } },
+    { 0x10004, { 0, 845, 0 } },
+    { 0x10004, { 0, 846, 0 } },
+    { 0x10400, { 0, 0, 0 } },
+    { 0x10100, { 0, 0, 0 } },
+    { 0x1000C, { 0, 847, 762 } },
+    { 0x1000C, { 0, 848, 763 } },
+    { 0x1000C, { 0, 849, 764 } },
+    { 0x1000C, { 0, 850, 765 } },
+    { 0x1000C, { 0, 851, 766 } },
+    { 0x1000C, { 0, 852, 767 } },
+    { 0x1000C, { 0, 853, 768 } },
+    { 0x1000C, { 0, 854, 769 } },
+    { 0x1000C, { 0, 855, 770 } },
+    { 0x1000C, { 0, 856, 771 } },
+    { 0x1000C, { 0, 857, 772 } },
+    { 0x1000C, { 0, 858, 773 } },
+    { 0x00200, { 0, 0, 0 } },
+    { 0x00002, { 10, 0, 0 } },
+    { 0x00002, { 11, 0, 0 } },
+    { 0x00002, { 12, 0, 0 } },
+    { 0x00002, { 13, 0, 0 } },
+    { 0x00002, { 14, 0, 0 } },
+    { 0x00002, { 15, 0, 0 } },
+    { 0x00002, { 16, 0, 0 } },
+    { 0x00002, { 17, 0, 0 } },
+    { 0x00002, { 18, 0, 0 } },
+    { 0x00002, { 19, 0, 0 } },
+    { 0x00002, { 20, 0, 0 } },
+    { 0x00002, { 21, 0, 0 } },
+    { 0x00002, { 22, 0, 0 } },
+    { 0x00002, { 23, 0, 0 } },
+    { 0x00002, { 24, 0, 0 } },
+    { 0x00002, { 25, 0, 0 } },
+    { 0x00082, { 26, 0, 0 } },
+    { 0x1000C, { 0, 859, 774 } },
+    { 0x1000C, { 0, 860, 775 } },
+    { 0x1000C, { 0, 861, 776 } },
+    { 0x1000C, { 0, 862, 777 } },
+    { 0x1000C, { 0, 863, 778 } },
+    { 0x1000C, { 0, 864, 779 } },
+    { 0x1000C, { 0, 865, 780 } },
+    { 0x1000C, { 0, 866, 781 } },
+    { 0x1000C, { 0, 867, 782 } },
+    { 0x1000C, { 0, 868, 783 } },
+    { 0x1000C, { 0, 869, 784 } },
+    { 0x1000C, { 0, 870, 785 } },
+    { 0x1000C, { 0, 871, 786 } },
+    { 0x1000C, { 0, 872, 787 } },
+    { 0x1000C, { 0, 873, 788 } },
+    { 0x1000C, { 0, 874, 789 } },
+    { 0x1000C, { 0, 875, 790 } },
+    { 0x1000C, { 0, 876, 791 } },
+    { 0x1000C, { 0, 877, 792 } },
+    { 0x1000C, { 0, 878, 793 } },
+    { 0x1000C, { 0, 879, 794 } },
+    { 0x1000C, { 0, 880, 795 } },
+    { 0x1000C, { 0, 881, 796 } },
+    { 0x1000C, { 0, 882, 797 } },
+    { 0x1000C, { 0, 883, 798 } },
+    { 0x1000C, { 0, 884, 799 } },
+    { 0x00880, { 0, 0, 0 } },
+    { 0x00800, { 0, 0, 0 } },
+    { 0x1000C, { 0, 885, 800 } },
+    { 0x1000C, { 0, 886, 801 } },
+    { 0x1000C, { 0, 887, 802 } },
+    { 0x1000C, { 0, 888, 803 } },
+    { 0x1000C, { 0, 889, 804 } },
+    { 0x1000C, { 0, 890, 805 } },
+    { 0x1000C, { 0, 891, 806 } },
+    { 0x1000C, { 0, 892, 807 } },
+    { 0x1000C, { 0, 893, 808 } },
+    { 0x1000C, { 0, 894, 809 } },
+    { 0x1000C, { 0, 895, 810 } },
+    { 0x1000C, { 0, 896, 811 } },
+    { 0x1000C, { 0, 897, 812 } },
+    { 0x1000C, { 0, 898, 813 } },
+    { 0x1000C, { 0, 899, 814 } },
+    { 0x1000C, { 0, 900, 815 } },
+    { 0x1000C, { 0, 901, 816 } },
+    { 0x1000C, { 0, 902, 817 } },
+    { 0x1000C, { 0, 903, 818 } },
+    { 0x1000C, { 0, 904, 819 } },
+    { 0x1000C, { 0, 905, 820 } },
+    { 0x1000C, { 0, 906, 821 } },
+    { 0x1000C, { 0, 907, 822 } },
+    { 0x1000C, { 0, 908, 823 } },
+    { 0x1000C, { 0, 909, 824 } },
+    { 0x1000C, { 0, 910, 825 } },
+    { 0x1000C, { 0, 911, 826 } },
+    { 0x1000C, { 0, 912, 827 } },
+    { 0x1000C, { 0, 913, 828 } },
+    { 0x1000C, { 0, 914, 829 } },
+    { 0x1000C, { 0, 915, 830 } },
+    { 0x1000C, { 0, 916, 831 } },
+    { 0x1000C, { 0, 917, 832 } },
+    { 0x1000C, { 0, 918, 833 } },
+    { 0x1000C, { 0, 919, 834 } },
+    { 0x1000C, { 0, 920, 835 } },
+    { 0x1000C, { 0, 921, 836 } },
+    { 0x1000C, { 0, 922, 837 } },
+    { 0x10004, { 0, 923, 0 } },
+    { 0x10004, { 0, 924, 0 } },
+    { 0x10004, { 0, 925, 0 } },
+    { 0x10004, { 0, 926, 0 } },
+    { 0x10004, { 0, 927, 0 } },
+    { 0x10004, { 0, 928, 0 } },
+    { 0x10004, { 0, 929, 0 } },
+    { 0x10004, { 0, 930, 0 } },
+    { 0x10004, { 0, 931, 0 } },
+    { 0x10004, { 0, 932, 0 } },
+    { 0x10004, { 0, 933, 0 } },
+    { 0x10004, { 0, 934, 0 } },
+    { 0x10004, { 0, 935, 0 } },
+    { 0x10004, { 0, 936, 0 } },
+    { 0x10004, { 0, 937, 0 } },
+    { 0x10004, { 0, 938, 0 } },
+    { 0x10004, { 0, 939, 0 } },
+    { 0x10004, { 0, 940, 0 } },
+    { 0x10004, { 0, 941, 0 } },
+    { 0x10004, { 0, 942, 0 } },
+    { 0x10004, { 0, 943, 0 } },
+    { 0x10004, { 0, 944, 0 } },
+    { 0x10004, { 0, 945, 0 } },
+    { 0x10004, { 0, 946, 0 } },
+    { 0x10004, { 0, 947, 0 } },
+    { 0x10004, { 0, 948, 0 } },
+    { 0x10004, { 0, 949, 0 } },
+    { 0x10004, { 0, 950, 0 } },
+    { 0x10004, { 0, 951, 0 } },
+    { 0x10004, { 0, 952, 0 } },
+    { 0x10004, { 0, 953, 0 } },
+    { 0x10004, { 0, 954, 0 } },
+    { 0x10004, { 0, 955, 0 } },
+    { 0x10004, { 0, 956, 0 } },
+    { 0x10004, { 0, 957, 0 } },
+    { 0x10004, { 0, 958, 0 } },
+    { 0x10004, { 0, 959, 0 } },
+    { 0x10004, { 0, 960, 0 } },
+    { 0x10004, { 0, 961, 0 } },
+    { 0x10004, { 0, 962, 0 } },
+    { 0x10004, { 0, 963, 0 } },
+    { 0x10004, { 0, 964, 0 } },
+    { 0x10004, { 0, 965, 0 } },
+    { 0x10004, { 0, 966, 0 } },
+    { 0x10004, { 0, 967, 0 } },
+    { 0x10004, { 0, 968, 0 } },
+    { 0x10004, { 0, 969, 0 } },
+    { 0x10004, { 0, 970, 0 } },
+    { 0x10004, { 0, 971, 0 } },
+    { 0x10004, { 0, 972, 0 } },
+    { 0x10004, { 0, 973, 0 } },
+    { 0x10004, { 0, 974, 0 } },
+    { 0x10004, { 0, 975, 0 } },
+    { 0x10004, { 0, 976, 0 } },
+    { 0x10004, { 0, 977, 0 } },
+    { 0x10004, { 0, 978, 0 } },
+    { 0x10004, { 0, 979, 0 } },
+    { 0x10004, { 0, 980, 0 } },
+    { 0x10004, { 0, 981, 0 } },
+    { 0x10004, { 0, 982, 0 } },
+    { 0x10004, { 0, 983, 0 } },
+    { 0x10004, { 0, 984, 0 } },
+    { 0x10004, { 0, 985, 0 } },
+    { 0x10004, { 0, 986, 0 } },
+    { 0x10004, { 0, 987, 0 } },
+    { 0x10004, { 0, 988, 0 } },
+    { 0x10004, { 0, 989, 0 } },
+    { 0x10004, { 0, 990, 0 } },
+    { 0x10004, { 0, 991, 0 } },
+    { 0x10004, { 0, 992, 0 } },
+    { 0x10004, { 0, 993, 0 } },
+    { 0x10004, { 0, 994, 0 } },
+    { 0x10004, { 0, 995, 0 } },
+    { 0x10004, { 0, 996, 0 } },
+    { 0x10004, { 0, 997, 0 } },
+    { 0x10004, { 0, 998, 0 } },
+    { 0x10004, { 0, 999, 0 } },
+    { 0x10004, { 0, 1000, 0 } },
+    { 0x10004, { 0, 1001, 0 } },
+    { 0x10004, { 0, 1002, 0 } },
+    { 0x10004, { 0, 1003, 0 } },
+    { 0x10004, { 0, 1004, 0 } },
+    { 0x10004, { 0, 1005, 0 } },
+    { 0x10004, { 0, 1006, 0 } },
+    { 0x10004, { 0, 1007, 0 } },
+    { 0x10004, { 0, 1008, 0 } },
+    { 0x10004, { 0, 1009, 0 } },
+    { 0x10004, { 0, 1010, 0 } },
+    { 0x10004, { 0, 1011, 0 } },
+    { 0x10004, { 0, 1012, 0 } },
+    { 0x10004, { 0, 1013, 0 } },
+    { 0x10004, { 0, 1014, 0 } },
+    { 0x10004, { 0, 1015, 0 } },
+    { 0x10004, { 0, 1016, 0 } },
+    { 0x10004, { 0, 1017, 0 } },
+    { 0x10004, { 0, 1018, 0 } },
+    { 0x10004, { 0, 1019, 0 } },
+    { 0x10004, { 0, 1020, 0 } },
+    { 0x10004, { 0, 1021, 0 } },
+    { 0x10004, { 0, 1022, 0 } },
+    { 0x10004, { 0, 1023, 0 } },
+    { 0x10004, { 0, 1024, 0 } },
+    { 0x10004, { 0, 1025, 0 } },
+    { 0x10004, { 0, 1026, 0 } },
+    { 0x10004, { 0, 1027, 0 } },
+    { 0x10004, { 0, 1028, 0 } },
+    { 0x10004, { 0, 1029, 0 } },
+    { 0x10004, { 0, 1030, 0 } },
+    { 0x10004, { 0, 1031, 0 } },
+    { 0x10004, { 0, 1032, 0 } },
+    { 0x10004, { 0, 1033, 0 } },
+    { 0x10004, { 0, 1034, 0 } },
+    { 0x10004, { 0, 1035, 0 } },
+    { 0x10004, { 0, 1036, 0 } },
+    { 0x10004, { 0, 1037, 0 } },
+    { 0x10004, { 0, 1038, 0 } },
+    { 0x10004, { 0, 1039, 0 } },
+    { 0x10004, { 0, 1040, 0 } },
+    { 0x10004, { 0, 1041, 0 } },
+    { 0x10004, { 0, 1042, 0 } },
+    { 0x10004, { 0, 1043, 0 } },
+    { 0x10004, { 0, 1044, 0 } },
+    { 0x10004, { 0, 1045, 0 } },
+    { 0x10004, { 0, 1046, 0 } },
+    { 0x10004, { 0, 1047, 0 } },
+    { 0x10004, { 0, 1048, 0 } },
+    { 0x10004, { 0, 1049, 0 } },
+    { 0x10004, { 0, 1050, 0 } },
+    { 0x10004, { 0, 1051, 0 } },
+    { 0x10004, { 0, 1052, 0 } },
+    { 0x10004, { 0, 1053, 0 } },
+    { 0x10004, { 0, 1054, 0 } },
+    { 0x10004, { 0, 1055, 0 } },
+    { 0x10004, { 0, 1056, 0 } },
+    { 0x10004, { 0, 1057, 0 } },
+    { 0x10004, { 0, 1058, 0 } },
+    { 0x10004, { 0, 1059, 0 } },
+    { 0x10004, { 0, 1060, 0 } },
+    { 0x10004, { 0, 1061, 0 } },
+    { 0x10004, { 0, 1062, 0 } },
+    { 0x10004, { 0, 1063, 0 } },
+    { 0x10004, { 0, 1064, 0 } },
+    { 0x10004, { 0, 1065, 0 } },
+    { 0x10004, { 0, 1066, 0 } },
+    { 0x10004, { 0, 1067, 0 } },
+    { 0x10004, { 0, 1068, 0 } },
+    { 0x10004, { 0, 1069, 0 } },
+    { 0x10004, { 0, 1070, 0 } },
+    { 0x10004, { 0, 1071, 0 } },
+    { 0x10004, { 0, 1072, 0 } },
+    { 0x10004, { 0, 1073, 0 } },
+    { 0x10004, { 0, 1074, 0 } },
+    { 0x10004, { 0, 1075, 0 } },
+    { 0x10004, { 0, 1076, 0 } },
+    { 0x10004, { 0, 1077, 0 } },
+    { 0x10004, { 0, 1078, 0 } },
+    { 0x10004, { 0, 1079, 0 } },
+    { 0x10004, { 0, 1080, 0 } },
+    { 0x10004, { 0, 1081, 0 } },
+    { 0x10004, { 0, 1082, 0 } },
+    { 0x10004, { 0, 1083, 0 } },
+    { 0x10004, { 0, 1084, 0 } },
+    { 0x10004, { 0, 1085, 0 } },
+    { 0x10004, { 0, 1086, 0 } },
+    { 0x10004, { 0, 1087, 0 } },
+    { 0x10004, { 0, 1088, 0 } },
+    { 0x10004, { 0, 1089, 0 } },
+    { 0x10004, { 0, 1090, 0 } },
+    { 0x10004, { 0, 1091, 0 } },
+    { 0x10004, { 0, 1092, 0 } },
+    { 0x10004, { 0, 1093, 0 } },
+    { 0x10004, { 0, 1094, 0 } },
+    { 0x10004, { 0, 1095, 0 } },
+    { 0x10004, { 0, 1096, 0 } },
+    { 0x10004, { 0, 1097, 0 } },
+    { 0x10004, { 0, 1098, 0 } },
+    { 0x10004, { 0, 1099, 0 } },
+    { 0x10004, { 0, 1100, 0 } },
+    { 0x10004, { 0, 1101, 0 } },
+    { 0x10004, { 0, 1102, 0 } },
+    { 0x10004, { 0, 1103, 0 } },
+    { 0x10004, { 0, 1104, 0 } },
+    { 0x10004, { 0, 1105, 0 } },
+    { 0x10004, { 0, 1106, 0 } },
+    { 0x10004, { 0, 1107, 0 } },
+    { 0x10004, { 0, 1108, 0 } },
+    { 0x10004, { 0, 1109, 0 } },
+    { 0x10004, { 0, 1110, 0 } },
+    { 0x10004, { 0, 1111, 0 } },
+    { 0x10004, { 0, 1112, 0 } },
+    { 0x10004, { 0, 1113, 0 } },
+    { 0x10004, { 0, 1114, 0 } },
+    { 0x10004, { 0, 1115, 0 } },
+    { 0x10004, { 0, 1116, 0 } },
+    { 0x10004, { 0, 1117, 0 } },
+    { 0x10004, { 0, 1118, 0 } },
+    { 0x10004, { 0, 1119, 0 } },
+    { 0x10004, { 0, 1120, 0 } },
+    { 0x10004, { 0, 1121, 0 } },
+    { 0x10004, { 0, 1122, 0 } },
+    { 0x10004, { 0, 1123, 0 } },
+    { 0x10004, { 0, 1124, 0 } },
+    { 0x10004, { 0, 1125, 0 } },
+    { 0x10004, { 0, 1126, 0 } },
+    { 0x10004, { 0, 1127, 0 } },
+    { 0x10004, { 0, 1128, 0 } },
+    { 0x10004, { 0, 1129, 0 } },
+    { 0x10004, { 0, 1130, 0 } },
+    { 0x10004, { 0, 1131, 0 } },
+    { 0x10004, { 0, 1132, 0 } },
+    { 0x10004, { 0, 1133, 0 } },
+    { 0x10004, { 0, 1134, 0 } },
+    { 0x10004, { 0, 1135, 0 } },
+    { 0x10004, { 0, 1136, 0 } },
+    { 0x10004, { 0, 1137, 0 } },
+    { 0x10004, { 0, 1138, 0 } },
+    { 0x10004, { 0, 1139, 0 } },
+    { 0x10004, { 0, 1140, 0 } },
+    { 0x10004, { 0, 1141, 0 } },
+    { 0x10004, { 0, 1142, 0 } },
+    { 0x10004, { 0, 1143, 0 } },
+    { 0x10004, { 0, 1144, 0 } },
+    { 0x10004, { 0, 1145, 0 } },
+    { 0x10004, { 0, 1146, 0 } },
+    { 0x10004, { 0, 1147, 0 } },
+    { 0x10004, { 0, 1148, 0 } },
+    { 0x10004, { 0, 1149, 0 } },
+    { 0x10004, { 0, 1150, 0 } },
+    { 0x10004, { 0, 1151, 0 } },
+    { 0x10004, { 0, 1152, 0 } },
+    { 0x10004, { 0, 1153, 0 } },
+    { 0x10004, { 0, 1154, 0 } },
+    { 0x10004, { 0, 1155, 0 } },
+    { 0x10004, { 0, 1156, 0 } },
+    { 0x10004, { 0, 1157, 0 } },
+    { 0x10004, { 0, 1158, 0 } },
+    { 0x10004, { 0, 1159, 0 } },
+    { 0x10004, { 0, 1160, 0 } },
+    { 0x10004, { 0, 1161, 0 } },
+    { 0x10004, { 0, 1162, 0 } },
+    { 0x10004, { 0, 1163, 0 } },
+    { 0x10004, { 0, 1164, 0 } },
+    { 0x10004, { 0, 1165, 0 } },
+    { 0x10004, { 0, 1166, 0 } },
+    { 0x10004, { 0, 1167, 0 } },
+    { 0x10004, { 0, 1168, 0 } },
+    { 0x10004, { 0, 1169, 0 } },
+    { 0x10004, { 0, 1170, 0 } },
+    { 0x10004, { 0, 1171, 0 } },
+    { 0x10004, { 0, 1172, 0 } },
+    { 0x10004, { 0, 1173, 0 } },
+    { 0x10004, { 0, 1174, 0 } },
+    { 0x10004, { 0, 1175, 0 } },
+    { 0x10004, { 0, 1176, 0 } },
+    { 0x10004, { 0, 1177, 0 } },
+    { 0x10004, { 0, 1178, 0 } },
+    { 0x10004, { 0, 1179, 0 } },
+    { 0x10004, { 0, 1180, 0 } },
+    { 0x10004, { 0, 1181, 0 } },
+    { 0x10004, { 0, 1182, 0 } },
+    { 0x10004, { 0, 1183, 0 } },
+    { 0x10004, { 0, 1184, 0 } },
+    { 0x10004, { 0, 1185, 0 } },
+    { 0x10004, { 0, 1186, 0 } },
+    { 0x10004, { 0, 1187, 0 } },
+    { 0x10004, { 0, 1188, 0 } },
+    { 0x10004, { 0, 1189, 0 } },
+    { 0x10004, { 0, 1190, 0 } },
+    { 0x10004, { 0, 1191, 0 } },
+    { 0x10004, { 0, 1192, 0 } },
+    { 0x10004, { 0, 1193, 0 } },
+    { 0x10004, { 0, 1194, 0 } },
+    { 0x10004, { 0, 1195, 0 } },
+    { 0x10004, { 0, 1196, 0 } },
+    { 0x10004, { 0, 1197, 0 } },
+    { 0x10004, { 0, 1198, 0 } },
+    { 0x10004, { 0, 1199, 0 } },
+    { 0x10004, { 0, 1200, 0 } },
+    { 0x10004, { 0, 1201, 0 } },
+    { 0x10004, { 0, 1202, 0 } },
+    { 0x10004, { 0, 1203, 0 } },
+    { 0x10004, { 0, 1204, 0 } },
+    { 0x10004, { 0, 1205, 0 } },
+    { 0x10004, { 0, 1206, 0 } },
+    { 0x10004, { 0, 1207, 0 } },
+    { 0x10004, { 0, 1208, 0 } },
+    { 0x10004, { 0, 1209, 0 } },
+    { 0x10004, { 0, 1210, 0 } },
+    { 0x10004, { 0, 1211, 0 } },
+    { 0x10004, { 0, 1212, 0 } },
+    { 0x10004, { 0, 1213, 0 } },
+    { 0x10004, { 0, 1214, 0 } },
+    { 0x10004, { 0, 1215, 0 } },
+    { 0x10004, { 0, 1216, 0 } },
+    { 0x10004, { 0, 1217, 0 } },
+    { 0x10004, { 0, 1218, 0 } },
+    { 0x10004, { 0, 1219, 0 } },
+    { 0x10004, { 0, 1220, 0 } },
+    { 0x10004, { 0, 1221, 0 } },
+    { 0x10004, { 0, 1222, 0 } },
+    { 0x10004, { 0, 1223, 0 } },
+    { 0x10004, { 0, 1224, 0 } },
+    { 0x10004, { 0, 1225, 0 } },
+    { 0x10004, { 0, 1226, 0 } },
+    { 0x10004, { 0, 1227, 0 } },
+    { 0x10004, { 0, 1228, 0 } },
+    { 0x10004, { 0, 1229, 0 } },
+    { 0x10004, { 0, 1230, 0 } },
+    { 0x10004, { 0, 1231, 0 } },
+    { 0x10004, { 0, 1232, 0 } },
+    { 0x10004, { 0, 1233, 0 } },
+    { 0x10004, { 0, 1234, 0 } },
+    { 0x10004, { 0, 1235, 0 } },
+    { 0x10004, { 0, 1236, 0 } },
+    { 0x10004, { 0, 1237, 0 } },
+    { 0x10004, { 0, 1238, 0 } },
+    { 0x10004, { 0, 1239, 0 } },
+    { 0x10004, { 0, 1240, 0 } },
+    { 0x10004, { 0, 1241, 0 } },
+    { 0x10004, { 0, 1242, 0 } },
+    { 0x10004, { 0, 1243, 0 } },
+    { 0x10004, { 0, 1244, 0 } },
+    { 0x10004, { 0, 1245, 0 } },
+    { 0x10004, { 0, 1246, 0 } },
+    { 0x10004, { 0, 1247, 0 } },
+    { 0x10004, { 0, 1248, 0 } },
+    { 0x10004, { 0, 1249, 0 } },
+    { 0x10004, { 0, 1250, 0 } },
+    { 0x10004, { 0, 1251, 0 } },
+    { 0x10004, { 0, 1252, 0 } },
+    { 0x10004, { 0, 1253, 0 } },
+    { 0x10004, { 0, 1254, 0 } },
+    { 0x10004, { 0, 1255, 0 } },
+    { 0x10004, { 0, 1256, 0 } },
+    { 0x10004, { 0, 1257, 0 } },
+    { 0x10004, { 0, 1258, 0 } },
+    { 0x10004, { 0, 1259, 0 } },
+    { 0x10004, { 0, 1260, 0 } },
+    { 0x10004, { 0, 1261, 0 } },
+    { 0x10004, { 0, 1262, 0 } },
+    { 0x10004, { 0, 1263, 0 } },
+    { 0x10004, { 0, 1264, 0 } },
+    { 0x10004, { 0, 1265, 0 } },
+    { 0x10004, { 0, 1266, 0 } },
+    { 0x10004, { 0, 1267, 0 } },
+    { 0x10004, { 0, 1268, 0 } },
+    { 0x10004, { 0, 1269, 0 } },
+    { 0x10004, { 0, 1270, 0 } },
+    { 0x10004, { 0, 1271, 0 } },
+    { 0x10004, { 0, 1272, 0 } },
+    { 0x10004, { 0, 1273, 0 } },
+    { 0x10004, { 0, 1274, 0 } },
+    { 0x10004, { 0, 1275, 0 } },
+    { 0x10004, { 0, 1276, 0 } },
+    { 0x10004, { 0, 1277, 0 } },
+    { 0x10004, { 0, 1278, 0 } },
+    { 0x10004, { 0, 1279, 0 } },
+    { 0x10004, { 0, 1280, 0 } },
+    { 0x10004, { 0, 1281, 0 } },
+    { 0x10004, { 0, 1282, 0 } },
+    { 0x10004, { 0, 1283, 0 } },
+    { 0x10004, { 0, 1284, 0 } },
+    { 0x10004, { 0, 1285, 0 } },
+    { 0x10004, { 0, 1286, 0 } },
+    { 0x10004, { 0, 1287, 0 } },
+    { 0x10004, { 0, 1288, 0 } },
+    { 0x10004, { 0, 1289, 0 } },
+    { 0x10004, { 0, 1290, 0 } },
+    { 0x10004, { 0, 1291, 0 } },
+    { 0x10004, { 0, 1292, 0 } },
+    { 0x10004, { 0, 1293, 0 } },
+    { 0x10004, { 0, 1294, 0 } },
+    { 0x10004, { 0, 1295, 0 } },
+    { 0x10004, { 0, 1296, 0 } },
+    { 0x10004, { 0, 1297, 0 } },
+    { 0x10004, { 0, 1298, 0 } },
+    { 0x10004, { 0, 1299, 0 } },
+    { 0x10004, { 0, 1300, 0 } },
+    { 0x10004, { 0, 1301, 0 } },
+    { 0x10004, { 0, 1302, 0 } },
+    { 0x10004, { 0, 1303, 0 } },
+    { 0x10004, { 0, 1304, 0 } },
+    { 0x10004, { 0, 1305, 0 } },
+    { 0x10004, { 0, 1306, 0 } },
+    { 0x10004, { 0, 1307, 0 } },
+    { 0x10004, { 0, 1308, 0 } },
+    { 0x10004, { 0, 1309, 0 } },
+    { 0x10004, { 0, 1310, 0 } },
+    { 0x10004, { 0, 1311, 0 } },
+    { 0x10004, { 0, 1312, 0 } },
+    { 0x10004, { 0, 1313, 0 } },
+    { 0x10004, { 0, 1314, 0 } },
+    { 0x10004, { 0, 1315, 0 } },
+    { 0x10004, { 0, 1316, 0 } },
+    { 0x10004, { 0, 1317, 0 } },
+    { 0x10004, { 0, 1318, 0 } },
+    { 0x10004, { 0, 1319, 0 } },
+    { 0x10004, { 0, 1320, 0 } },
+    { 0x10004, { 0, 1321, 0 } },
+    { 0x10004, { 0, 1322, 0 } },
+    { 0x10004, { 0, 1323, 0 } },
+    { 0x10004, { 0, 1324, 0 } },
+    { 0x10004, { 0, 1325, 0 } },
+    { 0x10004, { 0, 1326, 0 } },
+    { 0x10004, { 0, 1327, 0 } },
+    { 0x10004, { 0, 1328, 0 } },
+    { 0x10004, { 0, 1329, 0 } },
+    { 0x10004, { 0, 1330, 0 } },
+    { 0x10004, { 0, 1331, 0 } },
+    { 0x10004, { 0, 1332, 0 } },
+    { 0x10004, { 0, 1333, 0 } },
+    { 0x10004, { 0, 1334, 0 } },
+    { 0x10004, { 0, 1335, 0 } },
+    { 0x10004, { 0, 1336, 0 } },
+    { 0x10004, { 0, 1337, 0 } },
+    { 0x10004, { 0, 1338, 0 } },
+    { 0x10004, { 0, 1339, 0 } },
+    { 0x10004, { 0, 1340, 0 } },
+    { 0x10004, { 0, 1341, 0 } },
+    { 0x10004, { 0, 1342, 0 } },
+    { 0x10004, { 0, 1343, 0 } },
+    { 0x10004, { 0, 1344, 0 } },
+    { 0x10004, { 0, 1345, 0 } },
+    { 0x10004, { 0, 1346, 0 } },
+    { 0x10004, { 0, 1347, 0 } },
+    { 0x10004, { 0, 1348, 0 } },
+    { 0x10004, { 0, 1349, 0 } },
+    { 0x10004, { 0, 1350, 0 } },
+    { 0x10004, { 0, 1351, 0 } },
+    { 0x10004, { 0, 1352, 0 } },
+    { 0x10004, { 0, 1353, 0 } },
+    { 0x10004, { 0, 1354, 0 } },
+    { 0x10004, { 0, 1355, 0 } },
+    { 0x10004, { 0, 1356, 0 } },
+    { 0x10004, { 0, 1357, 0 } },
+    { 0x10004, { 0, 1358, 0 } },
+    { 0x10004, { 0, 1359, 0 } },
+    { 0x10004, { 0, 1360, 0 } },
+    { 0x10004, { 0, 1361, 0 } },
+    { 0x10004, { 0, 1362, 0 } },
+    { 0x10004, { 0, 1363, 0 } },
+    { 0x10004, { 0, 1364, 0 } },
+    { 0x10004, { 0, 1365, 0 } },
+    { 0x10004, { 0, 1366, 0 } },
+    { 0x10004, { 0, 1367, 0 } },
+    { 0x10004, { 0, 1368, 0 } },
+    { 0x10004, { 0, 1369, 0 } },
+    { 0x10004, { 0, 1370, 0 } },
+    { 0x04000, { 0, 0, 0 } },
+};
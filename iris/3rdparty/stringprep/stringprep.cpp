@@ -34,6 +34,7 @@
 #include <stdlib.h>
 
 #include "qstringprep.h"
+#include "rfc3454.h"
 
 static int _compare_table_element(const uint32_t *c, const Stringprep_table_element *e)
 {
@@ -44,16 +45,38 @@ static int _compare_table_element(const uint32_t *c, const Stringprep_table_elem
     return 0;
 }
 
-static std::ptrdiff_t stringprep_find_character_in_table(uint32_t ucs4, const Stringprep_table_element *table,
-                                                         size_t table_size)
+/* A table of a profile step along with its position in the precomputed rfc3454 lookup
+   (see gen-stringprep-tables.pl). Profile specific tables are not there and are searched. */
+struct Stringprep_table_ref {
+    explicit Stringprep_table_ref(const Stringprep_table &step) : table(step.table), table_size(step.table_size)
+    {
+        for (int i = 0; i < N_STRINGPREP_rfc3454_TABLES; i++) {
+            if (stringprep_rfc3454_tables[i] == table) {
+                lookup   = i;
+                map_slot = stringprep_rfc3454_map_slot[i];
+                break;
+            }
+        }
+    }
+
+    const Stringprep_table_element *table;
+    size_t                          table_size;
+    int                             lookup   = -1;
+    int                             map_slot = -1;
+};
+
+static inline const Stringprep_rfc3454_props &stringprep_rfc3454_lookup(uint32_t ucs4)
+{
+    const uint32_t mask  = (1u << STRINGPREP_rfc3454_LOOKUP_SHIFT) - 1;
+    uint32_t       block = stringprep_rfc3454_pages[ucs4 >> STRINGPREP_rfc3454_LOOKUP_SHIFT];
+    uint16_t       prop  = stringprep_rfc3454_blocks[(block << STRINGPREP_rfc3454_LOOKUP_SHIFT) | (ucs4 & mask)];
+    return stringprep_rfc3454_props[prop];
+}
+
+static std::ptrdiff_t stringprep_find_character_in_table(uint32_t ucs4, const Stringprep_table_ref &ref)
 {
     /* This is where typical uses of Libidn spends very close to all CPU
-       time and causes most cache misses.  One could easily do a binary
-       search instead.  Before rewriting this, I want hard evidence this
-       slowness is at all relevant in typical applications.  (I don't
-       dispute optimization may improve matters significantly, I'm
-       mostly interested in having someone give real-world benchmark on
-       the impact of libidn.)
+       time and causes most cache misses.
      *
      * Answer (Tim Rühsen rockdaboot@gmx.de):
      * Testing the fuzz corpora just once via make check takes ~54 billion CPU cycles.
@@ -63,31 +86,35 @@ static std::ptrdiff_t stringprep_find_character_in_table(uint32_t ucs4, const St
      * The bsearch() approach takes ~3 billion CPU cycles.
      * Almost a factor of 20 faster (but still pretty slow).
      * There are still ~2 million calls to bsearch() which make ~30% of CPU time used.
-     * Most time is spent in _g_utf8_normalize_wc().
-
-    std::ptrdiff_t i;
-
-    for (i = 0; table[i].start || table[i].end; i++)
-      if (ucs4 >= table[i].start &&
-          ucs4 <= (table[i].end ? table[i].end : table[i].start))
-        return i;
-    */
+     *
+     * So rfc3454 tables are checked with the precomputed lookup instead, which is
+     * two array reads per code point for all the tables at once. Positions are
+     * precomputed for mapping tables only, bsearch() is left for the rare hits
+     * in other tables and for profile specific tables.
+     */
+    if (ref.lookup != -1 && ucs4 <= STRINGPREP_rfc3454_LOOKUP_MAX) {
+        const Stringprep_rfc3454_props &props = stringprep_rfc3454_lookup(ucs4);
+        if (!(props.tables & (1u << ref.lookup)))
+            return -1;
+        if (ref.map_slot != -1)
+            return props.map[ref.map_slot];
+    }
 
     const Stringprep_table_element *p = static_cast<const Stringprep_table_element *>(
-        bsearch(&ucs4, table, table_size, sizeof(Stringprep_table_element),
+        bsearch(&ucs4, ref.table, ref.table_size, sizeof(Stringprep_table_element),
                 (int (*)(const void *, const void *))_compare_table_element));
 
-    return p ? (p - table) : -1;
+    return p ? (p - ref.table) : -1;
 }
 
 static std::ptrdiff_t stringprep_find_string_in_table(uint *ucs4, size_t len, size_t *tablepos,
-                                                      const Stringprep_table_element *table, size_t table_size)
+                                                      const Stringprep_table_ref &ref)
 {
     size_t         j;
     std::ptrdiff_t pos;
 
     for (j = 0; j < len; j++)
-        if ((pos = stringprep_find_character_in_table(ucs4[j], table, table_size)) != -1) {
+        if ((pos = stringprep_find_character_in_table(ucs4[j], ref)) != -1) {
             if (tablepos)
                 *tablepos = pos;
             return j;
@@ -96,20 +123,22 @@ static std::ptrdiff_t stringprep_find_string_in_table(uint *ucs4, size_t len, si
     return -1;
 }
 
-static int stringprep_apply_table_to_string(QVector<uint> &ucs4, const Stringprep_table_element *table,
-                                            size_t table_size)
+static int stringprep_apply_table_to_string(QVector<uint> &ucs4, const Stringprep_table_ref &ref)
 {
-    std::ptrdiff_t pos;
-    size_t         i, maplen;
-    uint32_t      *src    = ucs4.data(); /* points to unprocessed data */
-    size_t         srclen = ucs4.size(); /* length of unprocessed data */
+    std::ptrdiff_t                  pos;
+    size_t                          i, maplen;
+    const Stringprep_table_element *table  = ref.table;
+    uint32_t                       *src    = ucs4.data(); /* points to unprocessed data */
+    size_t                          srclen = ucs4.size(); /* length of unprocessed data */
 
-    while ((pos = stringprep_find_string_in_table(src, srclen, &i, table, table_size)) != -1) {
+    while ((pos = stringprep_find_string_in_table(src, srclen, &i, ref)) != -1) {
         for (maplen = STRINGPREP_MAX_MAP_CHARS; maplen > 0 && table[i].map[maplen - 1] == 0; maplen--)
             ;
 
         if (maplen > 1) {
+            std::ptrdiff_t offset = src - ucs4.data();
             ucs4.resize(ucs4.size() + int(maplen) - 1);
+            src = ucs4.data() + offset;
         }
 
         memmove(src + pos + maplen, src + pos + 1, sizeof(uint32_t) * (srclen - pos - 1));
@@ -184,8 +213,8 @@ int stringprep_4i(QString &input, Stringprep_profile_flags flags, const Stringpr
             break;
 
         case STRINGPREP_PROHIBIT_TABLE:
-            k = stringprep_find_string_in_table(ucs4vector.data(), ucs4vector.length(), NULL, profile[i].table,
-                                                profile[i].table_size);
+            k = stringprep_find_string_in_table(ucs4vector.data(), ucs4vector.length(), NULL,
+                                                Stringprep_table_ref(profile[i]));
             if (k != -1)
                 return STRINGPREP_CONTAINS_PROHIBITED;
             break;
@@ -194,8 +223,8 @@ int stringprep_4i(QString &input, Stringprep_profile_flags flags, const Stringpr
             if (UNAPPLICAPLEFLAGS(flags, profile[i].flags))
                 break;
             if (flags & STRINGPREP_NO_UNASSIGNED) {
-                k = stringprep_find_string_in_table(ucs4vector.data(), ucs4vector.length(), NULL, profile[i].table,
-                                                    profile[i].table_size);
+                k = stringprep_find_string_in_table(ucs4vector.data(), ucs4vector.length(), NULL,
+                                                    Stringprep_table_ref(profile[i]));
                 if (k != -1)
                     return STRINGPREP_CONTAINS_UNASSIGNED;
             }
@@ -204,7 +233,7 @@ int stringprep_4i(QString &input, Stringprep_profile_flags flags, const Stringpr
         case STRINGPREP_MAP_TABLE:
             if (UNAPPLICAPLEFLAGS(flags, profile[i].flags))
                 break;
-            rc = stringprep_apply_table_to_string(ucs4vector, profile[i].table, profile[i].table_size);
+            rc = stringprep_apply_table_to_string(ucs4vector, Stringprep_table_ref(profile[i]));
             if (rc != STRINGPREP_OK)
                 return rc;
             break;
@@ -224,20 +253,20 @@ int stringprep_4i(QString &input, Stringprep_profile_flags flags, const Stringpr
             for (j = 0; profile[j].operation; j++)
                 if (profile[j].operation == STRINGPREP_BIDI_PROHIBIT_TABLE) {
                     done_prohibited = 1;
-                    k = stringprep_find_string_in_table(ucs4vector.data(), ucs4vector.length(), NULL, profile[j].table,
-                                                        profile[j].table_size);
+                    k = stringprep_find_string_in_table(ucs4vector.data(), ucs4vector.length(), NULL,
+                                                        Stringprep_table_ref(profile[j]));
                     if (k != -1)
                         return STRINGPREP_BIDI_CONTAINS_PROHIBITED;
                 } else if (profile[j].operation == STRINGPREP_BIDI_RAL_TABLE) {
                     done_ral = 1;
-                    if (stringprep_find_string_in_table(ucs4vector.data(), ucs4vector.length(), NULL, profile[j].table,
-                                                        profile[j].table_size)
+                    if (stringprep_find_string_in_table(ucs4vector.data(), ucs4vector.length(), NULL,
+                                                        Stringprep_table_ref(profile[j]))
                         != -1)
                         contains_ral = j;
                 } else if (profile[j].operation == STRINGPREP_BIDI_L_TABLE) {
                     done_l = 1;
-                    if (stringprep_find_string_in_table(ucs4vector.data(), ucs4vector.length(), NULL, profile[j].table,
-                                                        profile[j].table_size)
+                    if (stringprep_find_string_in_table(ucs4vector.data(), ucs4vector.length(), NULL,
+                                                        Stringprep_table_ref(profile[j]))
                         != -1)
                         contains_l = j;
                 }
@@ -249,12 +278,9 @@ int stringprep_4i(QString &input, Stringprep_profile_flags flags, const Stringpr
                 return STRINGPREP_BIDI_BOTH_L_AND_RAL;
 
             if (contains_ral != SIZE_MAX) {
-                if (!(stringprep_find_character_in_table(ucs4vector.first(), profile[contains_ral].table,
-                                                         profile[contains_ral].table_size)
-                          != -1
-                      && stringprep_find_character_in_table(ucs4vector.last(), profile[contains_ral].table,
-                                                            profile[contains_ral].table_size)
-                          != -1))
+                Stringprep_table_ref ral(profile[contains_ral]);
+                if (!(stringprep_find_character_in_table(ucs4vector.first(), ral) != -1
+                      && stringprep_find_character_in_table(ucs4vector.last(), ral) != -1))
                     return STRINGPREP_BIDI_LEADTRAIL_NOT_RAL;
             }
         } break;
@@ -0,0 +1 @@
+#include <iris/irisnet/noncore/cutestuff/segmentedbuffer.h>
@@ -0,0 +1 @@
+#include <iris/xmpp-im/xmpp_hashpool.h>
@@ -0,0 +1 @@
+#include <iris/xmpp-core/xmpp_trafficstats.h>
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "namecache_p.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <algorithm>
+
+namespace XMPP {
+
+const NameCache::Entry *NameCache::lookup(const Key &key, qint64 now)
+{
+    auto it = entries_.find(key);
+    if (it == entries_.end() || it->expires <= now) {
+        ++misses_;
+        return nullptr;
+    }
+    it->used = now;
+    ++it->hits;
+    ++hits_;
+    return &*it;
+}
+
+QList<NameRecord> NameCache::records(const Entry &entry, qint64 now)
+{
+    const int         left = int((entry.expires - now) / 1000);
+    QList<NameRecord> records;
+    for (NameRecord r : entry.records) {
+        r.setTtl(left);
+        records += r;
+    }
+    return records;
+}
+
+void NameCache::storeAnswer(const Key &key, const QList<NameRecord> &records, qint64 now)
+{
+    int ttl = records.isEmpty() ? NAMECACHE_NEGATIVETTL : NAMECACHE_MAXTTL;
+    for (const NameRecord &r : records)
+        ttl = qMin(ttl, r.ttl());
+    if (ttl <= 0)
+        return;
+
+    Entry e;
+    e.records = records;
+    e.expires = now + qint64(ttl) * 1000;
+    insert(key, e, now);
+}
+
+void NameCache::storeNoName(const Key &key, qint64 now)
+{
+    Entry e;
+    e.noName  = true;
+    e.expires = now + NAMECACHE_NEGATIVETTL * 1000;
+    insert(key, e, now);
+}
+
+// when full, expired entries go first and then the least recently used one
+void NameCache::insert(const Key &key, const Entry &entry, qint64 now)
+{
+    if (entries_.size() >= NAMECACHE_MAXENTRIES && !entries_.contains(key)) {
+        for (auto it = entries_.begin(); it != entries_.end();)
+            it = it->expires <= now ? entries_.erase(it) : std::next(it);
+        if (entries_.size() >= NAMECACHE_MAXENTRIES)
+            entries_.erase(std::min_element(entries_.begin(), entries_.end(),
+                                            [](const Entry &a, const Entry &b) { return a.used < b.used; }));
+    }
+    auto &e = entries_[key];
+    e       = entry;
+    e.used  = now;
+}
+
+QByteArray NameCache::save(qint64 now) const
+{
+    QJsonArray entries;
+    for (auto it = entries_.cbegin(); it != entries_.cend(); ++it) {
+        if (it->expires <= now)
+            continue;
+        QJsonArray records;
+        for (const NameRecord &r : it->records) {
+            QJsonObject o { { QStringLiteral("type"), int(r.type()) }, { QStringLiteral("owner"), r.owner() } };
+            switch (r.type()) {
+            case NameRecord::A:
+            case NameRecord::Aaaa:
+                o.insert(QStringLiteral("address"), r.address().toString());
+                break;
+            case NameRecord::Srv:
+                o.insert(QStringLiteral("port"), r.port());
+                o.insert(QStringLiteral("priority"), r.priority());
+                o.insert(QStringLiteral("weight"), r.weight());
+                Q_FALLTHROUGH();
+            case NameRecord::Cname:
+                o.insert(QStringLiteral("name"), QString::fromLatin1(r.name()));
+                break;
+            default:
+                o = QJsonObject(); // not needed to connect anywhere. don't bother
+            }
+            if (o.isEmpty())
+                break;
+            records.append(o);
+        }
+        if (records.size() != it->records.size())
+            continue;
+        QJsonObject e { { QStringLiteral("name"), QString::fromLatin1(it.key().first) },
+                        { QStringLiteral("qtype"), it.key().second },
+                        { QStringLiteral("expires"), it->expires },
+                        { QStringLiteral("records"), records } };
+        if (it->noName)
+            e.insert(QStringLiteral("noname"), true);
+        entries.append(e);
+    }
+    return QJsonDocument(entries).toJson(QJsonDocument::Compact);
+}
+
+void NameCache::load(const QByteArray &data, qint64 now)
+{
+    for (const auto &v : QJsonDocument::fromJson(data).array()) {
+        const QJsonObject o       = v.toObject();
+        const qint64      expires = qint64(o.value(QStringLiteral("expires")).toDouble());
+        const QByteArray  name    = o.value(QStringLiteral("name")).toString().toLatin1();
+        if (expires <= now || name.isEmpty())
+            continue;
+        Entry e;
+        e.expires = expires;
+        e.noName  = o.value(QStringLiteral("noname")).toBool();
+        for (const auto &rv : o.value(QStringLiteral("records")).toArray()) {
+            const QJsonObject ro = rv.toObject();
+            NameRecord        r(ro.value(QStringLiteral("owner")).toString(), 0);
+            const QByteArray  target = ro.value(QStringLiteral("name")).toString().toLatin1();
+            switch (ro.value(QStringLiteral("type")).toInt(-1)) {
+            case NameRecord::A:
+            case NameRecord::Aaaa:
+                r.setAddress(QHostAddress(ro.value(QStringLiteral("address")).toString()));
+                break;
+            case NameRecord::Srv:
+                r.setSrv(target, ro.value(QStringLiteral("port")).toInt(), ro.value(QStringLiteral("priority")).toInt(),
+                         ro.value(QStringLiteral("weight")).toInt());
+                break;
+            case NameRecord::Cname:
+                r.setCname(target);
+                break;
+            default:
+                continue;
+            }
+            e.records += r;
+        }
+        insert({ name, o.value(QStringLiteral("qtype")).toInt() }, e, now);
+    }
+}
+
+} // namespace XMPP
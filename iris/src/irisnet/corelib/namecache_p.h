@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef NAMECACHE_P_H
+#define NAMECACHE_P_H
+
+#include "netnames.h"
+
+#include <QHash>
+
+#define NAMECACHE_MAXTTL 86400    // secs. longer ttls are clamped
+#define NAMECACHE_NEGATIVETTL 300 // secs. for empty answers (RFC 2308 suggests 1-3 hours)
+#define NAMECACHE_MAXENTRIES 1000
+
+namespace XMPP {
+/*
+ * Answers of the internet name provider, shared by all the resolvers of the process. See NameManager.
+ *
+ * An entry lives for the smallest ttl of its records. Empty answers are negative entries and live for
+ * NAMECACHE_NEGATIVETTL, both for names which don't exist (NXDOMAIN) and for names without records
+ * of the type (NODATA). The two are told apart, so a cached answer is replayed the way it came.
+ * All the times are msecs since epoch.
+ */
+class NameCache {
+public:
+    using Key = QPair<QByteArray, int>; // lowercase name, query type
+
+    struct Entry {
+        QList<NameRecord> records;         // empty for negative entries
+        bool              noName  = false; // NXDOMAIN. an empty answer otherwise
+        qint64            expires = 0;
+        qint64            used    = 0; // when it was stored or answered last. to evict by
+        int               hits    = 0;
+    };
+
+    static Key key(const QByteArray &name, int qType) { return { name.toLower(), qType }; }
+
+    // a valid entry or nullptr. counts hits and misses
+    const Entry *lookup(const Key &key, qint64 now);
+    // records of the entry with their ttls counted down
+    static QList<NameRecord> records(const Entry &entry, qint64 now);
+
+    void storeAnswer(const Key &key, const QList<NameRecord> &records, qint64 now);
+    void storeNoName(const Key &key, qint64 now);
+
+    QByteArray save(qint64 now) const;
+    void       load(const QByteArray &data, qint64 now);
+
+    const QHash<Key, Entry> &entries() const { return entries_; }
+    void                     clear() { entries_.clear(); }
+    quint64                  hits() const { return hits_; }
+    quint64                  misses() const { return misses_; }
+
+private:
+    void insert(const Key &key, const Entry &entry, qint64 now);
+
+    QHash<Key, Entry> entries_;
+    quint64           hits_   = 0;
+    quint64           misses_ = 0;
+};
+} // namespace XMPP
+
+#endif // NAMECACHE_P_H
@@ -21,8 +21,10 @@
 
 // #include "addressresolver.h"
 #include "corelib/irisnetglobal_p.h"
+#include "corelib/namecache_p.h"
 #include "irisnetplugin.h"
 
+#include <QDateTime>
 #if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
 #include <QRandomGenerator>
 #endif
@@ -668,6 +670,16 @@ public:
     QHash<int, ServiceResolver::Private *>       sres_instances;
     QHash<int, ServiceLocalPublisher::Private *> slp_instances;
 
+    /*
+     * Answers of the internet provider, shared by all the resolvers of the process, so reconnecting
+     * accounts (and S5B/STUN/TURN lookups) don't go to the network for what is still valid.
+     * Only one-shot lookups are cached. Cached answers get negative instance ids, provider ids
+     * are never negative.
+     */
+    NameCache                  cache;
+    QHash<int, NameCache::Key> res_uncached; // provider id -> lookup to cache the answer of
+    int                        cache_next_id = -1;
+
     NameManager(QObject *parent = nullptr) : QObject(parent)
     {
         p_net   = nullptr;
@@ -704,6 +716,23 @@ public:
 
         np->type      = qType;
         np->longLived = longLived;
+
+        const auto key = NameCache::key(name, qType);
+        if (!longLived) {
+            const qint64 now = QDateTime::currentMSecsSinceEpoch();
+            if (auto e = cache.lookup(key, now)) {
+                np->id = cache_next_id--;
+                res_instances.insert(np->id, np);
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, id = np->id, records = NameCache::records(*e, now), noName = e->noName]() {
+                        resolve_cached(id, records, noName);
+                    },
+                    Qt::QueuedConnection);
+                return;
+            }
+        }
+
         if (!p_net) {
             NameProvider            *c    = 0;
             QList<IrisNetProvider *> list = irisNetProviders();
@@ -723,6 +752,7 @@ public:
                     [this](int id, const QList<XMPP::NameRecord> &results) {
                         NameResolver::Private *np = res_instances.value(id);
                         NameResolver          *q  = np->q; // resolve_cleanup deletes np
+                        cache_store(id, results);
                         if (!np->longLived)
                             resolve_cleanup(np);
                         emit q->resultsReady(results);
@@ -736,12 +766,15 @@ public:
 
         // printf("assigning %d to %p\n", req_id, np);
         res_instances.insert(np->id, np);
+        if (!longLived)
+            res_uncached.insert(np->id, key);
     }
 
     void resolve_stop(NameResolver::Private *np)
     {
         // FIXME: stop sub instances?
-        p_net->resolve_stop(np->id);
+        if (np->id >= 0) // not answered from the cache
+            p_net->resolve_stop(np->id);
         resolve_cleanup(np);
     }
 
@@ -764,6 +797,7 @@ public:
 
         // clean up primary instance
 
+        res_uncached.remove(np->id);
         res_instances.remove(np->id);
         NameResolver *q = np->q;
         delete q->d;
@@ -876,12 +910,73 @@ public:
         np->id = p_serv->publish_extra_start(np->id, rec);
     }
 
+    void resolve_cached(int id, const QList<NameRecord> &records, bool noName)
+    {
+        NameResolver::Private *np = res_instances.value(id);
+        if (!np) // stopped meanwhile
+            return;
+        NameResolver *q = np->q; // resolve_cleanup deletes np
+        resolve_cleanup(np);
+        if (noName)
+            emit q->error(NameResolver::ErrorNoName);
+        else
+            emit q->resultsReady(records);
+    }
+
+    void cache_store(int id, const QList<NameRecord> &records)
+    {
+        auto key = res_uncached.take(id);
+        if (!key.first.isEmpty())
+            cache.storeAnswer(key, records, QDateTime::currentMSecsSinceEpoch());
+    }
+
+    QString cacheText() const
+    {
+        const qint64 now     = QDateTime::currentMSecsSinceEpoch();
+        const auto   lookups = cache.hits() + cache.misses();
+        QString      text    = QString("%1 entries, %2 hits, %3 misses (%4% hit rate)\n\n")
+                               .arg(cache.entries().size())
+                               .arg(cache.hits())
+                               .arg(cache.misses())
+                               .arg(lookups ? cache.hits() * 100 / lookups : 0);
+        for (auto it = cache.entries().cbegin(); it != cache.entries().cend(); ++it) {
+            QStringList records;
+            for (const NameRecord &r : it->records) {
+                if (r.type() == NameRecord::A || r.type() == NameRecord::Aaaa)
+                    records += r.address().toString();
+                else if (r.type() == NameRecord::Srv)
+                    records += QString("%1:%2 (%3/%4)")
+                                   .arg(QString::fromLatin1(r.name()))
+                                   .arg(r.port())
+                                   .arg(r.priority())
+                                   .arg(r.weight());
+                else
+                    records += QString::fromLatin1(r.name());
+            }
+            if (records.isEmpty())
+                records += it->noName ? QStringLiteral("NXDOMAIN") : QStringLiteral("NODATA");
+            text += QString("%1 %2  %3  ttl %4s, %5 hits\n")
+                        .arg(QString::fromLatin1(it.key().first))
+                        .arg(qtypeName(it.key().second))
+                        .arg(records.join(", "))
+                        .arg(it->expires > now ? (it->expires - now) / 1000 : 0)
+                        .arg(it->hits);
+        }
+        return text;
+    }
+
+    static QString qtypeName(int qType);
+
 private slots:
 
     void provider_resolve_error(int id, XMPP::NameResolver::Error e)
     {
         NameResolver::Private *np = res_instances.value(id);
         NameResolver          *q  = np->q; // resolve_cleanup deletes np
+
+        auto key = res_uncached.take(id);
+        if (e == NameResolver::ErrorNoName && !key.first.isEmpty())
+            cache.storeNoName(key, QDateTime::currentMSecsSinceEpoch());
         resolve_cleanup(np);
         emit q->error(e);
     }
@@ -1028,6 +1123,21 @@ static int recordType2Rtype(NameRecord::Type type)
     return -1;
 }
 
+QString NameManager::qtypeName(int qType)
+{
+    switch (qType) {
+    case JDNS_RTYPE_A:
+        return QStringLiteral("A");
+    case JDNS_RTYPE_AAAA:
+        return QStringLiteral("AAAA");
+    case JDNS_RTYPE_SRV:
+        return QStringLiteral("SRV");
+    case JDNS_RTYPE_CNAME:
+        return QStringLiteral("CNAME");
+    }
+    return QString::number(qType);
+}
+
 NameResolver::NameResolver(QObject *parent) : QObject(parent) { d = nullptr; }
 
 NameResolver::~NameResolver() { stop(); }
@@ -1411,6 +1521,34 @@ QString NetNames::diagnosticText()
     return QString();
 }
 
+QString NetNames::cacheDiagnosticText()
+{
+    NameManager *man = NameManager::instance();
+    QMutexLocker locker(nman_mutex());
+    return man->cacheText();
+}
+
+QByteArray NetNames::saveCache()
+{
+    NameManager *man = NameManager::instance();
+    QMutexLocker locker(nman_mutex());
+    return man->cache.save(QDateTime::currentMSecsSinceEpoch());
+}
+
+void NetNames::loadCache(const QByteArray &data)
+{
+    NameManager *man = NameManager::instance();
+    QMutexLocker locker(nman_mutex());
+    man->cache.load(data, QDateTime::currentMSecsSinceEpoch());
+}
+
+void NetNames::clearCache()
+{
+    NameManager *man = NameManager::instance();
+    QMutexLocker locker(nman_mutex());
+    man->cache.clear();
+}
+
 QByteArray NetNames::idnaFromString(const QString &in)
 {
     // TODO
@@ -43,6 +43,14 @@ public:
     // return current diagnostic text, clear the buffer.
     static QString diagnosticText();
 
+    // cached dns answers with their ttls and the hit rate, for debugging
+    static QString cacheDiagnosticText();
+
+    // the dns cache is kept across restarts by the application. entries expired meanwhile are dropped
+    static QByteArray saveCache();
+    static void       loadCache(const QByteArray &data);
+    static void       clearCache(); // when the network changes
+
     // convert idn names
     static QByteArray idnaFromString(const QString &in);
     static QString    idnaToString(const QByteArray &in);
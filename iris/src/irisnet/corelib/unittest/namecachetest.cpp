@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "irisnet/corelib/namecache_p.h"
+#include "qttestutil/qttestutil.h"
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+using namespace XMPP;
+
+static const int    QTYPE_A   = 1; // as in jdns
+static const int    QTYPE_SRV = 33;
+static const qint64 NOW       = Q_INT64_C(1760000000000); // msecs since epoch
+
+static NameRecord address(const QString &owner, const QString &addr, int ttl)
+{
+    NameRecord r(owner, ttl);
+    r.setAddress(QHostAddress(addr));
+    return r;
+}
+
+static NameRecord srv(const QString &owner, const QByteArray &target, int port, int ttl)
+{
+    NameRecord r(owner, ttl);
+    r.setSrv(target, port, 5, 10);
+    return r;
+}
+
+class NameCacheTest : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testTtlClamp()
+    {
+        NameCache cache;
+        auto      key = NameCache::key("Example.ORG", QTYPE_A);
+        QCOMPARE(key.first, QByteArray("example.org"));
+
+        // the smallest ttl of the answer
+        cache.storeAnswer(key, { address("example.org", "192.0.2.1", 3600), address("example.org", "192.0.2.2", 10) },
+                          NOW);
+        QCOMPARE(cache.entries().value(key).expires, NOW + 10 * 1000);
+
+        // but not longer than a day
+        cache.storeAnswer(key, { address("example.org", "192.0.2.1", 10000000) }, NOW);
+        QCOMPARE(cache.entries().value(key).expires, NOW + NAMECACHE_MAXTTL * 1000);
+
+        // and not at all if it's not to be cached
+        auto other = NameCache::key("other.example.org", QTYPE_A);
+        cache.storeAnswer(other, { address("other.example.org", "192.0.2.3", 0) }, NOW);
+        QVERIFY(!cache.entries().contains(other));
+
+        // answered with the ttls counted down
+        auto e = cache.lookup(key, NOW + 4000);
+        QVERIFY(e);
+        auto records = NameCache::records(*e, NOW + 4000);
+        QCOMPARE(records.size(), 1);
+        QCOMPARE(records[0].ttl(), NAMECACHE_MAXTTL - 4);
+        QCOMPARE(records[0].address(), QHostAddress("192.0.2.1"));
+    }
+
+    void testNegative()
+    {
+        NameCache cache;
+        auto      noData = NameCache::key("example.org", QTYPE_SRV);
+        auto      noName = NameCache::key("nonexistent.example.org", QTYPE_A);
+
+        // NODATA. the name exists, it has no records of the type
+        cache.storeAnswer(noData, {}, NOW);
+        // NXDOMAIN
+        cache.storeNoName(noName, NOW);
+
+        for (const auto &key : { noData, noName }) {
+            auto e = cache.lookup(key, NOW + (NAMECACHE_NEGATIVETTL - 1) * 1000);
+            QVERIFY(e);
+            QVERIFY(e->records.isEmpty());
+            QCOMPARE(e->noName, key == noName);
+            QVERIFY(!cache.lookup(key, NOW + NAMECACHE_NEGATIVETTL * 1000));
+        }
+        QCOMPARE(cache.hits(), quint64(2));
+        QCOMPARE(cache.misses(), quint64(2));
+
+        // a real answer replaces the negative one
+        cache.storeAnswer(noData, { srv("_xmpp-client._tcp.example.org", "xmpp.example.org", 5222, 600) }, NOW);
+        auto e = cache.lookup(noData, NOW);
+        QVERIFY(e);
+        QVERIFY(!e->noName);
+        QCOMPARE(e->records.size(), 1);
+    }
+
+    void testLruEviction()
+    {
+        NameCache cache;
+        auto      name = [](int i) { return NameCache::key(QString("host%1.example.org").arg(i).toLatin1(), QTYPE_A); };
+        for (int i = 0; i < NAMECACHE_MAXENTRIES; i++)
+            cache.storeAnswer(name(i), { address("", "192.0.2.1", 3600) }, NOW + i);
+        QCOMPARE(cache.entries().size(), NAMECACHE_MAXENTRIES);
+
+        // the oldest one is used again, so the second oldest goes
+        QVERIFY(cache.lookup(name(0), NOW + NAMECACHE_MAXENTRIES));
+        cache.storeAnswer(name(NAMECACHE_MAXENTRIES), { address("", "192.0.2.1", 3600) }, NOW + NAMECACHE_MAXENTRIES);
+        QCOMPARE(cache.entries().size(), NAMECACHE_MAXENTRIES);
+        QVERIFY(cache.entries().contains(name(0)));
+        QVERIFY(!cache.entries().contains(name(1)));
+        QVERIFY(cache.entries().contains(name(NAMECACHE_MAXENTRIES)));
+
+        // refreshing an entry which is there already evicts nothing
+        cache.storeAnswer(name(2), { address("", "192.0.2.2", 3600) }, NOW + NAMECACHE_MAXENTRIES);
+        QCOMPARE(cache.entries().size(), NAMECACHE_MAXENTRIES);
+
+        // expired entries go before the least recently used one
+        cache.storeNoName(name(3), NOW + NAMECACHE_MAXENTRIES);
+        const qint64 later = NOW + NAMECACHE_NEGATIVETTL * 1000 + NAMECACHE_MAXENTRIES;
+        cache.storeAnswer(name(NAMECACHE_MAXENTRIES + 1), { address("", "192.0.2.1", 3600) }, later);
+        QVERIFY(!cache.entries().contains(name(3)));
+        QVERIFY(cache.entries().contains(name(4)));
+        QCOMPARE(cache.entries().size(), NAMECACHE_MAXENTRIES);
+    }
+
+    void testSaveLoad()
+    {
+        NameCache cache;
+        auto      a      = NameCache::key("example.org", QTYPE_A);
+        auto      s      = NameCache::key("_xmpp-client._tcp.example.org", QTYPE_SRV);
+        auto      noData = NameCache::key("example.org", QTYPE_SRV);
+        auto      noName = NameCache::key("nonexistent.example.org", QTYPE_A);
+        auto      old    = NameCache::key("old.example.org", QTYPE_A);
+        cache.storeAnswer(a, { address("example.org", "2001:db8::1", 3600) }, NOW);
+        cache.storeAnswer(s, { srv("_xmpp-client._tcp.example.org", "xmpp.example.org", 5222, 600) }, NOW);
+        cache.storeAnswer(noData, {}, NOW);
+        cache.storeNoName(noName, NOW);
+        cache.storeAnswer(old, { address("old.example.org", "192.0.2.1", 1) }, NOW);
+
+        NameCache loaded;
+        loaded.load(cache.save(NOW + 2000), NOW + 2000);
+        QCOMPARE(loaded.entries().size(), 4);
+        QVERIFY(!loaded.entries().contains(old));
+        for (const auto &key : { a, s, noData, noName }) {
+            const auto &was = cache.entries()[key];
+            const auto &is  = loaded.entries()[key];
+            QCOMPARE(is.expires, was.expires);
+            QCOMPARE(is.noName, was.noName);
+            QCOMPARE(is.records.size(), was.records.size());
+        }
+        auto r = loaded.entries()[a].records.value(0);
+        QCOMPARE(r.type(), NameRecord::Aaaa);
+        QCOMPARE(r.address(), QHostAddress("2001:db8::1"));
+        r = loaded.entries()[s].records.value(0);
+        QCOMPARE(r.type(), NameRecord::Srv);
+        QCOMPARE(r.name(), QByteArray("xmpp.example.org"));
+        QCOMPARE(r.port(), 5222);
+        QCOMPARE(r.priority(), 5);
+        QCOMPARE(r.weight(), 10);
+
+        // what expired while the application wasn't running is dropped
+        NameCache restarted;
+        restarted.load(cache.save(NOW), NOW + 1000 * 1000);
+        QCOMPARE(restarted.entries().size(), 1);
+        QVERIFY(restarted.entries().contains(a));
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(NameCacheTest);
+#include "namecachetest.moc"
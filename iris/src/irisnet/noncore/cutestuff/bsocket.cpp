@@ -22,13 +22,20 @@
 
 #include "netnames.h"
 
+#include <QFile>
 #include <QHostAddress>
 #include <QMetaType>
 #include <QTcpSocket>
 #include <QTimer>
 
+#include <array>
 #include <optional>
 
+#ifdef Q_OS_LINUX
+#include <cerrno>
+#include <sys/sendfile.h>
+#endif
+
 // #include <limits>  // if it's still needed please comment why
 
 #define BSDEBUG (qDebug() << this << "#" << __FUNCTION__ << ":")
@@ -46,6 +53,7 @@ static std::optional<bool> enable_logs;
         ;
 
 #define READBUFSIZE 65536
+#define RECVPOOLSIZE 4 // receive blocks per socket
 
 // CS_NAMESPACE_BEGIN
 class QTcpSocketSignalRelay : public QObject {
@@ -393,6 +401,25 @@ public:
     quint16      port;    //!< Port we are currently connected to
 
     QPointer<HappyEyeballsConnector> connector;
+
+    bool directSignals = false;
+
+    // blocks the socket is drained into. see BSocket::fillReadBuffer()
+    std::array<QByteArray, RECVPOOLSIZE> recvPool;
+
+    // a pooled block nobody else references anymore, or nullptr if all are still in use
+    QByteArray *freeRecvBlock()
+    {
+        for (auto &block : recvPool) {
+            if (block.isNull()) {
+                block.reserve(READBUFSIZE);
+                return &block;
+            }
+            if (block.isDetached())
+                return &block;
+        }
+        return nullptr;
+    }
 };
 
 BSocket::BSocket(QObject *parent) : ByteStream(parent)
@@ -419,32 +446,32 @@ void BSocket::resetConnection(bool clear)
     if (d->qsock) {
         delete d->qsock_relay;
         d->qsock_relay = nullptr;
+        // with direct signals close() would call us back, and the socket may be in the middle of
+        // emitting one, so it must not go away with us
+        d->qsock->disconnect(this);
+        d->qsock->setParent(nullptr);
 
         // move remaining into the local queue
         if (d->qsock->isOpen()) {
-            QByteArray block(int(d->qsock->bytesAvailable()),
-                             0); // memory won't never be cheap enough to have gigabytes for socket buffer
-            if (block.size()) {
-                d->qsock->read(block.data(), block.size());
-                appendRead(block);
-            }
+            if (!clear)
+                readBuf().appendFrom(d->qsock);
             d->qsock->close();
         }
 
         // d->sd.deleteLater(d->qsock);
         d->qsock->deleteLater();
         d->qsock = nullptr;
-    } else {
-        if (clear)
-            clearReadBuffer();
     }
+    if (clear)
+        clearReadBuffer();
 
     d->state   = Idle;
     d->domain  = "";
     d->host    = "";
     d->address = QHostAddress();
     d->port    = 0;
-    setOpenMode(QIODevice::NotOpen);
+    // data received before closing is still readable
+    setOpenMode(ByteStream::bytesAvailable() ? QIODevice::ReadOnly : QIODevice::NotOpen);
 }
 
 void BSocket::ensureConnector()
@@ -515,6 +542,10 @@ void BSocket::setSocket(QTcpSocket *s)
 
 int BSocket::state() const { return d->state; }
 
+void BSocket::setDirectSignals(bool enable) { d->directSignals = enable; }
+
+bool BSocket::directSignals() const { return d->directSignals; }
+
 const QString &BSocket::host() const { return d->host; }
 
 bool BSocket::isOpen() const
@@ -531,9 +562,11 @@ void BSocket::close()
         return;
 
     if (d->qsock) {
-        d->state = Closing;
         d->qsock->close();
+        if (!d->qsock) // reset by a direct error signal
+            return;
         if (d->qsock->state() == QAbstractSocket::ClosingState) {
+            d->state = Closing;
             return; // wait for disconnected signal
         } else {
             resetConnection();
@@ -553,18 +586,15 @@ qint64 BSocket::writeData(const char *data, qint64 maxSize)
 
 qint64 BSocket::readData(char *data, qint64 maxSize)
 {
-    if (!maxSize) {
+    if (maxSize <= 0) {
         return 0;
     }
-    qint64 readSize;
-    if (d->qsock) {
-        qint64 max = bytesAvailable();
-        if (maxSize <= 0 || maxSize > max) {
-            maxSize = max;
-        }
-        readSize = d->qsock->read(data, maxSize);
-    } else {
-        readSize = ByteStream::readData(data, maxSize);
+    // what fillReadBuffer() has taken already goes first
+    qint64 readSize = ByteStream::readData(data, maxSize);
+    if (d->qsock && readSize < maxSize) {
+        qint64 got = d->qsock->read(data + readSize, maxSize - readSize);
+        if (got > 0)
+            readSize += got;
     }
 
     BSLOG(BSDEBUG << "- [" << readSize << "]: {" << QByteArray::fromRawData(data, readSize) << "}");
@@ -574,7 +604,7 @@ qint64 BSocket::readData(char *data, qint64 maxSize)
 qint64 BSocket::bytesAvailable() const
 {
     if (d->qsock)
-        return d->qsock->bytesAvailable();
+        return ByteStream::bytesAvailable() + d->qsock->bytesAvailable();
     else
         return ByteStream::bytesAvailable();
 }
@@ -586,6 +616,30 @@ qint64 BSocket::bytesToWrite() const
     return d->qsock->bytesToWrite();
 }
 
+qint64 BSocket::sendFile(QFile *file, qint64 offset, qint64 size)
+{
+#ifdef Q_OS_LINUX
+    if (d->state != Connected || file->handle() == -1)
+        return -1;
+    if (d->qsock->bytesToWrite())
+        return 0; // would go ahead of what's buffered
+
+    off_t   off = off_t(offset);
+    ssize_t ret;
+    do {
+        ret = ::sendfile(int(d->qsock->socketDescriptor()), file->handle(), &off, size_t(size));
+    } while (ret == -1 && errno == EINTR);
+    if (ret == -1)
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    return ret;
+#else
+    Q_UNUSED(file)
+    Q_UNUSED(offset)
+    Q_UNUSED(size)
+    return -1;
+#endif
+}
+
 QHostAddress BSocket::address() const
 {
     if (d->qsock)
@@ -633,10 +687,20 @@ void BSocket::qs_connected()
 
 void BSocket::qs_connected_step2(bool signalConnected)
 {
-    connect(d->qsock_relay, SIGNAL(disconnected()), SLOT(qs_closed()));
-    connect(d->qsock_relay, SIGNAL(readyRead()), SLOT(qs_readyRead()));
-    connect(d->qsock_relay, SIGNAL(bytesWritten(qint64)), SLOT(qs_bytesWritten(qint64)));
-    connect(d->qsock_relay, SIGNAL(error(QAbstractSocket::SocketError)), SLOT(qs_error(QAbstractSocket::SocketError)));
+    if (d->directSignals) {
+        delete d->qsock_relay;
+        d->qsock_relay = nullptr;
+        connect(d->qsock, &QTcpSocket::disconnected, this, &BSocket::qs_closed);
+        connect(d->qsock, &QTcpSocket::readyRead, this, &BSocket::qs_readyRead);
+        connect(d->qsock, &QTcpSocket::bytesWritten, this, &BSocket::qs_bytesWritten);
+        connect(d->qsock, &QTcpSocket::errorOccurred, this, &BSocket::qs_error);
+    } else {
+        connect(d->qsock_relay, SIGNAL(disconnected()), SLOT(qs_closed()));
+        connect(d->qsock_relay, SIGNAL(readyRead()), SLOT(qs_readyRead()));
+        connect(d->qsock_relay, SIGNAL(bytesWritten(qint64)), SLOT(qs_bytesWritten(qint64)));
+        connect(d->qsock_relay, SIGNAL(error(QAbstractSocket::SocketError)),
+                SLOT(qs_error(QAbstractSocket::SocketError)));
+    }
 
     setOpenMode(QIODevice::ReadWrite);
     d->state = Connected;
@@ -660,7 +724,36 @@ void BSocket::qs_closed()
     }
 }
 
-void BSocket::qs_readyRead() { emit readyRead(); }
+void BSocket::qs_readyRead()
+{
+    fillReadBuffer();
+    emit readyRead();
+}
+
+/* Moves the received data from the socket to the read buffer, in pooled blocks which are
+   handed to the consumer as they are (see ByteStream::readShared()). A block is reused once
+   the consumer has dropped it, so a steady stream doesn't allocate on each readyRead.
+   Up to READBUFSIZE is taken, the rest stays in the socket which then stops reading. */
+void BSocket::fillReadBuffer()
+{
+    qint64 avail;
+    while (readBuf().size() < READBUFSIZE && (avail = d->qsock->bytesAvailable()) > 0) {
+        qint64      size  = qMin(avail, qint64(READBUFSIZE));
+        QByteArray *block = d->freeRecvBlock();
+        QByteArray  fresh;
+        if (block) {
+            block->resize(int(size));
+        } else {
+            fresh = QByteArray(int(size), Qt::Uninitialized);
+            block = &fresh;
+        }
+        qint64 got = d->qsock->read(block->data(), size);
+        if (got <= 0)
+            break;
+        block->truncate(int(got));
+        readBuf().append(*block);
+    }
+}
 
 void BSocket::qs_bytesWritten(qint64 x64)
 {
@@ -27,6 +27,7 @@
 #include <limits>
 
 class QByteArray;
+class QFile;
 class QObject;
 class QString;
 class QTcpSocket;
@@ -58,6 +59,12 @@ public:
     int                      state() const;
     const QString           &host() const;
 
+    /*! Connect the socket signals directly instead of relaying them through the event loop.
+        Saves an event per notification, but then the signals may be emitted from within
+        write() or close(). Takes effect on the next connection or setSocket() */
+    void setDirectSignals(bool enable);
+    bool directSignals() const;
+
     // from ByteStream
     bool isOpen() const;
     void close();
@@ -65,6 +72,12 @@ public:
     qint64 bytesAvailable() const;
     qint64 bytesToWrite() const;
 
+    /*! Sends size bytes of the file from offset straight from the page cache to the socket.
+        Returns the bytes sent, 0 if the socket can't take anything now and -1 if the platform
+        can't do that. Nothing tells when the socket is writable again, so after 0 queue a
+        regular write() and try again on its bytesWritten(). Linux only for now */
+    qint64 sendFile(QFile *file, qint64 offset, qint64 size);
+
     // local
     QHostAddress address() const;
     quint16      port() const;
@@ -101,6 +114,7 @@ private:
     void dns_srv_try_next();
     bool connect_host_try_next();
     void qs_connected_step2(bool signalConnected = true);
+    void fillReadBuffer();
 }; // CS_NAMESPACE_END
 
 #endif // CS_BSOCKET_H
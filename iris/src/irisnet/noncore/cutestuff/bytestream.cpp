@@ -50,7 +50,8 @@
 //!
 //! Use appendRead(), appendWrite(), takeRead(), and takeWrite() to modify the
 //! buffers.  If you have more advanced requirements, the buffers can be accessed
-//! directly with readBuf() and writeBuf().
+//! directly with readBuf() and writeBuf().  The buffers are SegmentedBuffer queues,
+//! so appended arrays are shared rather than copied and consuming data is cheap.
 //!
 //! Also available are the static convenience functions ByteStream::appendArray()
 //! and ByteStream::takeArray(), which make dealing with byte queues very easy.
@@ -59,9 +60,9 @@ class ByteStream::Private {
 public:
     Private() { }
 
-    QByteArray readBuf, writeBuf;
-    int        errorCode;
-    QString    errorText;
+    SegmentedBuffer readBuf, writeBuf;
+    int             errorCode = 0;
+    QString         errorText;
 };
 
 //!
@@ -80,7 +81,7 @@ qint64 ByteStream::writeData(const char *data, qint64 maxSize)
         return -1;
 
     bool doWrite = bytesToWrite() == 0;
-    d->writeBuf.append(data, int(maxSize));
+    d->writeBuf.append(data, maxSize);
     if (doWrite)
         tryWrite();
     return maxSize;
@@ -91,10 +92,21 @@ qint64 ByteStream::writeData(const char *data, qint64 maxSize)
 //! \a read will return all available data.
 qint64 ByteStream::readData(char *data, qint64 maxSize)
 {
-    maxSize = maxSize > d->readBuf.size() ? d->readBuf.size() : maxSize;
-    memcpy(data, d->readBuf.constData(), size_t(maxSize));
-    d->readBuf.remove(0, int(maxSize));
-    return maxSize;
+    return d->readBuf.read(data, maxSize);
+}
+
+//!
+//! Reads all available data, like readAll(), except that the chunks queued in the read buffer
+//! are handed over as they are.  A single chunk (e.g. a block received by BSocket) is shared
+//! rather than copied.
+QByteArray ByteStream::readShared()
+{
+    if (QIODevice::bytesAvailable()) // something was buffered by QIODevice::read()
+        return readAll();
+    QByteArray a = d->readBuf.take();
+    if (bytesAvailable())
+        a += readAll();
+    return a;
 }
 
 //!
@@ -107,39 +119,46 @@ qint64 ByteStream::bytesToWrite() const { return d->writeBuf.size(); }
 
 //!
 //! Clears the read buffer.
-void ByteStream::clearReadBuffer() { d->readBuf.resize(0); }
+void ByteStream::clearReadBuffer() { d->readBuf.clear(); }
 
 //!
 //! Clears the write buffer.
-void ByteStream::clearWriteBuffer() { d->writeBuf.resize(0); }
+void ByteStream::clearWriteBuffer() { d->writeBuf.clear(); }
 
 //!
-//! Appends \a block to the end of the read buffer.
-void ByteStream::appendRead(const QByteArray &block) { d->readBuf += block; }
+//! Appends \a block to the end of the read buffer. The data is shared, not copied.
+void ByteStream::appendRead(const QByteArray &block) { d->readBuf.append(block); }
 
 //!
-//! Appends \a block to the end of the write buffer.
-void ByteStream::appendWrite(const QByteArray &block) { d->writeBuf += block; }
+//! Appends \a block to the end of the write buffer. The data is shared, not copied.
+void ByteStream::appendWrite(const QByteArray &block) { d->writeBuf.append(block); }
+
+//!
+//! Copies \a size bytes of \a data to the end of the write buffer.
+void ByteStream::appendWrite(const char *data, qint64 size) { d->writeBuf.append(data, size); }
 
 //!
 //! Returns \a size bytes from the start of the read buffer.
 //! If \a size is 0, then all available data will be returned.
 //! If \a del is TRUE, then the bytes are also removed.
-QByteArray ByteStream::takeRead(int size, bool del) { return takeArray(d->readBuf, size, del); }
+QByteArray ByteStream::takeRead(int size, bool del) { return del ? d->readBuf.take(size) : d->readBuf.peek(size); }
 
 //!
 //! Returns \a size bytes from the start of the write buffer.
 //! If \a size is 0, then all available data will be returned.
 //! If \a del is TRUE, then the bytes are also removed.
-QByteArray ByteStream::takeWrite(int size, bool del) { return takeArray(d->writeBuf, size, del); }
+QByteArray ByteStream::takeWrite(int size, bool del)
+{
+    return del ? d->writeBuf.take(size) : d->writeBuf.peek(size);
+}
 
 //!
 //! Returns a reference to the read buffer.
-QByteArray &ByteStream::readBuf() { return d->readBuf; }
+SegmentedBuffer &ByteStream::readBuf() { return d->readBuf; }
 
 //!
 //! Returns a reference to the write buffer.
-QByteArray &ByteStream::writeBuf() { return d->writeBuf; }
+SegmentedBuffer &ByteStream::writeBuf() { return d->writeBuf; }
 
 //!
 //! Attempts to try and write some bytes from the write buffer, and returns the number
@@ -20,6 +20,8 @@
 #ifndef CS_BYTESTREAM_H
 #define CS_BYTESTREAM_H
 
+#include "segmentedbuffer.h"
+
 #include <QByteArray>
 #include <QIODevice>
 #include <QObject>
@@ -39,6 +41,8 @@ public:
     qint64 bytesAvailable() const;
     qint64 bytesToWrite() const;
 
+    QByteArray readShared();
+
     static QByteArray takeArray(QByteArray &from, int size = 0, bool del = true);
 
     int      errorCode() const;
@@ -55,16 +59,17 @@ protected:
     qint64 writeData(const char *data, qint64 maxSize);
     qint64 readData(char *data, qint64 maxSize);
 
-    void        setError(int code = ErrOk, const QString &text = QString());
-    void        clearReadBuffer();
-    void        clearWriteBuffer();
-    void        appendRead(const QByteArray &);
-    void        appendWrite(const QByteArray &);
-    QByteArray  takeRead(int size = 0, bool del = true);
-    QByteArray  takeWrite(int size = 0, bool del = true);
-    QByteArray &readBuf();
-    QByteArray &writeBuf();
-    virtual int tryWrite();
+    void             setError(int code = ErrOk, const QString &text = QString());
+    void             clearReadBuffer();
+    void             clearWriteBuffer();
+    void             appendRead(const QByteArray &);
+    void             appendWrite(const QByteArray &);
+    void             appendWrite(const char *data, qint64 size);
+    QByteArray       takeRead(int size = 0, bool del = true);
+    QByteArray       takeWrite(int size = 0, bool del = true);
+    SegmentedBuffer &readBuf();
+    SegmentedBuffer &writeBuf();
+    virtual int      tryWrite();
 
 private:
     //! \if _hide_doc_
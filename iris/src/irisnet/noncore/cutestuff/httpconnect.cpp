@@ -177,6 +177,26 @@ qint64 HttpConnect::writeData(const char *data, qint64 maxSize)
     return 0;
 }
 
+qint64 HttpConnect::bytesAvailable() const
+{
+    qint64 avail = ByteStream::bytesAvailable();
+    if (d->active)
+        avail += d->sock.bytesAvailable();
+    return avail;
+}
+
+qint64 HttpConnect::readData(char *data, qint64 maxSize)
+{
+    // the rest of the proxy reply first, then straight from the socket
+    qint64 ret = ByteStream::readData(data, maxSize);
+    if (ret < maxSize && d->active) {
+        qint64 n = d->sock.read(data + ret, maxSize - ret);
+        if (n > 0)
+            ret += n;
+    }
+    return ret;
+}
+
 qint64 HttpConnect::bytesToWrite() const
 {
     if (d->active)
@@ -231,10 +251,8 @@ void HttpConnect::sock_delayedCloseFinished()
 
 void HttpConnect::sock_readyRead()
 {
-    QByteArray block = d->sock.readAll();
-
     if (!d->active) {
-        d->recvBuf += block;
+        d->recvBuf += d->sock.readAll();
 
         if (d->inHeader) {
             // grab available lines
@@ -318,7 +336,7 @@ void HttpConnect::sock_readyRead()
             }
         }
     } else {
-        appendRead(block);
+        // the data is left in the socket till the consumer reads it. see readData()
         emit readyRead();
         return;
     }
@@ -35,10 +35,12 @@ public:
 
     // from ByteStream
     void   close();
+    qint64 bytesAvailable() const;
     qint64 bytesToWrite() const;
 
 protected:
     qint64 writeData(const char *data, qint64 maxSize);
+    qint64 readData(char *data, qint64 maxSize);
 
 signals:
     void connected();
@@ -0,0 +1,183 @@
+/*
+ * segmentedbuffer.cpp - byte queue made of shared chunks
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "segmentedbuffer.h"
+
+#include <QIODevice>
+
+#include <cstring>
+
+// CS_NAMESPACE_BEGIN
+
+//! \class SegmentedBuffer segmentedbuffer.h
+//! \brief FIFO byte queue for ByteStream buffers
+//!
+//! Appended QByteArrays are kept as is (implicitly shared, no copy), and consumed
+//! bytes are skipped by moving an offset in the first chunk, so neither side does
+//! a memmove of the whole queue like QByteArray::remove(0, n) did.
+//! Reads gather from as many chunks as needed straight into the destination.
+
+//!
+//! Removes all the data.
+void SegmentedBuffer::clear()
+{
+    segments.clear();
+    size_ = 0;
+}
+
+//!
+//! Appends \a block to the end of the buffer.  The data is shared, not copied.
+void SegmentedBuffer::append(const QByteArray &block)
+{
+    if (block.isEmpty())
+        return;
+    segments.push_back({ block, 0 });
+    size_ += block.size();
+}
+
+//!
+//! Copies \a size bytes from \a data to the end of the buffer.
+void SegmentedBuffer::append(const char *data, qint64 size)
+{
+    if (size <= 0)
+        return;
+    if (!segments.empty()) {
+        auto &last = segments.back();
+        if (qint64(last.data.size()) + size <= CoalesceLimit) {
+            last.data.append(data, int(size));
+            size_ += size;
+            return;
+        }
+    }
+    QByteArray block;
+    if (size < CoalesceLimit)
+        block.reserve(int(CoalesceLimit));
+    block.append(data, int(size));
+    segments.push_back({ block, 0 });
+    size_ += size;
+}
+
+//!
+//! Reads up to \a maxSize bytes (or all available if negative) from \a dev directly
+//! into a new chunk at the end of the buffer.  Returns the number of bytes read or -1 on error.
+qint64 SegmentedBuffer::appendFrom(QIODevice *dev, qint64 maxSize)
+{
+    qint64 avail = dev->bytesAvailable();
+    if (maxSize < 0 || maxSize > avail)
+        maxSize = avail;
+    if (maxSize <= 0)
+        return 0;
+
+    QByteArray block(int(maxSize), Qt::Uninitialized);
+    qint64     got = dev->read(block.data(), maxSize);
+    if (got <= 0)
+        return got;
+    if (got < maxSize)
+        block.truncate(int(got));
+    segments.push_back({ block, 0 });
+    size_ += got;
+    return got;
+}
+
+//!
+//! Moves up to \a maxSize bytes from the start of the buffer to \a data.
+//! Returns the number of bytes actually copied.
+qint64 SegmentedBuffer::read(char *data, qint64 maxSize)
+{
+    qint64 done = 0;
+    while (done < maxSize && !segments.empty()) {
+        auto  &seg = segments.front();
+        qint64 n   = qMin(seg.remaining(), maxSize - done);
+        std::memcpy(data + done, seg.begin(), size_t(n));
+        done += n;
+        seg.offset += n;
+        if (!seg.remaining())
+            segments.pop_front();
+    }
+    size_ -= done;
+    return done;
+}
+
+QByteArray SegmentedBuffer::gather(qint64 size) const
+{
+    const auto &first = segments.front();
+    if (first.offset == 0 && first.remaining() == size)
+        return first.data; // a whole chunk. just share it
+    if (first.remaining() >= size)
+        return QByteArray(first.begin(), int(size));
+
+    QByteArray ret(int(size), Qt::Uninitialized);
+    char      *p = ret.data();
+    for (auto it = segments.cbegin(); size > 0; ++it) {
+        qint64 n = qMin(it->remaining(), size);
+        std::memcpy(p, it->begin(), size_t(n));
+        p += n;
+        size -= n;
+    }
+    return ret;
+}
+
+//!
+//! Removes and returns \a size bytes from the start of the buffer.
+//! If \a size is 0, then all available data will be returned.
+QByteArray SegmentedBuffer::take(qint64 size)
+{
+    QByteArray ret = peek(size);
+    skip(ret.size());
+    return ret;
+}
+
+//!
+//! Returns \a size bytes from the start of the buffer without removing them.
+//! If \a size is 0, then all available data will be returned.
+QByteArray SegmentedBuffer::peek(qint64 size) const
+{
+    if (size <= 0 || size > size_)
+        size = size_;
+    if (!size)
+        return QByteArray();
+    return gather(size);
+}
+
+//!
+//! Drops \a size bytes from the start of the buffer.
+void SegmentedBuffer::skip(qint64 size)
+{
+    size = qMin(size, size_);
+    size_ -= size;
+    while (size > 0) {
+        auto  &seg = segments.front();
+        qint64 n   = qMin(seg.remaining(), size);
+        seg.offset += n;
+        size -= n;
+        if (!seg.remaining())
+            segments.pop_front();
+    }
+}
+
+//!
+//! Returns a pointer to the contiguous data at the start of the buffer (see frontSize()),
+//! e.g. to pass it to a socket without copying.  Valid until the buffer is modified.
+const char *SegmentedBuffer::frontData() const { return segments.empty() ? nullptr : segments.front().begin(); }
+
+//!
+//! Returns the number of bytes available at frontData().
+qint64 SegmentedBuffer::frontSize() const { return segments.empty() ? 0 : segments.front().remaining(); }
+
+// CS_NAMESPACE_END
@@ -0,0 +1,70 @@
+/*
+ * segmentedbuffer.h - byte queue made of shared chunks
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CS_SEGMENTEDBUFFER_H
+#define CS_SEGMENTEDBUFFER_H
+
+#include <QByteArray>
+
+#include <deque>
+
+class QIODevice;
+
+// CS_NAMESPACE_BEGIN
+// CS_EXPORT_BEGIN
+class SegmentedBuffer {
+public:
+    qint64 size() const { return size_; }
+    bool   isEmpty() const { return size_ == 0; }
+    int    segmentCount() const { return int(segments.size()); }
+    void   clear();
+
+    void   append(const QByteArray &block);
+    void   append(const char *data, qint64 size);
+    qint64 appendFrom(QIODevice *dev, qint64 maxSize = -1);
+
+    qint64     read(char *data, qint64 maxSize);
+    QByteArray take(qint64 size = 0);
+    QByteArray peek(qint64 size = 0) const;
+    void       skip(qint64 size);
+
+    const char *frontData() const;
+    qint64      frontSize() const;
+
+private:
+    struct Segment {
+        QByteArray data;
+        qint64     offset = 0; // consumed bytes at the start of data
+
+        qint64      remaining() const { return qint64(data.size()) - offset; }
+        const char *begin() const { return data.constData() + offset; }
+    };
+
+    // small appends (e.g. stanzas written with QIODevice::write) are merged into the last segment
+    static constexpr qint64 CoalesceLimit = 16384;
+
+    QByteArray gather(qint64 size) const;
+
+    std::deque<Segment> segments;
+    qint64              size_ = 0;
+};
+// CS_EXPORT_END
+// CS_NAMESPACE_END
+
+#endif // CS_SEGMENTEDBUFFER_H
@@ -462,11 +462,12 @@ void SocksClient::resetConnection(bool clear)
         d->sock.close();
     if (clear)
         clearReadBuffer();
+    bool readable = !clear && bytesAvailable();
     d->recvBuf.resize(0);
     d->waiting = false;
     d->udp     = false;
     d->pending = 0;
-    if (bytesAvailable()) {
+    if (readable) {
         setOpenMode(QIODevice::ReadOnly);
     } else {
         setOpenMode(QIODevice::NotOpen);
@@ -530,14 +531,26 @@ qint64 SocksClient::writeData(const char *data, qint64 maxSize)
 
 qint64 SocksClient::readData(char *data, qint64 maxSize)
 {
+    // leftovers of the negotiation first, then straight from the socket
     qint64 ret = ByteStream::readData(data, maxSize);
+    if (ret < maxSize && !d->udp && d->sock.isReadable()) {
+        qint64 n = d->sock.read(data + ret, maxSize - ret);
+        if (n > 0)
+            ret += n;
+    }
     if (d->sock.state() != BSocket::Connected && !bytesAvailable()) {
         setOpenMode(QIODevice::NotOpen);
     }
     return ret;
 }
 
-qint64 SocksClient::bytesAvailable() const { return ByteStream::bytesAvailable(); }
+qint64 SocksClient::bytesAvailable() const
+{
+    qint64 avail = ByteStream::bytesAvailable();
+    if (isOpen() && !d->udp)
+        avail += d->sock.bytesAvailable();
+    return avail;
+}
 
 qint64 SocksClient::bytesToWrite() const
 {
@@ -547,6 +560,13 @@ qint64 SocksClient::bytesToWrite() const
         return 0;
 }
 
+qint64 SocksClient::sendFile(QFile *file, qint64 offset, qint64 size)
+{
+    if (!isOpen() || d->udp)
+        return -1;
+    return d->sock.sendFile(file, offset, size);
+}
+
 void SocksClient::sock_connected()
 {
 #ifdef PROX_DEBUG
@@ -577,20 +597,19 @@ void SocksClient::sock_delayedCloseFinished()
 
 void SocksClient::sock_readyRead()
 {
-    QByteArray block = d->sock.readAll();
-
-    // qDebug() << this << "::sock_readyRead " << block.size() << " bytes." <<
+    // qDebug() << this << "::sock_readyRead " << d->sock.bytesAvailable() << " bytes." <<
     //            "udp=" << d->udp << openMode();
     if (!isOpen()) {
+        QByteArray block = d->sock.readShared();
         if (d->incoming)
             processIncoming(block);
         else
             processOutgoing(block);
+    } else if (d->udp) {
+        d->sock.readAll(); // nothing is expected on the control connection
     } else {
-        if (!d->udp) {
-            appendRead(block);
-            emit readyRead();
-        }
+        // the data is left in the socket till the consumer reads it. see readData()
+        emit readyRead();
     }
 }
 
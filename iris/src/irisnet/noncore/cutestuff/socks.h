@@ -23,6 +23,7 @@
 #include <iris/irisnet/noncore/cutestuff/bytestream.h>
 
 // CS_NAMESPACE_BEGIN
+class QFile;
 class QHostAddress;
 class QTcpServer;
 class QTcpSocket;
@@ -81,6 +82,9 @@ public:
     qint64 bytesAvailable() const;
     qint64 bytesToWrite() const;
 
+    // see BSocket::sendFile(). -1 for udp
+    qint64 sendFile(QFile *file, qint64 offset, qint64 size);
+
     // remote address
     QHostAddress peerAddress() const;
     quint16      peerPort() const;
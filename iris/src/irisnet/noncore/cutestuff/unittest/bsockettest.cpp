@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "irisnet/noncore/cutestuff/bsocket.h"
+#include "qttestutil/qttestutil.h"
+
+#include <QObject>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTemporaryFile>
+#include <QtTest/QtTest>
+
+#include <memory>
+
+// a BSocket connected to a socket of a local server
+class BSocketTest : public QObject {
+    Q_OBJECT
+
+    QTcpServer                  server;
+    std::unique_ptr<BSocket>    client;
+    std::unique_ptr<QTcpSocket> peer;
+
+    void connectPair(bool direct)
+    {
+        client.reset(new BSocket);
+        client->setDirectSignals(direct);
+        client->connectToHost(QHostAddress::LocalHost, server.serverPort());
+        QTRY_VERIFY(server.hasPendingConnections());
+        peer.reset(server.nextPendingConnection());
+        peer->setParent(nullptr);
+        QTRY_COMPARE(client->state(), int(BSocket::Connected));
+    }
+
+    // 64MB of not quite constant data
+    static bool makeFile(QTemporaryFile &file)
+    {
+        if (!file.open())
+            return false;
+        QByteArray chunk(1 << 20, Qt::Uninitialized);
+        for (int i = 0; i < 64; ++i) {
+            chunk.fill(char(i));
+            if (file.write(chunk) != chunk.size())
+                return false;
+        }
+        return file.flush();
+    }
+
+    // Sends the file to the peer in blocks of the given size, either read and written or with sendFile().
+    // Like jingle-ft does it: after the socket is full one regular block waits for bytesWritten().
+    void transferFile(QFile &file, qint64 block, bool zeroCopy, QByteArray *got = nullptr)
+    {
+        const qint64 total    = file.size();
+        qint64       received = 0;
+        QEventLoop   loop;
+        auto         pump = [&]() {
+            while (file.pos() < total) {
+                qint64 sent = zeroCopy ? client->sendFile(&file, file.pos(), qMin(block, total - file.pos())) : 0;
+                if (sent > 0) {
+                    file.seek(file.pos() + sent);
+                    continue;
+                }
+                if (client->bytesToWrite() < 2 * block)
+                    client->write(file.read(block));
+                if (client->bytesToWrite())
+                    break;
+            }
+        };
+        auto c1 = connect(client.get(), &BSocket::bytesWritten, this, pump);
+        auto c2 = connect(peer.get(), &QTcpSocket::readyRead, this, [&]() {
+            auto data = peer->readAll();
+            received += data.size();
+            if (got)
+                *got += data;
+            if (received >= total)
+                loop.quit();
+        });
+        file.seek(0);
+        pump();
+        loop.exec();
+        disconnect(c1);
+        disconnect(c2);
+    }
+
+    void addModes()
+    {
+        QTest::addColumn<bool>("direct");
+        QTest::newRow("relayed") << false;
+        QTest::newRow("direct") << true;
+    }
+
+private slots:
+    void initTestCase() { QVERIFY(server.listen(QHostAddress::LocalHost)); }
+
+    void cleanup()
+    {
+        client.reset();
+        peer.reset();
+    }
+
+    void testReceive_data() { addModes(); }
+
+    void testReceive()
+    {
+        QFETCH(bool, direct);
+        connectPair(direct);
+
+        QByteArray data(1 << 20, Qt::Uninitialized);
+        for (int i = 0; i < data.size(); ++i)
+            data[i] = char(i * 7);
+        QByteArray got;
+        connect(client.get(), &BSocket::readyRead, this, [&]() { got += client->readShared(); });
+        peer->write(data);
+        QTRY_COMPARE(got.size(), data.size());
+        QCOMPARE(got, data);
+    }
+
+    void testBlocksReused()
+    {
+        connectPair(false);
+        QSignalSpy readyRead(client.get(), &BSocket::readyRead);
+
+        peer->write("<a/>");
+        QTRY_COMPARE(readyRead.count(), 1);
+        const char *first = client->readShared().constData(); // the block goes back to the pool
+
+        peer->write("<b/>");
+        QTRY_COMPARE(readyRead.count(), 2);
+        QByteArray second = client->readShared();
+        QCOMPARE(second, QByteArray("<b/>"));
+        QCOMPARE(second.constData(), first);
+    }
+
+    void testCloseDirect()
+    {
+        connectPair(true);
+        QSignalSpy closed(client.get(), &BSocket::connectionClosed);
+        peer->write("bye");
+        peer->disconnectFromHost();
+        QTRY_COMPARE(closed.count(), 1);
+        QCOMPARE(client->readShared(), QByteArray("bye")); // still readable after the reset
+    }
+
+    void benchmarkThroughput_data() { addModes(); }
+
+    // 64MB through loopback in 16KB writes
+    void benchmarkThroughput()
+    {
+        QFETCH(bool, direct);
+        connectPair(direct);
+
+        const QByteArray chunk(16384, 'x');
+        const qint64     total = 64 << 20;
+        qint64           sent, received;
+        QEventLoop       loop;
+        connect(client.get(), &BSocket::readyRead, this, [&]() {
+            received += client->readShared().size();
+            if (received >= total)
+                loop.quit();
+        });
+        connect(peer.get(), &QTcpSocket::bytesWritten, this, [&]() {
+            for (; peer->bytesToWrite() < 4 * chunk.size() && sent < total; sent += chunk.size())
+                peer->write(chunk);
+        });
+
+        QBENCHMARK
+        {
+            sent     = chunk.size();
+            received = 0;
+            peer->write(chunk);
+            loop.exec();
+        }
+    }
+
+    void testSendFile()
+    {
+        connectPair(false);
+        QTemporaryFile file;
+        QVERIFY(makeFile(file));
+        if (client->sendFile(&file, 0, 0) == -1)
+            QSKIP("no zero-copy path on this platform");
+
+        QByteArray got;
+        transferFile(file, 1 << 20, true, &got);
+        file.seek(0);
+        QCOMPARE(got, file.readAll());
+    }
+
+    void benchmarkFileTransfer_data()
+    {
+        QTest::addColumn<bool>("zeroCopy");
+        QTest::addColumn<qint64>("block");
+        QTest::newRow("write 8K") << false << qint64(8192);
+        QTest::newRow("write 64K") << false << qint64(65536);
+        QTest::newRow("write 1M") << false << qint64(1 << 20);
+        QTest::newRow("sendfile 1M") << true << qint64(1 << 20);
+    }
+
+    // a 64MB file through loopback like an S5B file transfer does it
+    void benchmarkFileTransfer()
+    {
+        QFETCH(bool, zeroCopy);
+        QFETCH(qint64, block);
+        connectPair(false);
+        QTemporaryFile file;
+        QVERIFY(makeFile(file));
+        if (zeroCopy && client->sendFile(&file, 0, 0) == -1)
+            QSKIP("no zero-copy path on this platform");
+
+        QBENCHMARK { transferFile(file, block, zeroCopy); }
+    }
+
+    void benchmarkLatency_data() { addModes(); }
+
+    // 1000 round trips of a small stanza, echoed by the peer
+    void benchmarkLatency()
+    {
+        QFETCH(bool, direct);
+        connectPair(direct);
+
+        const QByteArray ping("<iq type='get' id='p'><ping xmlns='urn:xmpp:ping'/></iq>");
+        int              left;
+        QEventLoop       loop;
+        connect(peer.get(), &QTcpSocket::readyRead, this, [&]() { peer->write(peer->readAll()); });
+        connect(client.get(), &BSocket::readyRead, this, [&]() {
+            client->readShared();
+            if (--left)
+                client->write(ping);
+            else
+                loop.quit();
+        });
+
+        QBENCHMARK
+        {
+            left = 1000;
+            client->write(ping);
+            loop.exec();
+        }
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(BSocketTest);
+#include "bsockettest.moc"
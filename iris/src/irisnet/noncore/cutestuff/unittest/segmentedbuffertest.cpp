@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "irisnet/noncore/cutestuff/segmentedbuffer.h"
+#include "qttestutil/qttestutil.h"
+
+#include <QBuffer>
+#include <QObject>
+#include <QtTest/QtTest>
+
+class SegmentedBufferTest : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testAppendShares()
+    {
+        SegmentedBuffer b;
+        QByteArray      block("0123456789");
+        b.append(block);
+        QCOMPARE(b.size(), qint64(10));
+        QByteArray all = b.take();
+        QCOMPARE(all.constData(), block.constData()); // the same chunk, no copy
+        QVERIFY(b.isEmpty());
+    }
+
+    void testReadAcrossSegments()
+    {
+        SegmentedBuffer b;
+        b.append(QByteArray("abc"));
+        b.append(QByteArray("def"));
+        b.append(QByteArray("ghi"));
+        QCOMPARE(b.segmentCount(), 3);
+
+        char buf[5];
+        QCOMPARE(b.read(buf, 5), qint64(5));
+        QCOMPARE(QByteArray(buf, 5), QByteArray("abcde"));
+        QCOMPARE(b.segmentCount(), 2);
+        QCOMPARE(b.frontSize(), qint64(1));
+        QCOMPARE(b.peek(), QByteArray("fghi"));
+        QCOMPARE(b.take(2), QByteArray("fg"));
+        QCOMPARE(b.take(100), QByteArray("hi"));
+        QVERIFY(b.isEmpty());
+        QCOMPARE(b.segmentCount(), 0);
+    }
+
+    void testSmallWritesCoalesce()
+    {
+        SegmentedBuffer b;
+        for (int i = 0; i < 100; ++i)
+            b.append("<r/>", 4);
+        QCOMPARE(b.segmentCount(), 1);
+        QCOMPARE(b.size(), qint64(400));
+        b.skip(396);
+        QCOMPARE(b.take(), QByteArray("<r/>"));
+    }
+
+    void testAppendFromDevice()
+    {
+        QByteArray data(100000, 'x');
+        QBuffer    dev(&data);
+        dev.open(QIODevice::ReadOnly);
+        SegmentedBuffer b;
+        QCOMPARE(b.appendFrom(&dev, 1000), qint64(1000));
+        QCOMPARE(b.appendFrom(&dev), qint64(99000));
+        QCOMPARE(b.take(), data);
+    }
+
+    void benchmarkConsume_data()
+    {
+        QTest::addColumn<bool>("segmented");
+        QTest::newRow("QByteArray::remove") << false;
+        QTest::newRow("SegmentedBuffer") << true;
+    }
+
+    // 4MB arriving in 16KB chunks consumed in 4KB reads, like a S5B transfer
+    void benchmarkConsume()
+    {
+        QFETCH(bool, segmented);
+        QByteArray chunk(16384, 'x');
+        char       out[4096];
+        QBENCHMARK
+        {
+            if (segmented) {
+                SegmentedBuffer b;
+                for (int i = 0; i < 256; ++i)
+                    b.append(chunk);
+                while (!b.isEmpty())
+                    b.read(out, sizeof(out));
+            } else {
+                QByteArray b;
+                for (int i = 0; i < 256; ++i)
+                    b += chunk;
+                while (!b.isEmpty()) {
+                    int n = qMin(int(b.size()), int(sizeof(out)));
+                    memcpy(out, b.constData(), size_t(n));
+                    b.remove(0, n);
+                }
+            }
+        }
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(SegmentedBufferTest);
+#include "segmentedbuffertest.moc"
@@ -31,6 +31,7 @@
 #include "udpportreserver.h"
 
 #include <QDeadlineTimer>
+#include <QElapsedTimer>
 #include <QEvent>
 #include <QNetworkInterface>
 #include <QPointer>
@@ -243,6 +244,8 @@ public:
     bool                                    remoteGatheringComplete    = false;
     bool                                    readyToSendMedia           = false;
     bool                                    canStartChecks             = false;
+    QElapsedTimer                           startTime;
+    Ice176::Stats                           stats;
 
     Private(Ice176 *_q) : QObject(_q), q(_q)
     {
@@ -319,6 +322,8 @@ public:
         Q_ASSERT(state == Stopped);
 
         state = Starting;
+        stats = Ice176::Stats();
+        startTime.start();
 
         localUser = IceAgent::randomCredential(4);
         localPass = IceAgent::randomCredential(22);
@@ -486,7 +491,9 @@ public:
         //   should qualify as a HACK or not.
         //   trying to relay to localhost is pretty
         //   stupid anyway
-        if (lc->type == IceComponent::RelayedType && getAddressScope(rc->addr.addr) == 0) {
+        //   (unless the relay is on localhost too, like in icetunnel bench)
+        if (lc->type == IceComponent::RelayedType && getAddressScope(rc->addr.addr) == 0
+            && getAddressScope(lc->addr.addr) != 0) {
             qDebug("Skip building pair: %s - %s (relay to localhost)", qPrintable(lc->addr), qPrintable(rc->addr));
             return {};
         }
@@ -602,6 +609,7 @@ public:
     {
         pair->foundation = pair->local->foundation + pair->remote->foundation;
         pair->state      = PInProgress;
+        ++stats.pairsChecked;
 
         int at = findLocalCandidate(pair->local->addr);
         Q_ASSERT(at != -1);
@@ -626,6 +634,9 @@ public:
                     IceComponent::Candidate &lc   = localCandidates[at];
                     int                      path = lc.path;
 
+                    if (stats.firstCheck == -1)
+                        stats.firstCheck = startTime.elapsed();
+                    ++stats.checksSent;
                     iceDebug("send connectivity check for pair %s%s", qPrintable(*pair),
                              (mode == Initiator
                                   ? (pair->binding->useCandidate() ? " (nominating)" : "")
@@ -879,7 +890,8 @@ public:
         iceDebug("Signalling iceFinished now");
 #endif
         pacTimer.reset();
-        state = Active;
+        state          = Active;
+        stats.finished = startTime.elapsed();
         emit q->iceFinished();
     }
 
@@ -1136,7 +1148,8 @@ private:
             }
         }
 #endif
-        readyToSendMedia = true;
+        readyToSendMedia       = true;
+        stats.readyToSendMedia = startTime.elapsed();
         emit q->readyToSendMedia();
     }
 
@@ -1490,15 +1503,48 @@ private slots:
 
             // iceDebug("port %d: received packet (%d bytes)", lt->sock->localPort(), buf.size());
 
-            QString    requser = localUser + ':' + peerUser;
-            QByteArray reqkey  = localPass.toUtf8();
+            // most of what arrives is media, which fails the first byte
+            //   checks.  anything else must validate as STUN
+            StunMessageView stun(buf);
+            if (stun.isNull()) {
+                int at = -1;
+                for (int n = 0; n < checkList.pairs.count(); ++n) {
+                    CandidatePair &pair = *checkList.pairs[n];
+                    if (pair.local->addr.addr == locCand.info->addr.addr
+                        && pair.local->addr.port == locCand.info->addr.port) {
+                        at = n;
+                        break;
+                    }
+                }
+                if (at == -1) {
+                    iceDebug("the local transport does not seem to be associated with a candidate?!");
+                    continue;
+                }
+
+                int componentIndex = checkList.pairs[at]->local->componentId - 1;
+                // iceDebug("packet is considered to be application data for component index %d", componentIndex);
+
+                // FIXME: this assumes components are ordered by id in our local arrays
+                in[componentIndex] += buf;
+                emit q->readyRead(componentIndex);
+                continue;
+            }
+
+            bool       request = stun.mclass() == StunMessage::Request || stun.mclass() == StunMessage::Indication;
+            QByteArray key     = request ? localPass.toUtf8() : peerPass.toUtf8();
+            if (!stun.checkFingerprint() || !stun.checkMessageIntegrity(key)) {
+                // FIXME: i don't know if this is good enough
+                iceDebug("unexpected stun packet (loopback?), skipping.");
+                continue;
+            }
 
-            StunMessage::ConvertResult result;
-            StunMessage                msg = StunMessage::fromBinary(buf, &result,
-                                                                     StunMessage::MessageIntegrity | StunMessage::Fingerprint, reqkey);
-            if (!msg.isNull() && (msg.mclass() == StunMessage::Request || msg.mclass() == StunMessage::Indication)) {
+            StunMessage msg = stun.toMessage(StunMessage::MessageIntegrity | StunMessage::Fingerprint);
+            if (request) {
                 iceDebug("received validated request or indication from %s", qPrintable(fromAddr));
-                QString user = QString::fromUtf8(msg.attribute(StunTypes::USERNAME));
+                if (msg.mclass() == StunMessage::Request)
+                    ++stats.checksReceived;
+                QString requser = localUser + ':' + peerUser;
+                QString user    = QString::fromUtf8(msg.attribute(StunTypes::USERNAME));
                 if (requser != user) {
                     iceDebug("user [%s] is wrong.  it should be [%s].  skipping", qPrintable(user),
                              qPrintable(requser));
@@ -1523,7 +1569,7 @@ private slots:
 
                 response.setAttributes(list);
 
-                QByteArray packet = response.toBinary(StunMessage::MessageIntegrity | StunMessage::Fingerprint, reqkey);
+                QByteArray packet = response.toBinary(StunMessage::MessageIntegrity | StunMessage::Fingerprint, key);
                 sock->writeDatagram(path, packet, fromAddr);
 
                 if (state != Started) // only in started state we do triggered checks
@@ -1549,50 +1595,15 @@ private slots:
                     doTriggeredCheck(locCand, *it, nominated);
                 }
             } else {
-                QByteArray  reskey = peerPass.toUtf8();
-                StunMessage msg    = StunMessage::fromBinary(
-                    buf, &result, StunMessage::MessageIntegrity | StunMessage::Fingerprint, reskey);
-                if (!msg.isNull()
-                    && (msg.mclass() == StunMessage::SuccessResponse || msg.mclass() == StunMessage::ErrorResponse)) {
-                    iceDebug("received validated response from %s to %s", qPrintable(fromAddr),
-                             qPrintable(locCand.info->addr));
-
-                    // FIXME: this is so gross and completely defeats the point of having pools
-                    for (int n = 0; n < checkList.pairs.count(); ++n) {
-                        CandidatePair &pair = *checkList.pairs[n];
-                        if (pair.state == PInProgress && pair.local->addr.addr == locCand.info->addr.addr
-                            && pair.local->addr.port == locCand.info->addr.port)
-                            pair.pool->writeIncomingMessage(msg);
-                    }
-                } else {
-                    // iceDebug("received some non-stun or invalid stun packet");
-
-                    // FIXME: i don't know if this is good enough
-                    if (StunMessage::isProbablyStun(buf)) {
-                        iceDebug("unexpected stun packet (loopback?), skipping.");
-                        continue;
-                    }
-
-                    int at = -1;
-                    for (int n = 0; n < checkList.pairs.count(); ++n) {
-                        CandidatePair &pair = *checkList.pairs[n];
-                        if (pair.local->addr.addr == locCand.info->addr.addr
-                            && pair.local->addr.port == locCand.info->addr.port) {
-                            at = n;
-                            break;
-                        }
-                    }
-                    if (at == -1) {
-                        iceDebug("the local transport does not seem to be associated with a candidate?!");
-                        continue;
-                    }
-
-                    int componentIndex = checkList.pairs[at]->local->componentId - 1;
-                    // iceDebug("packet is considered to be application data for component index %d", componentIndex);
-
-                    // FIXME: this assumes components are ordered by id in our local arrays
-                    in[componentIndex] += buf;
-                    emit q->readyRead(componentIndex);
+                iceDebug("received validated response from %s to %s", qPrintable(fromAddr),
+                         qPrintable(locCand.info->addr));
+
+                // FIXME: this is so gross and completely defeats the point of having pools
+                for (int n = 0; n < checkList.pairs.count(); ++n) {
+                    CandidatePair &pair = *checkList.pairs[n];
+                    if (pair.state == PInProgress && pair.local->addr.addr == locCand.info->addr.addr
+                        && pair.local->addr.port == locCand.info->addr.port)
+                        pair.pool->writeIncomingMessage(msg);
                 }
             }
         }
@@ -1675,6 +1686,12 @@ void Ice176::setLocalFeatures(const Features &features) { d->localFeatures = fea
 
 void Ice176::setRemoteFeatures(const Features &features) { d->remoteFeatures = features; }
 
+void Ice176::setCheckInterval(int msecs) { d->checkTimer.setInterval(msecs); }
+
+void Ice176::setPacTimeout(int msecs) { d->pacTimeout = msecs; }
+
+void Ice176::setNominationTimeout(int msecs) { d->nominationTimeout = msecs; }
+
 void Ice176::start(Mode mode)
 {
     d->mode = mode;
@@ -1749,6 +1766,8 @@ bool Ice176::isLocalGatheringComplete() const { return d->localGatheringComplete
 
 bool Ice176::isActive() const { return d->state == Private::Active; }
 
+Ice176::Stats Ice176::stats() const { return d->stats; }
+
 QList<Ice176::SelectedCandidate> Ice176::selectedCandidates() const
 {
     QList<Ice176::SelectedCandidate> ret;
@@ -127,6 +127,12 @@ public:
     void setLocalFeatures(const Features &features);
     void setRemoteFeatures(const Features &features);
 
+    // connectivity check pacing. the defaults are fine for real networks and
+    //   mostly interesting to change when benchmarking
+    void setCheckInterval(int msecs);     // Ta. 20ms by default
+    void setPacTimeout(int msecs);        // Patiently Awaiting Connectivity. 30s by default
+    void setNominationTimeout(int msecs); // how long to wait for better pairs before nomination. 3s by default
+
     void start(Mode mode); // init everything and prepare candidates
     void stop();
     bool isStopped() const;
@@ -163,6 +169,17 @@ public:
 
     QList<SelectedCandidate> selectedCandidates() const;
 
+    // counted from start(). times are in msecs and -1 until it happens
+    struct Stats {
+        qint64 firstCheck       = -1; // first connectivity check sent
+        qint64 readyToSendMedia = -1;
+        qint64 finished         = -1; // all components have nominated pairs
+        int    pairsChecked     = 0;
+        int    checksSent       = 0; // including retransmissions
+        int    checksReceived   = 0; // validated requests from the peer
+    };
+    Stats stats() const;
+
     static QList<QHostAddress> availableNetworkAddresses();
 
 signals:
@@ -29,15 +29,65 @@
 #include <QUdpSocket>
 #include <QtCrypto>
 
+#ifdef Q_OS_LINUX
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <memory>
+#endif
+
 // don't queue more incoming packets than this per transmit path
 #define MAX_PACKET_QUEUE 64
 
+#define RECV_BATCH 32          // datagrams per recvmmsg() call
+#define RECV_SLOT_SIZE 65536   // max udp payload
+
 namespace XMPP {
 enum { Direct, Relayed };
 
 //----------------------------------------------------------------------------
 // SafeUdpSocket
 //----------------------------------------------------------------------------
+#ifdef Q_OS_LINUX
+// recvmmsg() destination. it's emptied right away, so one per thread is enough.
+// the slots are big enough for any datagram but only the touched pages get committed.
+struct RecvBatch {
+    std::unique_ptr<char[]> data { new char[RECV_BATCH * RECV_SLOT_SIZE] };
+    mmsghdr                 msgs[RECV_BATCH];
+    iovec                   iov[RECV_BATCH];
+    sockaddr_storage        from[RECV_BATCH];
+
+    RecvBatch()
+    {
+        for (int i = 0; i < RECV_BATCH; ++i) {
+            iov[i]                      = { slot(i), RECV_SLOT_SIZE };
+            msgs[i]                     = {};
+            msgs[i].msg_hdr.msg_iov     = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen  = 1;
+            msgs[i].msg_hdr.msg_name    = &from[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        }
+    }
+
+    char *slot(int i) const { return data.get() + i * RECV_SLOT_SIZE; }
+};
+
+static RecvBatch &recvBatch()
+{
+    static thread_local std::unique_ptr<RecvBatch> batch;
+    if (!batch)
+        batch.reset(new RecvBatch);
+    return *batch;
+}
+
+// IRIS_NO_RECVMMSG=1 reads datagram by datagram, e.g. to compare with icetunnel's benchmark
+static bool batchDisabled()
+{
+    static const bool disabled = qgetenv("IRIS_NO_RECVMMSG") == "1";
+    return disabled;
+}
+#endif
+
 // DOR-safe wrapper for QUdpSocket
 class SafeUdpSocket : public QObject {
     Q_OBJECT
@@ -93,6 +143,39 @@ public:
         return buf;
     }
 
+    // Passes all the pending datagrams to handler(buf, from) until it returns false.
+    // On Linux everything after the first datagram is read with recvmmsg(), RECV_BATCH at a time.
+    // The first one still goes through QUdpSocket since that's what re-arms its read notifier.
+    template <typename Handler> void readDatagrams(Handler handler)
+    {
+        TransportAddress from;
+        QByteArray       buf = readDatagram(from);
+        if (buf.isEmpty() || !handler(buf, from))
+            return;
+#ifdef Q_OS_LINUX
+        while (!batchDisabled()) {
+            RecvBatch &b = recvBatch();
+            int        n = ::recvmmsg(int(sock->socketDescriptor()), b.msgs, RECV_BATCH, MSG_DONTWAIT, nullptr);
+            if (n <= 0)
+                return; // EAGAIN, drained
+            for (int i = 0; i < n; ++i) {
+                from = TransportAddress::fromSockAddr(reinterpret_cast<const sockaddr *>(&b.from[i]));
+                b.msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage); // reset for the next call
+                if (!b.msgs[i].msg_len)
+                    continue;
+                if (!handler(QByteArray(b.slot(i), int(b.msgs[i].msg_len)), from))
+                    return;
+            }
+            if (n < RECV_BATCH)
+                return;
+        }
+#endif
+        while ((buf = readDatagram(from)), !buf.isEmpty()) {
+            if (!handler(buf, from))
+                return;
+        }
+    }
+
     void writeDatagram(const QByteArray &buf, const TransportAddress &address)
     {
         sock->writeDatagram(buf, address.addr, address.port);
@@ -427,13 +510,8 @@ private slots:
         QList<Datagram> dreads; // direct
         QList<Datagram> rreads; // relayed
 
-        while (sock->hasPendingDatagrams()) {
-            TransportAddress from;
-            Datagram         dg;
-
-            QByteArray buf = sock->readDatagram(from);
-            if (buf.isEmpty()) // it's weird we ever came here, but should relax static analyzer
-                break;
+        sock->readDatagrams([&](const QByteArray &buf, const TransportAddress &from) {
+            Datagram dg;
             // qDebug("got packet from %s", qPrintable(from));
             if (from == stunBindAddr || from == stunRelayAddr) {
                 bool haveData = processIncomingStun(buf, from, &dg);
@@ -441,7 +519,7 @@ private slots:
                 // processIncomingStun could cause signals to
                 //   emit.  for example, stopped()
                 if (!watch.isValid())
-                    return;
+                    return false;
 
                 if (haveData)
                     rreads += dg;
@@ -450,7 +528,10 @@ private slots:
                 dg.buf  = buf;
                 dreads += dg;
             }
-        }
+            return true;
+        });
+        if (!watch.isValid())
+            return;
 
         if (dreads.count() > 0) {
             in += dreads;
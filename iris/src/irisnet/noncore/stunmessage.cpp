@@ -97,26 +97,25 @@ static quint8 magic_cookie[4] = { 0x21, 0x12, 0xA4, 0x42 };
 
 // do 3-field check of stun packet
 // returns length of packet not counting the header, or -1 on error
-static int check_and_get_length(const QByteArray &buf)
+static int check_and_get_length(const quint8 *p, int size)
 {
     // stun packets are at least 20 bytes
-    if (buf.size() < 20)
+    if (size < 20)
         return -1;
 
     // minimal 3-field check
 
-    if (buf[0] < 0 || buf[0] > 3) // rfc7983 p.7
+    if (p[0] > 3) // rfc7983 p.7
         return -1;
 
-    const quint8 *p    = (const quint8 *)buf.data();
-    quint16       mlen = read16(p + 2);
+    quint16 mlen = read16(p + 2);
 
     // bottom 2 bits of message length field must be 0
     if (mlen & 0x03)
         return -1;
 
     // (also, the message length should be a reasonable size)
-    if (mlen + 20 > buf.size())
+    if (mlen + 20 > size)
         return -1;
 
     // magic cookie must be set
@@ -145,19 +144,18 @@ static quint16 round_up_length(quint16 in)
     return out;
 }
 
-// buf    = entire stun packet
+// p      = entire stun packet
+// size   = end of its attribute area
 // offset = byte index of current attribute (first is offset=20)
 // type   = take attribute type
 // len    = take attribute value length (value is at offset + 4)
 // returns offset of next attribute, -1 if no more
-static int get_attribute_props(const QByteArray &buf, int offset, quint16 *type, int *len)
+static int get_attribute_props(const quint8 *p, int size, int offset, quint16 *type, int *len)
 {
     Q_ASSERT(offset >= ATTRIBUTE_AREA_START);
 
-    const quint8 *p = (const quint8 *)buf.data();
-
     // need at least 4 bytes for an attribute
-    if (offset + 4 > buf.size())
+    if (offset + 4 > size)
         return -1;
 
     quint16 _type = read16(p + offset);
@@ -168,7 +166,7 @@ static int get_attribute_props(const QByteArray &buf, int offset, quint16 *type,
     // get physical length.  stun attributes are 4-byte aligned, and may
     //   contain 0-3 bytes of padding.
     quint16 plen = round_up_length(_alen);
-    if (offset + plen > buf.size())
+    if (offset + plen > size)
         return -1;
 
     *type = _type;
@@ -176,12 +174,13 @@ static int get_attribute_props(const QByteArray &buf, int offset, quint16 *type,
     return offset + plen;
 }
 
-// buf    = entire stun packet
+// p      = entire stun packet
+// size   = end of its attribute area
 // type   = attribute type to find
 // len    = take attribute value length (value is at offset + 4)
 // next   = take offset of next attribute
 // returns offset of found attribute, -1 if not found
-static int find_attribute(const QByteArray &buf, quint16 type, int *len, int *next = nullptr)
+static int find_attribute(const quint8 *p, int size, quint16 type, int *len, int *next = nullptr)
 {
     int     at = ATTRIBUTE_AREA_START;
     quint16 _type;
@@ -189,7 +188,7 @@ static int find_attribute(const QByteArray &buf, quint16 type, int *len, int *ne
     int     _next;
 
     while (1) {
-        _next = get_attribute_props(buf, at, &_type, &_len);
+        _next = get_attribute_props(p, size, at, &_type, &_len);
         if (_next == -1)
             break;
         if (_type == type) {
@@ -251,65 +250,85 @@ static QByteArray message_integrity_calc(const quint8 *buf, int size, const QByt
 }
 
 // look for fingerprint attribute and confirm it
-// buf = entire stun packet
+// p    = entire stun packet
+// size = end of its attribute area
 // returns true if fingerprint attribute exists and is correct
-static bool fingerprint_check(const QByteArray &buf)
+static bool fingerprint_check(const quint8 *p, int size)
 {
     int at, len;
-    at = find_attribute(buf, AttribFingerprint, &len);
+    at = find_attribute(p, size, AttribFingerprint, &len);
     if (at == -1 || len != 4) // value must be 4 bytes
         return false;
 
-    const quint8 *p      = (const quint8 *)buf.data();
-    quint32       fpval  = read32(p + at + 4);
-    quint32       fpcalc = fingerprint_calc(p, at);
+    quint32 fpval  = read32(p + at + 4);
+    quint32 fpcalc = fingerprint_calc(p, at);
     return fpval == fpcalc;
 }
 
-// copy the input buffer and prepare for message integrity checking.  the
-//   packet is truncated after the message-integrity attribute (since nothing
-//   after it is protected), and the packet length is adjusted in the header
-//   accordingly.
-// buf    = input stun packet
-// out    = take output stun packet
-// offset = take offset of message-integrity attribute
-// returns true if message-integrity attribute exists and packet is prepared
-// note: message-integrity value is at offset + 4 and is exactly 20 bytes
-static bool message_integrity_prep(const QByteArray &buf, QByteArray *out, int *offset)
+// confirm message integrity.  nothing after the message-integrity attribute
+//   is protected, so the hash is calculated as if the packet ended there:
+//   over a copy of the header with the length adjusted, followed by the
+//   attributes before message-integrity as they are in the packet.
+// p    = entire stun packet
+// size = end of its attribute area
+// key  = the HMAC key
+// returns offset of the attribute following message-integrity if it exists
+//   and is correct, else -1
+static int message_integrity_check(const quint8 *p, int size, const QByteArray &key)
 {
     int at, len, next;
-    at = find_attribute(buf, AttribMessageIntegrity, &len, &next);
+    at = find_attribute(p, size, AttribMessageIntegrity, &len, &next);
     if (at == -1 || len != 20) // value must be 20 bytes
-        return false;
+        return -1;
 
-    // prepare new attribute area size
-    int i = next - ATTRIBUTE_AREA_START;
+    quint8 header[ATTRIBUTE_AREA_START];
+    memcpy(header, p, ATTRIBUTE_AREA_START);
+    write16(header + 2, quint16(next - ATTRIBUTE_AREA_START));
 
-    // new value must be divisible by 4
-    if (i % 4 != 0)
-        return false;
+    QCA::MessageAuthenticationCode hmac("hmac(sha1)", key);
+    hmac.update(QByteArray::fromRawData((const char *)header, ATTRIBUTE_AREA_START));
+    hmac.update(QByteArray::fromRawData((const char *)p + ATTRIBUTE_AREA_START, at - ATTRIBUTE_AREA_START));
+    QByteArray micalc = hmac.final().toByteArray();
+    if (micalc.size() != 20) // no hmac(sha1) provider?
+        return -1;
+    return memcmp(p + at + 4, micalc.data(), 20) == 0 ? next : -1;
+}
 
-    // copy truncated packet
-    *out = buf.mid(0, next);
+static StunMessage::Class extract_class(const quint8 *p)
+{
+    // class bits are split into 2 sections
+    quint8 c1, c2;
+    c1 = quint8(p[0] & 0x01); // C1
+    c1 <<= 1;
+    c2 = quint8(p[1] & 0x10); // C0
+    c2 >>= 4;
 
-    // set new length in header
-    quint16 newlen = (quint16)i;
-    write16((quint8 *)out->data() + 2, newlen);
+    quint8 classbits = c1 | c2;
 
-    *offset = at;
-    return true;
+    StunMessage::Class mclass;
+    if (classbits == 0) // 00
+        mclass = StunMessage::Request;
+    else if (classbits == 1) // 01
+        mclass = StunMessage::Indication;
+    else if (classbits == 2) // 10
+        mclass = StunMessage::SuccessResponse;
+    else // 11
+        mclass = StunMessage::ErrorResponse;
+
+    return mclass;
 }
 
-// confirm message integrity
-// buf    = prepared stun packet (from message_integrity_prep())
-// offset = offset of message-integrity attribute
-// key    = the HMAC key
-// returns true if correct
-static bool message_integrity_check(const QByteArray &buf, int offset, const QByteArray &key)
+static quint16 extract_method(const quint8 *p)
 {
-    QByteArray mival  = QByteArray::fromRawData(buf.data() + offset + 4, 20);
-    QByteArray micalc = message_integrity_calc((const quint8 *)buf.data(), offset, key);
-    return mival == micalc;
+    // method bits are split into 3 sections
+    quint16 m1, m2, m3;
+    m1 = quint16(p[0] & 0x3e); // M7-11
+    m1 <<= 6;
+    m2 = quint16(p[1] & 0xe0); // M4-6
+    m2 >>= 1;
+    m3 = quint16(p[1] & 0x0f); // M0-3
+
+    return m1 | m2 | m3;
 }
 
 class StunMessage::Private : public QSharedData {
@@ -320,6 +339,12 @@ public:
     quint8             id[12];
     QList<Attribute>   attribs;
 
+    // a parsed message keeps the packet instead of attribs, and decodes
+    //   attributes from it when asked for.  attribsEnd is where its
+    //   attribute area ends
+    QByteArray packet;
+    int        attribsEnd = 0;
+
     Private()
     {
         mclass = (StunMessage::Class)-1;
@@ -370,13 +395,43 @@ const quint8 *StunMessage::id() const
 QList<StunMessage::Attribute> StunMessage::attributes() const
 {
     Q_ASSERT(d);
-    return d->attribs;
+
+    if (d->packet.isNull())
+        return d->attribs;
+
+    const quint8    *p = (const quint8 *)d->packet.constData();
+    QList<Attribute> list;
+    int              at = ATTRIBUTE_AREA_START;
+    while (1) {
+        quint16 type;
+        int     len;
+        int     next;
+
+        next = get_attribute_props(p, d->attribsEnd, at, &type, &len);
+        if (next == -1)
+            break;
+
+        Attribute attrib;
+        attrib.type  = type;
+        attrib.value = QByteArray((const char *)p + at + 4, len);
+        list += attrib;
+
+        at = next;
+    }
+    return list;
 }
 
 QByteArray StunMessage::attribute(quint16 type) const
 {
     Q_ASSERT(d);
 
+    if (!d->packet.isNull()) {
+        const quint8 *p = (const quint8 *)d->packet.constData();
+        int           len;
+        int           at = find_attribute(p, d->attribsEnd, type, &len);
+        return at != -1 ? QByteArray((const char *)p + at + 4, len) : QByteArray();
+    }
+
     for (const Attribute &i : d->attribs) {
         if (i.type == type)
             return i.value;
@@ -388,6 +443,11 @@ bool StunMessage::hasAttribute(quint16 type) const
 {
     Q_ASSERT(d);
 
+    if (!d->packet.isNull()) {
+        int len;
+        return find_attribute((const quint8 *)d->packet.constData(), d->attribsEnd, type, &len) != -1;
+    }
+
     for (const Attribute &i : d->attribs) {
         if (i.type == type)
             return true;
@@ -423,6 +483,8 @@ void StunMessage::setAttributes(const QList<Attribute> &attribs)
 {
     ENSURE_D
     d->attribs = attribs;
+    d->packet.clear();
+    d->attribsEnd = 0;
 }
 
 QByteArray StunMessage::toBinary(int validationFlags, const QByteArray &key) const
@@ -466,7 +528,8 @@ QByteArray StunMessage::toBinary(int validationFlags, const QByteArray &key) con
     memcpy(p + 4, d->magic, 4);
     memcpy(p + 8, d->id, 12);
 
-    for (const Attribute &i : d->attribs) {
+    const QList<Attribute> attribs = attributes();
+    for (const Attribute &i : attribs) {
         int at = append_attribute_uninitialized(&buf, i.type, i.value.size());
         if (at == -1)
             return QByteArray();
@@ -518,143 +581,114 @@ QByteArray StunMessage::toBinary(int validationFlags, const QByteArray &key) con
 StunMessage StunMessage::fromBinary(const QByteArray &a, ConvertResult *result, int validationFlags,
                                     const QByteArray &key)
 {
-    int mlen = check_and_get_length(a);
-    if (mlen == -1) {
-        if (result)
-            *result = ErrorFormat;
-        return StunMessage();
-    }
-
-    if (validationFlags & Fingerprint) {
-        if (!fingerprint_check(a)) {
-            if (result)
-                *result = ErrorFingerprint;
-            return StunMessage();
-        }
-    }
-
-    QByteArray in;
-
-    if (validationFlags & MessageIntegrity) {
-        int offset;
-        if (!message_integrity_prep(a, &in, &offset)) {
-            if (result)
-                *result = ErrorMessageIntegrity;
-            return StunMessage();
-        }
+    StunMessageView view(a);
+    ConvertResult   r = ConvertGood;
+    if (view.isNull())
+        r = ErrorFormat;
+    else if ((validationFlags & Fingerprint) && !view.checkFingerprint())
+        r = ErrorFingerprint;
+    else if ((validationFlags & MessageIntegrity) && !view.checkMessageIntegrity(key))
+        r = ErrorMessageIntegrity;
 
-        if (!message_integrity_check(in, offset, key)) {
-            if (result)
-                *result = ErrorMessageIntegrity;
-            return StunMessage();
-        }
-    } else
-        in = a;
-
-    // all validating complete, now just parse the packet
-
-    const quint8 *p = (const quint8 *)in.data();
-
-    // method bits are split into 3 sections
-    quint16 m1, m2, m3;
-    m1 = quint16(p[0] & 0x3e); // M7-11
-    m1 <<= 6;
-    m2 = quint16(p[1] & 0xe0); // M4-6
-    m2 >>= 1;
-    m3 = quint16(p[1] & 0x0f); // M0-3
-
-    // class bits are split into 2 sections
-    quint8 c1, c2;
-    c1 = quint8(p[0] & 0x01); // C1
-    c1 <<= 1;
-    c2 = quint8(p[1] & 0x10); // C0
-    c2 >>= 4;
-
-    quint16 method    = m1 | m2 | m3;
-    quint8  classbits = c1 | c2;
-
-    Class mclass;
-    if (classbits == 0) // 00
-        mclass = Request;
-    else if (classbits == 1) // 01
-        mclass = Indication;
-    else if (classbits == 2) // 10
-        mclass = SuccessResponse;
-    else // 11
-        mclass = ErrorResponse;
+    if (result)
+        *result = r;
+    return r == ConvertGood ? view.toMessage(validationFlags) : StunMessage();
+}
 
-    StunMessage out;
-    out.setClass(mclass);
-    out.setMethod(method);
-    out.setMagic(p + 4);
-    out.setId(p + 8);
+bool StunMessage::isProbablyStun(const QByteArray &a)
+{
+    return check_and_get_length((const quint8 *)a.constData(), a.size()) != -1;
+}
 
-    QList<Attribute> list;
-    int              at = ATTRIBUTE_AREA_START;
-    while (1) {
-        quint16 type;
-        int     len;
-        int     next;
+StunMessage::Class StunMessage::extractClass(const QByteArray &in) { return extract_class((const quint8 *)in.data()); }
 
-        next = get_attribute_props(in, at, &type, &len);
-        if (next == -1)
-            break;
+bool StunMessage::containsStun(const quint8 *data, int size)
+{
+    // check_and_get_length does a full packet check so it works even on a stream
+    return check_and_get_length(data, size) != -1;
+}
 
-        Attribute attrib;
-        attrib.type  = type;
-        attrib.value = in.mid(at + 4, len);
-        list += attrib;
+QByteArray StunMessage::readStun(const quint8 *data, int size)
+{
+    int mlen = check_and_get_length(data, size);
+    if (mlen != -1)
+        return QByteArray((const char *)data, mlen + 20);
+    else
+        return QByteArray();
+}
 
-        at = next;
+StunMessageView::StunMessageView(const quint8 *data, int size)
+{
+    int mlen = check_and_get_length(data, size);
+    if (mlen != -1) {
+        p   = data;
+        end = ATTRIBUTE_AREA_START + mlen;
     }
-    out.setAttributes(list);
-
-    if (result)
-        *result = ConvertGood;
-    return out;
 }
 
-bool StunMessage::isProbablyStun(const QByteArray &a) { return check_and_get_length(a) != -1; }
+StunMessageView::StunMessageView(const QByteArray &packet) :
+    StunMessageView((const quint8 *)packet.constData(), packet.size())
+{
+    if (p)
+        this->packet = packet;
+}
 
-StunMessage::Class StunMessage::extractClass(const QByteArray &in)
+StunMessage::Class StunMessageView::mclass() const
 {
-    const quint8 *p = (const quint8 *)in.data();
+    Q_ASSERT(p);
+    return extract_class(p);
+}
 
-    // class bits are split into 2 sections
-    quint8 c1, c2;
-    c1 = quint8(p[0] & 0x01); // C1
-    c1 <<= 1;
-    c2 = quint8(p[1] & 0x10); // C0
-    c2 >>= 4;
+quint16 StunMessageView::method() const
+{
+    Q_ASSERT(p);
+    return extract_method(p);
+}
 
-    quint8 classbits = c1 | c2;
+const quint8 *StunMessageView::attribute(quint16 type, int *len) const
+{
+    Q_ASSERT(p);
+    int at = find_attribute(p, end, type, len);
+    return at != -1 ? p + at + 4 : nullptr;
+}
 
-    Class mclass;
-    if (classbits == 0) // 00
-        mclass = Request;
-    else if (classbits == 1) // 01
-        mclass = Indication;
-    else if (classbits == 2) // 10
-        mclass = SuccessResponse;
-    else // 11
-        mclass = ErrorResponse;
+bool StunMessageView::hasAttribute(quint16 type) const
+{
+    int len;
+    return attribute(type, &len) != nullptr;
+}
 
-    return mclass;
+bool StunMessageView::checkFingerprint() const
+{
+    Q_ASSERT(p);
+    return fingerprint_check(p, end);
 }
 
-bool StunMessage::containsStun(const quint8 *data, int size)
+bool StunMessageView::checkMessageIntegrity(const QByteArray &key) const
 {
-    // check_and_get_length does a full packet check so it works even on a stream
-    return check_and_get_length(QByteArray::fromRawData((const char *)data, size)) != -1;
+    Q_ASSERT(p);
+    return message_integrity_check(p, end, key) != -1;
 }
 
-QByteArray StunMessage::readStun(const quint8 *data, int size)
+StunMessage StunMessageView::toMessage(int validationFlags) const
 {
-    QByteArray in   = QByteArray::fromRawData((const char *)data, size);
-    int        mlen = check_and_get_length(in);
-    if (mlen != -1)
-        return QByteArray((const char *)data, mlen + 20);
-    else
-        return QByteArray();
+    Q_ASSERT(p);
+
+    StunMessage out;
+    out.d         = new StunMessage::Private;
+    out.d->mclass = extract_class(p);
+    out.d->method = extract_method(p);
+    memcpy(out.d->magic, p + 4, 4);
+    memcpy(out.d->id, p + 8, 12);
+    out.d->packet     = packet.isNull() ? QByteArray((const char *)p, end) : packet;
+    out.d->attribsEnd = end;
+
+    if (validationFlags & StunMessage::MessageIntegrity) {
+        int len, next;
+        if (find_attribute(p, end, AttribMessageIntegrity, &len, &next) != -1)
+            out.d->attribsEnd = next;
+    }
+
+    return out;
 }
 } // namespace XMPP
@@ -24,6 +24,8 @@
 #include <QSharedDataPointer>
 
 namespace XMPP {
+class StunMessageView;
+
 class StunMessage {
 public:
     enum Class { Request, SuccessResponse, ErrorResponse, Indication };
@@ -65,7 +67,10 @@ public:
     void setId(const quint8 *id);       // 12 bytes
     void setAttributes(const QList<Attribute> &attribs);
 
-    QByteArray         toBinary(int validationFlags = 0, const QByteArray &key = QByteArray()) const;
+    QByteArray toBinary(int validationFlags = 0, const QByteArray &key = QByteArray()) const;
+
+    // the message refers to the data of 'a' instead of copying it, and
+    //   attributes are only decoded when asked for
     static StunMessage fromBinary(const QByteArray &a, ConvertResult *result = nullptr, int validationFlags = 0,
                                   const QByteArray &key = QByteArray());
 
@@ -85,9 +90,47 @@ public:
     static QByteArray readStun(const quint8 *data, int size);
 
 private:
+    friend class StunMessageView;
+
     class Private;
     QSharedDataPointer<Private> d;
 };
+
+// a stun packet read in place.  a packet that fails the 3-field check gives a
+//   null view, so media and ChannelData are turned down after a few byte
+//   compares.  validation doesn't copy the packet and nothing is decoded
+//   until toMessage(), so a response nobody waits for costs no allocations.
+//   the view doesn't own the data, it must stay valid while the view is used
+class StunMessageView {
+public:
+    StunMessageView() = default;
+    StunMessageView(const quint8 *data, int size);
+    explicit StunMessageView(const QByteArray &packet); // toMessage() will share the packet
+
+    bool               isNull() const { return !p; }
+    int                size() const { return end; } // header included
+    StunMessage::Class mclass() const;
+    quint16            method() const;
+    const quint8      *magic() const { return p + 4; } // 4 bytes
+    const quint8      *id() const { return p + 8; }    // 12 bytes
+
+    // returns the value of the first instance in the packet or null
+    const quint8 *attribute(quint16 type, int *len) const;
+    bool          hasAttribute(quint16 type) const;
+
+    bool checkFingerprint() const;
+    bool checkMessageIntegrity(const QByteArray &key) const;
+
+    // validationFlags are the checks the packet has passed.  as with
+    //   fromBinary(), attributes after message-integrity are dropped when
+    //   it is among them
+    StunMessage toMessage(int validationFlags = 0) const;
+
+private:
+    const quint8 *p   = nullptr;
+    int           end = 0;
+    QByteArray    packet;
+};
 } // namespace XMPP
 
 #endif // STUNMESSAGE_H
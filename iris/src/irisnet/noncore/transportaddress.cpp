@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "transportaddress.h"
+
+#ifdef Q_OS_UNIX
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
+namespace XMPP {
+
+#ifdef Q_OS_UNIX
+TransportAddress TransportAddress::fromSockAddr(const sockaddr *sa)
+{
+    TransportAddress ta;
+    if (sa->sa_family == AF_INET6) {
+        auto sa6 = reinterpret_cast<const sockaddr_in6 *>(sa);
+        ta.addr.setAddress(sa6->sin6_addr.s6_addr);
+        ta.port = ntohs(sa6->sin6_port);
+        if (sa6->sin6_scope_id) {
+            // otherwise it's not equal to the same peer read by QUdpSocket
+            char name[IF_NAMESIZE];
+            if (::if_indextoname(sa6->sin6_scope_id, name))
+                ta.addr.setScopeId(QString::fromLatin1(name));
+            else
+                ta.addr.setScopeId(QString::number(sa6->sin6_scope_id));
+        }
+    } else if (sa->sa_family == AF_INET) {
+        auto sa4 = reinterpret_cast<const sockaddr_in *>(sa);
+        ta.addr.setAddress(ntohl(sa4->sin_addr.s_addr));
+        ta.port = ntohs(sa4->sin_port);
+    }
+    return ta;
+}
+#endif
+
+} // namespace XMPP
@@ -3,6 +3,10 @@
 
 #include <QHostAddress>
 
+#ifdef Q_OS_UNIX
+struct sockaddr;
+#endif
+
 namespace XMPP {
 
 class TransportAddress {
@@ -13,6 +17,11 @@ public:
     TransportAddress() = default;
     TransportAddress(const QHostAddress &_addr, quint16 _port) : addr(_addr), port(_port) { }
 
+#ifdef Q_OS_UNIX
+    // sockaddr_in or sockaddr_in6 the way QUdpSocket reads it, with the interface of link-local addresses
+    static TransportAddress fromSockAddr(const sockaddr *sa);
+#endif
+
     bool isValid() const { return !addr.isNull(); }
     bool operator==(const TransportAddress &other) const { return addr == other.addr && port == other.port; }
 
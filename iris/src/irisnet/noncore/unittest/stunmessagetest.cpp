@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "irisnet/noncore/stunmessage.h"
+#include "irisnet/noncore/stuntypes.h"
+#include "qttestutil/qttestutil.h"
+
+#include <QObject>
+#include <QtCrypto>
+#include <QtTest/QtTest>
+
+using namespace XMPP;
+
+class StunMessageTest : public QObject {
+    Q_OBJECT
+
+    QCA::Initializer qcaInit;
+    const QByteArray key = "secret";
+
+    // a binding request with a username and a priority, signed with key
+    QByteArray request() const
+    {
+        StunMessage msg;
+        msg.setClass(StunMessage::Request);
+        msg.setMethod(StunTypes::Binding);
+        const quint8 id[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+        msg.setId(id);
+
+        QList<StunMessage::Attribute> list;
+        StunMessage::Attribute        attr;
+        attr.type  = StunTypes::USERNAME;
+        attr.value = "alice:bob";
+        list += attr;
+        attr.type  = StunTypes::PRIORITY;
+        attr.value = QByteArray("\x6e\x00\x01\xff", 4);
+        list += attr;
+        msg.setAttributes(list);
+
+        return msg.toBinary(StunMessage::MessageIntegrity | StunMessage::Fingerprint, key);
+    }
+
+private slots:
+    void initTestCase()
+    {
+        if (!QCA::isSupported("hmac(sha1)"))
+            QSKIP("hmac(sha1) is not supported by QCA");
+    }
+
+    void testNotStun()
+    {
+        QByteArray channelData("\x40\x00\x00\x10", 4);
+        channelData += QByteArray(16, 'x');
+        QByteArray rtp("\x80\x60\x12\x34", 4);
+        rtp += QByteArray(160, 'x');
+        QByteArray dtls("\x16\xfe\xfd\x00", 4);
+        dtls += QByteArray(60, 'x');
+        QByteArray shortPacket = request().left(19);
+
+        for (const QByteArray &a : { channelData, rtp, dtls, shortPacket }) {
+            QVERIFY(StunMessageView(a).isNull());
+            QVERIFY(!StunMessage::isProbablyStun(a));
+        }
+    }
+
+    void testView()
+    {
+        const QByteArray buf = request();
+        StunMessageView  view(buf);
+        QVERIFY(!view.isNull());
+        QCOMPARE(view.size(), buf.size());
+        QCOMPARE(view.mclass(), StunMessage::Request);
+        QCOMPARE(view.method(), quint16(StunTypes::Binding));
+        QCOMPARE(view.id()[11], quint8(12));
+
+        int           len;
+        const quint8 *user = view.attribute(StunTypes::USERNAME, &len);
+        QVERIFY(user);
+        QVERIFY((const char *)user > buf.constData() && (const char *)user < buf.constData() + buf.size()); // in place
+        QCOMPARE(QByteArray((const char *)user, len), QByteArray("alice:bob"));
+        QVERIFY(!view.hasAttribute(StunTypes::USE_CANDIDATE));
+
+        QVERIFY(view.checkFingerprint());
+        QVERIFY(view.checkMessageIntegrity(key));
+        QVERIFY(!view.checkMessageIntegrity("wrong"));
+    }
+
+    void testFromBinary()
+    {
+        QByteArray                 buf = request();
+        StunMessage::ConvertResult result;
+        int                        flags = StunMessage::MessageIntegrity | StunMessage::Fingerprint;
+
+        StunMessage msg = StunMessage::fromBinary(buf, &result, flags, key);
+        QCOMPARE(result, StunMessage::ConvertGood);
+        QCOMPARE(msg.attribute(StunTypes::USERNAME), QByteArray("alice:bob"));
+        QVERIFY(msg.hasAttribute(StunTypes::PRIORITY));
+        QCOMPARE(msg.attributes().count(), 3); // fingerprint is not covered by message-integrity
+
+        QCOMPARE(StunMessage::fromBinary(buf).attributes().count(), 4);
+
+        StunMessage::fromBinary(buf, &result, flags, "wrong");
+        QCOMPARE(result, StunMessage::ErrorMessageIntegrity);
+
+        buf[24] = 'A'; // the username
+        StunMessage::fromBinary(buf, &result, flags, key);
+        QCOMPARE(result, StunMessage::ErrorFingerprint);
+    }
+
+    void testModifyParsed()
+    {
+        StunMessage msg = StunMessage::fromBinary(request());
+        StunMessage copy(msg);
+        copy.setAttributes({});
+        QVERIFY(!copy.hasAttribute(StunTypes::USERNAME));
+        QVERIFY(msg.hasAttribute(StunTypes::USERNAME));
+
+        // re-encoding a parsed message keeps its attributes
+        StunMessage again = StunMessage::fromBinary(msg.toBinary());
+        QCOMPARE(again.attribute(StunTypes::USERNAME), QByteArray("alice:bob"));
+        QCOMPARE(again.attributes().count(), 4);
+    }
+
+    void benchmarkRejectMedia()
+    {
+        QByteArray rtp("\x80\x60\x12\x34", 4);
+        rtp += QByteArray(1200, 'x');
+        QBENCHMARK
+        {
+            StunMessageView view(rtp);
+            QVERIFY(view.isNull());
+        }
+    }
+
+    void benchmarkParseResponse()
+    {
+        const QByteArray buf = request();
+        QBENCHMARK
+        {
+            StunMessageView view(buf);
+            QVERIFY(view.checkFingerprint() && view.checkMessageIntegrity(key));
+            QVERIFY(!view.toMessage(StunMessage::MessageIntegrity).attribute(StunTypes::USERNAME).isNull());
+        }
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(StunMessageTest);
+#include "stunmessagetest.moc"
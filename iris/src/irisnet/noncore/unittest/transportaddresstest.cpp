@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "irisnet/noncore/transportaddress.h"
+#include "qttestutil/qttestutil.h"
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+#include <arpa/inet.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+using namespace XMPP;
+
+class TransportAddressTest : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testLinkLocalSource()
+    {
+        // loopback is there on every host. its index is as good as any for the scope
+        unsigned index = ::if_nametoindex("lo");
+        if (!index)
+            index = ::if_nametoindex("lo0");
+        QVERIFY(index);
+        char name[IF_NAMESIZE];
+        QVERIFY(::if_indextoname(index, name));
+
+        sockaddr_in6 sa {};
+        sa.sin6_family = AF_INET6;
+        sa.sin6_port   = htons(3478);
+        QCOMPARE(::inet_pton(AF_INET6, "fe80::1:2", &sa.sin6_addr), 1);
+        sa.sin6_scope_id = index;
+
+        // the way QUdpSocket reports the same peer
+        QHostAddress expected(QString::fromLatin1("fe80::1:2%") + QString::fromLatin1(name));
+
+        auto ta = TransportAddress::fromSockAddr(reinterpret_cast<const sockaddr *>(&sa));
+        QCOMPARE(ta.port, quint16(3478));
+        QCOMPARE(ta.addr.scopeId(), QString::fromLatin1(name));
+        QCOMPARE(ta, TransportAddress(expected, 3478));
+        QVERIFY(ta.addr != QHostAddress(QString::fromLatin1("fe80::1:2")));
+    }
+
+    void testIPv4Source()
+    {
+        sockaddr_in sa {};
+        sa.sin_family = AF_INET;
+        sa.sin_port   = htons(5000);
+        QCOMPARE(::inet_pton(AF_INET, "192.0.2.7", &sa.sin_addr), 1);
+
+        auto ta = TransportAddress::fromSockAddr(reinterpret_cast<const sockaddr *>(&sa));
+        QCOMPARE(ta, TransportAddress(QHostAddress(QString::fromLatin1("192.0.2.7")), 5000));
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(TransportAddressTest);
+#include "transportaddresstest.moc"
@@ -25,6 +25,9 @@
 
 #include "qstringprep.h"
 #include <QCoreApplication>
+#include <QSet>
+
+#include <cstring>
 
 using namespace XMPP;
 
@@ -33,60 +36,88 @@ using namespace XMPP;
 //----------------------------------------------------------------------------
 std::unique_ptr<StringPrepCache> StringPrepCache::_instance;
 
-bool StringPrepCache::nameprep(const QString &in, int maxbytes, QString &out)
+enum AsciiPrep { NotAscii, AsciiValid, AsciiInvalid };
+
+/*
+ * For ascii input the profiles below only case fold (nameprep, nodeprep) and prohibit
+ * some characters (rfc3491, rfc6122 appendixes A and B), so there is no need for full stringprep.
+ * Lowercasing is done only when there is something to lowercase, so usually \a out shares \a in.
+ * Characters below \a minChar are prohibited and so is DEL if any of them are.
+ */
+static AsciiPrep asciiPrep(const QString &in, const char *prohibited, bool fold, uint minChar, QString &out)
 {
-    if (in.trimmed().isEmpty()) {
-        out = QString();
-        return false; // empty names or just spaces are disallowed (rfc5892+rfc6122)
+    bool hasUpper = false;
+    for (QChar c : in) {
+        ushort u = c.unicode();
+        if (u >= 0x80)
+            return NotAscii;
+        if (u < minChar || (minChar && u == 0x7f) || (prohibited && std::strchr(prohibited, char(u))))
+            return AsciiInvalid;
+        hasUpper |= (u >= 'A' && u <= 'Z');
     }
+    out = (fold && hasUpper) ? in.toLower() : in;
+    return AsciiValid;
+}
 
-    StringPrepCache *that = instance();
-
-    auto it = that->nameprep_table.constFind(in);
-    if (it != that->nameprep_table.constEnd()) {
-        if (it.value().isNull()) {
+bool StringPrepCache::cached(QCache<QString, QString> &table, const Stringprep_table *profile, const QString &in,
+                             int maxbytes, QString &out)
+{
+    QString *res = table.object(in);
+    if (res) {
+        stats_.hits++;
+        if (res->isNull()) {
             return false;
         }
-        out = it.value();
+        out = *res;
         return true;
     }
 
+    stats_.misses++;
     out = in;
-    if (stringprep(out, (Stringprep_profile_flags)0, stringprep_nameprep) != 0 || out.size() > maxbytes) {
-        that->nameprep_table.insert(in, QString());
+    if (stringprep(out, (Stringprep_profile_flags)0, profile) != 0 || out.size() > maxbytes) {
+        table.insert(in, new QString());
         return false;
     }
 
-    that->nameprep_table.insert(in, out);
+    table.insert(in, new QString(out));
     return true;
 }
 
-bool StringPrepCache::nodeprep(const QString &in, int maxbytes, QString &out)
+bool StringPrepCache::nameprep(const QString &in, int maxbytes, QString &out)
 {
-    if (in.isEmpty()) {
+    if (in.trimmed().isEmpty()) {
         out = QString();
-        return true;
+        return false; // empty names or just spaces are disallowed (rfc5892+rfc6122)
     }
 
     StringPrepCache *that = instance();
 
-    auto it = that->nodeprep_table.constFind(in);
-    if (it != that->nodeprep_table.constEnd()) {
-        if (it.value().isNull()) {
-            return false;
-        }
-        out = it.value();
+    auto ascii = asciiPrep(in, nullptr, true, 0, out);
+    if (ascii != NotAscii) {
+        that->stats_.ascii++;
+        return ascii == AsciiValid && out.size() <= maxbytes;
+    }
+
+    return that->cached(that->nameprep_table, stringprep_nameprep, in, maxbytes, out);
+}
+
+bool StringPrepCache::nodeprep(const QString &in, int maxbytes, QString &out)
+{
+    if (in.isEmpty()) {
+        out = QString();
         return true;
     }
 
-    out = in;
-    if (stringprep(out, (Stringprep_profile_flags)0, stringprep_xmpp_nodeprep) != 0 || out.size() > maxbytes) {
-        that->nodeprep_table.insert(in, QString());
-        return false;
+    StringPrepCache *that = instance();
+
+    // space and controls (C.1.1, C.2.1) and the nodeprep specific ones (appendix A.5)
+    auto ascii = asciiPrep(in, "\"&'/:<>@", true, 0x21, out);
+    if (ascii != NotAscii) {
+        that->stats_.ascii++;
+        return ascii == AsciiValid && out.size() <= maxbytes;
     }
 
-    that->nodeprep_table.insert(in, out);
-    return true;
+    return that->cached(that->nodeprep_table, stringprep_xmpp_nodeprep, in, maxbytes, out);
 }
 
 bool StringPrepCache::resourceprep(const QString &in, int maxbytes, QString &out)
@@ -98,23 +129,14 @@ bool StringPrepCache::resourceprep(const QString &in, int maxbytes, QString &out
 
     StringPrepCache *that = instance();
 
-    auto it = that->resourceprep_table.constFind(in);
-    if (it != that->resourceprep_table.constEnd()) {
-        if (it.value().isNull()) {
-            return false;
-        }
-        out = it.value();
-        return true;
+    // controls only (C.2.1). ascii space is allowed in resources
+    auto ascii = asciiPrep(in, nullptr, false, 0x20, out);
+    if (ascii != NotAscii) {
+        that->stats_.ascii++;
+        return ascii == AsciiValid && out.size() <= maxbytes;
     }
 
-    out = in;
-    if (stringprep(out, (Stringprep_profile_flags)0, stringprep_xmpp_resourceprep) != 0 || out.size() > maxbytes) {
-        that->resourceprep_table.insert(in, QString());
-        return false;
-    }
-
-    that->resourceprep_table.insert(in, out);
-    return true;
+    return that->cached(that->resourceprep_table, stringprep_xmpp_resourceprep, in, maxbytes, out);
 }
 
 bool StringPrepCache::saslprep(const QString &in, int maxbytes, QString &out)
@@ -125,24 +147,20 @@ bool StringPrepCache::saslprep(const QString &in, int maxbytes, QString &out)
     }
 
     StringPrepCache *that = instance();
+    return that->cached(that->saslprep_table, stringprep_saslprep, in, maxbytes, out);
+}
 
-    auto it = that->saslprep_table.constFind(in);
-    if (it != that->saslprep_table.constEnd()) {
-        if (it.value().isNull()) {
-            return false;
-        }
-        out = it.value();
-        return true;
-    }
+StringPrepCache::Stats StringPrepCache::stats() { return instance()->stats_; }
 
-    out = in;
-    if (stringprep(out, (Stringprep_profile_flags)0, stringprep_saslprep) != 0 || out.size() > maxbytes) {
-        that->saslprep_table.insert(in, QString());
-        return false;
-    }
+int StringPrepCache::capacity() { return int(instance()->nameprep_table.maxCost()); }
 
-    that->saslprep_table.insert(in, out);
-    return true;
+void StringPrepCache::setCapacity(int entries)
+{
+    StringPrepCache *that = instance();
+    that->nameprep_table.setMaxCost(entries);
+    that->nodeprep_table.setMaxCost(entries);
+    that->resourceprep_table.setMaxCost(entries);
+    that->saslprep_table.setMaxCost(entries);
 }
 
 void StringPrepCache::cleanup() { _instance.reset(nullptr); }
@@ -158,7 +176,11 @@ StringPrepCache *StringPrepCache::instance()
     return _instance.get();
 }
 
-StringPrepCache::StringPrepCache() { }
+StringPrepCache::StringPrepCache() :
+    nameprep_table(DefaultCapacity), nodeprep_table(DefaultCapacity), resourceprep_table(DefaultCapacity),
+    saslprep_table(DefaultCapacity)
+{
+}
 
 //----------------------------------------------------------------------------
 // Jid
@@ -173,6 +195,46 @@ static inline bool validResource(const QString &s, QString &norm)
     return StringPrepCache::resourceprep(s, 1024, norm);
 }
 
+/*
+ * Table of bare jids and domains shared by all the jids. An atom is dropped when nothing
+ * but the table refers to it any more, which is checked each time the table doubles.
+ */
+class JidAtoms {
+public:
+    static QString intern(const QString &s)
+    {
+        static JidAtoms table;
+        return table.find(s);
+    }
+
+private:
+    QString find(const QString &s)
+    {
+        auto it = atoms.constFind(s);
+        if (it != atoms.constEnd())
+            return *it;
+        if (atoms.size() >= purgeAt)
+            purge();
+        QString atom(s.constData(), s.size()); // own copy. s may be a raw data string
+        atoms.insert(atom);
+        return atom;
+    }
+
+    void purge()
+    {
+        for (auto it = atoms.begin(); it != atoms.end();) {
+            if (it->isDetached())
+                it = atoms.erase(it);
+            else
+                ++it;
+        }
+        purgeAt = qMax(int(atoms.size()) * 2, 1024);
+    }
+
+    QSet<QString> atoms;
+    int           purgeAt = 1024;
+};
+
 Jid::Jid()
 {
     valid = false;
@@ -206,6 +268,7 @@ void Jid::reset()
     d     = QString();
     n     = QString();
     r     = QString();
+    h     = 0;
     valid = false;
     null  = true;
 }
@@ -213,14 +276,21 @@ void Jid::reset()
 void Jid::update()
 {
     // build 'bare' and 'full' jids
+    d = JidAtoms::intern(d);
     if (n.isEmpty())
         b = d;
     else
-        b = n + '@' + d;
+        b = JidAtoms::intern(n + '@' + d);
     if (r.isEmpty())
         f = b;
     else
         f = b + '/' + r;
+    // seeded per process like QHash itself, so a peer choosing resources can't make them collide
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    h = qHash(f, uint(qGlobalQHashSeed()));
+#else
+    h = qHash(f, QHashSeed::globalSeed());
+#endif
     if (f.isEmpty())
         valid = false;
     null = f.isEmpty() && r.isEmpty();
@@ -355,5 +425,8 @@ bool Jid::compare(const Jid &a, bool compareRes) const
     if (!valid || !a.valid)
         return false;
 
-    return !(compareRes ? (f != a.f) : (b != a.b));
+    // bare parts are interned, so equal ones are the same string
+    if (b.constData() != a.b.constData())
+        return false;
+    return !compareRes || (h == a.h && r == a.r);
 }
@@ -21,32 +21,63 @@
 #define XMPP_JID_H
 
 #include <QByteArray>
+#include <QCache>
 #include <QHash>
 #include <QString>
 #include <memory>
 
+struct Stringprep_table;
+
 namespace XMPP {
+/*
+ * Bounded LRU cache of stringprep results.
+ *
+ * Pure ASCII nodes, domains and resources are checked and normalized in place without
+ * stringprep and without touching the cache. Other strings are cached per profile,
+ * failures too (as null strings), and the least recently used ones are dropped when
+ * a table has more than capacity() entries.
+ */
 class StringPrepCache {
 public:
+    struct Stats {
+        quint64 hits   = 0; // found in the cache
+        quint64 misses = 0; // went to stringprep
+        quint64 ascii  = 0; // handled by the ascii fast path
+    };
+
+    static constexpr int DefaultCapacity = 4096;
+
     static bool nameprep(const QString &in, int maxbytes, QString &out);
     static bool nodeprep(const QString &in, int maxbytes, QString &out);
     static bool resourceprep(const QString &in, int maxbytes, QString &out);
     static bool saslprep(const QString &in, int maxbytes, QString &out);
 
-    static void cleanup();
+    static Stats stats();
+    static int   capacity();
+    static void  setCapacity(int entries); // per profile
+    static void  cleanup();
 
 private:
-    QHash<QString, QString> nameprep_table;
-    QHash<QString, QString> nodeprep_table;
-    QHash<QString, QString> resourceprep_table;
-    QHash<QString, QString> saslprep_table;
+    QCache<QString, QString> nameprep_table;
+    QCache<QString, QString> nodeprep_table;
+    QCache<QString, QString> resourceprep_table;
+    QCache<QString, QString> saslprep_table;
+    Stats                    stats_;
 
     static std::unique_ptr<StringPrepCache> _instance;
     static StringPrepCache                 *instance();
 
+    bool cached(QCache<QString, QString> &table, const Stringprep_table *profile, const QString &in, int maxbytes,
+                QString &out);
+
     StringPrepCache();
 };
 
+/*
+ * Domain and bare parts are interned: all the jids with the same bare jid (or domain)
+ * share one string from a global table, so equal bare parts are compared by pointer.
+ * The hash of the full jid is computed once when the jid is set, with the per process QHash seed.
+ */
 class Jid {
 public:
     Jid();
@@ -72,6 +103,7 @@ public:
     bool        isValid() const;
     bool        isEmpty() const;
     bool        compare(const Jid &a, bool compareRes = true) const;
+    size_t      hash() const { return h; }
     inline bool operator==(const Jid &other) const { return compare(other, true); }
     inline bool operator!=(const Jid &other) const { return !(*this == other); }
 
@@ -88,18 +120,19 @@ private:
     void update();
 
     QString f, b, d, n, r;
+    size_t  h = 0;
     bool    valid, null;
 };
 
 #if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
 Q_DECL_PURE_FUNCTION inline uint qHash(const XMPP::Jid &key, uint seed = 0) Q_DECL_NOTHROW
 {
-    return qHash(key.full(), seed);
+    return qHash(uint(key.hash()), seed);
 }
 #else
 Q_DECL_PURE_FUNCTION inline size_t qHash(const XMPP::Jid &key, size_t seed = 0) Q_DECL_NOTHROW
 {
-    return qHash(key.full(), seed);
+    return qHashMulti(seed, key.hash());
 }
 #endif
 
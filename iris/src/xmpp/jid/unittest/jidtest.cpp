@@ -18,8 +18,9 @@
 
 // FIXME: Complete this
 
-#include "xmpp/jid/jid.h"
+#include "qstringprep.h"
 #include "qttestutil/qttestutil.h"
+#include "xmpp/jid/jid.h"
 
 #include <QObject>
 #include <QtTest/QtTest>
@@ -38,6 +39,150 @@ private slots:
         QCOMPARE(testling.domain(), QString("bar"));
         QCOMPARE(testling.resource(), QString("baz"));
     }
+
+    void testInternedCompare()
+    {
+        Jid a("Romeo@Example.net/Orchard");
+        Jid b(QString("romeo"), QString("example.net"), QString("Orchard"));
+        QCOMPARE(a, b);
+        QCOMPARE(qHash(a), qHash(b));
+        QCOMPARE(a.bare().constData(), b.bare().constData()); // the same atom
+        QCOMPARE(a.domain().constData(), Jid("juliet@example.net").domain().constData());
+
+        Jid c("romeo@example.net/balcony");
+        QVERIFY(a != c);
+        QVERIFY(a.compare(c, false));
+        QVERIFY(a.withResource("") == Jid("romeo@example.net"));
+        QVERIFY(Jid() == Jid());
+        QVERIFY(Jid() != a);
+    }
+
+    void testAsciiFastPathMatchesStringprep_data()
+    {
+        QTest::addColumn<QString>("input");
+        QTest::newRow("plain") << QString("romeo");
+        QTest::newRow("upper") << QString("Romeo.Montague");
+        QTest::newRow("space") << QString("romeo montague");
+        QTest::newRow("control") << QString("ro\tmeo");
+        QTest::newRow("del") << QString("romeo\x7f");
+        QTest::newRow("quote") << QString("ro\"meo");
+        QTest::newRow("at") << QString("romeo@home");
+        QTest::newRow("slash") << QString("romeo/home");
+        QTest::newRow("colon") << QString("romeo:home");
+        QTest::newRow("symbols") << QString("r!#$%()*+,-.;=?[]^_`{|}~");
+    }
+
+    void testAsciiFastPathMatchesStringprep()
+    {
+        QFETCH(QString, input);
+        const struct {
+            bool (*prep)(const QString &, int, QString &);
+            const Stringprep_profile *profile;
+        } profiles[] = { { StringPrepCache::nameprep, stringprep_nameprep },
+                         { StringPrepCache::nodeprep, stringprep_xmpp_nodeprep },
+                         { StringPrepCache::resourceprep, stringprep_xmpp_resourceprep } };
+
+        for (const auto &p : profiles) {
+            QString expected = input;
+            bool    ok       = stringprep(expected, (Stringprep_profile_flags)0, p.profile) == 0;
+            QString out;
+            QCOMPARE(p.prep(input, 1024, out), ok);
+            if (ok)
+                QCOMPARE(out, expected);
+        }
+    }
+
+    void testNonAsciiIsCached()
+    {
+        auto    before = StringPrepCache::stats();
+        QString out;
+        QVERIFY(StringPrepCache::nodeprep(QString::fromUtf8("J\xc3\xbcrgen"), 1024, out));
+        QCOMPARE(out, QString::fromUtf8("j\xc3\xbcrgen"));
+        QVERIFY(StringPrepCache::nodeprep(QString::fromUtf8("J\xc3\xbcrgen"), 1024, out));
+        auto after = StringPrepCache::stats();
+        QCOMPARE(after.misses - before.misses, quint64(1));
+        QCOMPARE(after.hits - before.hits, quint64(1));
+
+        QVERIFY(StringPrepCache::nodeprep("juliet", 1024, out));
+        QCOMPARE(StringPrepCache::stats().ascii - after.ascii, quint64(1));
+    }
+
+    void testCacheIsBounded()
+    {
+        StringPrepCache::setCapacity(16);
+        QString out;
+        for (int i = 0; i < 100; ++i)
+            StringPrepCache::resourceprep(QString::fromUtf8("r\xc3\xa9sum\xc3\xa9 %1").arg(i), 1024, out);
+        auto before = StringPrepCache::stats();
+        StringPrepCache::resourceprep(QString::fromUtf8("r\xc3\xa9sum\xc3\xa9 99"), 1024, out); // most recent
+        StringPrepCache::resourceprep(QString::fromUtf8("r\xc3\xa9sum\xc3\xa9 0"), 1024, out);  // evicted
+        auto after = StringPrepCache::stats();
+        QCOMPARE(after.hits - before.hits, quint64(1));
+        QCOMPARE(after.misses - before.misses, quint64(1));
+        StringPrepCache::setCapacity(StringPrepCache::DefaultCapacity);
+    }
+
+    void benchmarkMucJids_data()
+    {
+        QTest::addColumn<int>("capacity");
+        QTest::newRow("cached") << int(StringPrepCache::DefaultCapacity);
+        QTest::newRow("uncached") << 0; // every non-ascii part goes to stringprep
+    }
+
+    // occupants of a busy room. mostly ascii, some accented, cyrillic, cjk, arabic and emoji nicks
+    void benchmarkMucJids()
+    {
+        QFETCH(int, capacity);
+        static const char *const nicks[]
+            = { "alice",         "Bob",         "charlie_42",       "dave.w",          "Eve (away)",
+                "frank",         "GRACE",       "heidi-mobile",     "ivan",            "judy|work",
+                "Mallory",       "oscar",       "peggy ~",          "trent",           "victor",
+                "walter",        "Zoë",         "Jürgen",           "François",        "Małgorzata",
+                "Øyvind",        "Ñandú",       "Ярослав",          "Наталья Петрова", "Сергей",
+                "王小明",        "さくら",      "김민수",           "محمد",            "Δημήτρης",
+                "Ünal Çelik",    "José María",  "日本語ユーザー",   "Łukasz",          "Ärger",
+                "kitty 🐱",      "🚀 launcher", "ｆｕｌｌｗｉｄｔｈ", "İstanbul",        "ß-strasse" };
+
+        QStringList resources;
+        for (const char *nick : nicks)
+            resources << QString::fromUtf8(nick);
+
+        StringPrepCache::setCapacity(capacity);
+        QBENCHMARK
+        {
+            for (const QString &nick : std::as_const(resources)) {
+                Jid j(QStringLiteral("room@conference.example.org/") + nick);
+                Q_UNUSED(j)
+            }
+        }
+        StringPrepCache::setCapacity(StringPrepCache::DefaultCapacity);
+    }
+
+    // 10k contacts on 50 servers coming online with 2 resources each, tracked in a hash like
+    // presence handling and avatar/vcard factories do
+    void benchmarkRosterReplay()
+    {
+        QStringList strings;
+        for (int i = 0; i < 10000; ++i) {
+            QString bare = QString("contact%1@server%2.example.org").arg(i).arg(i % 50);
+            strings << bare + "/desktop" << bare + "/phone";
+        }
+
+        QBENCHMARK
+        {
+            QHash<Jid, int> resources;
+            QList<Jid>      jids;
+            for (const QString &s : std::as_const(strings)) {
+                Jid j(s);
+                jids << j;
+                resources[j.withResource(QString())]++;
+            }
+            int matched = 0;
+            for (int i = 0; i + 1 < jids.size(); i += 2)
+                matched += jids[i].compare(jids[i + 1], false) ? resources.value(jids[i].withResource(QString())) : 0;
+            QCOMPARE(matched, 20000);
+        }
+    }
 };
 
 QTTESTUTIL_REGISTER_TEST(JidTest);
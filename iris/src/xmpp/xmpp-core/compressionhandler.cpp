@@ -3,15 +3,20 @@
 #include "xmpp/zlib/zlibdecompressor.h"
 
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QTimer>
 
-CompressionHandler::CompressionHandler() : errorCode_(0)
+#define BUFFER_SIZE 16384
+
+CompressionHandler::CompressionHandler(int level) : errorCode_(0)
 {
-    outgoing_buffer_.open(QIODevice::ReadWrite);
-    compressor_ = new ZLibCompressor(&outgoing_buffer_);
+    compressor_   = new ZLibCompressor(level);
+    decompressor_ = new ZLibDecompressor();
 
-    incoming_buffer_.open(QIODevice::ReadWrite);
-    decompressor_ = new ZLibDecompressor(&incoming_buffer_);
+    // reserve() also makes resize(0) keep the memory with Qt5
+    pending_.reserve(BUFFER_SIZE);
+    outgoing_.reserve(BUFFER_SIZE);
+    incoming_.reserve(BUFFER_SIZE);
 }
 
 CompressionHandler::~CompressionHandler()
@@ -24,41 +29,74 @@ void CompressionHandler::writeIncoming(const QByteArray &a)
 {
     // qDebug("CompressionHandler::writeIncoming");
     // qDebug() << QString("Incoming %1 bytes").arg(a.size());
-    errorCode_ = int(decompressor_->write(a));
-    if (!errorCode_)
-        QTimer::singleShot(0, this, SIGNAL(readyRead()));
-    else
+    if (incomingRead_) {
+        incoming_.resize(0); // no reallocation unless the reader still holds the previous data
+        incomingRead_ = false;
+    }
+    auto          before = incoming_.size();
+    QElapsedTimer timer;
+    timer.start();
+    errorCode_ = decompressor_->decompress(a, incoming_);
+    stats_.inflateNsecs += timer.nsecsElapsed();
+    stats_.compressedIn += a.size();
+    stats_.plainIn += incoming_.size() - before;
+
+    if (errorCode_)
         QTimer::singleShot(0, this, SIGNAL(error()));
+    else if (!readScheduled_) {
+        readScheduled_ = true;
+        QTimer::singleShot(0, this, [this]() {
+            readScheduled_ = false;
+            emit readyRead();
+        });
+    }
 }
 
+// ClientStream writes all it corked during an event loop iteration at once, so it's one sync flush per batch
 void CompressionHandler::write(const QByteArray &a)
 {
     // qDebug() << QString("CompressionHandler::write(%1)").arg(a.size());
-    errorCode_ = compressor_->write(a);
+    if (a.isEmpty())
+        return;
+
+    if (outgoingRead_) {
+        outgoing_.resize(0);
+        outgoingRead_ = false;
+    }
+    auto          before = outgoing_.size();
+    QElapsedTimer timer;
+    timer.start();
+    errorCode_ = compressor_->compress(a, outgoing_);
+    stats_.deflateNsecs += timer.nsecsElapsed();
+    stats_.plainOut += a.size();
+    stats_.compressedOut += outgoing_.size() - before;
+    outgoingPlain_ += int(a.size());
+
     if (!errorCode_)
-        QTimer::singleShot(0, this, SIGNAL(readyReadOutgoing()));
+        emit readyReadOutgoing();
     else
-        QTimer::singleShot(0, this, SIGNAL(error()));
+        emit error();
 }
 
 QByteArray CompressionHandler::read()
 {
     // qDebug("CompressionHandler::read");
-    QByteArray b = incoming_buffer_.buffer();
-    incoming_buffer_.buffer().clear();
-    incoming_buffer_.reset();
-    return b;
+    if (incomingRead_)
+        return QByteArray();
+    incomingRead_ = true;
+    return incoming_; // shared. the buffer is reused if the reader drops it before the next write
 }
 
-QByteArray CompressionHandler::readOutgoing(int *i)
+QByteArray CompressionHandler::readOutgoing(int *plainBytes)
 {
     // qDebug("CompressionHandler::readOutgoing");
-    // qDebug() << QString("Outgoing %1 bytes").arg(outgoing_buffer_.size());
-    QByteArray b = outgoing_buffer_.buffer();
-    outgoing_buffer_.buffer().clear();
-    outgoing_buffer_.reset();
-    *i = b.size();
-    return b;
+    // qDebug() << QString("Outgoing %1 bytes").arg(outgoing_.size());
+    *plainBytes    = outgoingPlain_;
+    outgoingPlain_ = 0;
+    if (outgoingRead_)
+        return QByteArray();
+    outgoingRead_ = true;
+    return outgoing_;
 }
 
 int CompressionHandler::errorCode() { return errorCode_; }
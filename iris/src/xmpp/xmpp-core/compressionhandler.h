@@ -1,7 +1,7 @@
 #ifndef COMPRESSIONHANDLER_H
 #define COMPRESSIONHANDLER_H
 
-#include <QBuffer>
+#include <QByteArray>
 #include <QObject>
 
 class ZLibCompressor;
@@ -11,13 +11,23 @@ class CompressionHandler : public QObject {
     Q_OBJECT
 
 public:
-    CompressionHandler();
+    struct Stats {
+        qint64 plainOut      = 0; // bytes given to write()
+        qint64 compressedOut = 0;
+        qint64 compressedIn  = 0; // bytes given to writeIncoming()
+        qint64 plainIn       = 0;
+        qint64 deflateNsecs  = 0; // time spent in zlib. it's all cpu work
+        qint64 inflateNsecs  = 0;
+    };
+
+    explicit CompressionHandler(int level = -1); // -1 is Z_DEFAULT_COMPRESSION
     ~CompressionHandler();
-    void       writeIncoming(const QByteArray &a);
-    void       write(const QByteArray &a);
-    QByteArray read();
-    QByteArray readOutgoing(int *);
-    int        errorCode();
+    void         writeIncoming(const QByteArray &a);
+    void         write(const QByteArray &a);
+    QByteArray   read();
+    QByteArray   readOutgoing(int *);
+    int          errorCode();
+    const Stats &stats() const { return stats_; }
 
 signals:
     void readyRead();
@@ -27,8 +37,13 @@ signals:
 private:
     ZLibCompressor   *compressor_;
     ZLibDecompressor *decompressor_;
-    QBuffer           outgoing_buffer_, incoming_buffer_;
+    QByteArray        outgoing_, incoming_; // reused while the previous results are already released
+    int               outgoingPlain_ = 0;
+    bool              outgoingRead_  = false;
+    bool              incomingRead_  = false;
+    bool              readScheduled_ = false;
     int               errorCode_;
+    Stats             stats_;
 };
 
 #endif // COMPRESSIONHANDLER_H
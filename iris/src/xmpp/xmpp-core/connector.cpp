@@ -309,6 +309,7 @@ void AdvancedConnector::connectToServer(const QString &server)
     } else {
         BSocket *s = new BSocket;
         d->bs      = s;
+        s->setDirectSignals(true); // an event less per read of the stream
 #ifdef XMPP_DEBUG
         XDEBUG << "Adding socket:" << s;
 #endif
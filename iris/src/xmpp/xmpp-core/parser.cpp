@@ -19,10 +19,217 @@
 
 #include "parser.h"
 
+#include <QElapsedTimer>
+
+#include <deque>
 #include <queue>
 
 namespace XMPP {
 
+//----------------------------------------------------------------------------
+// XmlTree
+//----------------------------------------------------------------------------
+QStringView XmlTree::Element::namespaceURI() const
+{
+    Q_ASSERT(tree_ != nullptr);
+    return tree_->view(tree_->nodes[index_].ns);
+}
+
+QStringView XmlTree::Element::localName() const
+{
+    Q_ASSERT(tree_ != nullptr);
+    return tree_->view(tree_->nodes[index_].name);
+}
+
+bool XmlTree::Element::hasAttribute(QStringView name) const
+{
+    Q_ASSERT(tree_ != nullptr);
+    auto const &n = tree_->nodes[index_];
+    for (int i = n.firstAttr; i < n.firstAttr + n.attrCount; ++i) {
+        auto const &a = tree_->attrs[i];
+        if (a.ns.length == 0 && tree_->view(a.name) == name)
+            return true;
+    }
+    return false;
+}
+
+QStringView XmlTree::Element::attribute(QStringView name) const
+{
+    Q_ASSERT(tree_ != nullptr);
+    auto const &n = tree_->nodes[index_];
+    for (int i = n.firstAttr; i < n.firstAttr + n.attrCount; ++i) {
+        auto const &a = tree_->attrs[i];
+        if (a.ns.length == 0 && tree_->view(a.name) == name)
+            return tree_->view(a.value);
+    }
+    return {};
+}
+
+QString XmlTree::Element::text() const
+{
+    Q_ASSERT(tree_ != nullptr);
+    QString ret;
+    tree_->appendText(index_, ret);
+    return ret;
+}
+
+XmlTree::Element XmlTree::Element::matchSibling(int index, QStringView localName, QStringView ns) const
+{
+    while (index != -1) {
+        auto const &n = tree_->nodes[index];
+        if (!n.isText && (localName.isEmpty() || tree_->view(n.name) == localName)
+            && (ns.isEmpty() || tree_->view(n.ns) == ns))
+            return Element(tree_, index);
+        index = n.next;
+    }
+    return Element();
+}
+
+XmlTree::Element XmlTree::Element::firstChildElement(QStringView localName, QStringView ns) const
+{
+    Q_ASSERT(tree_ != nullptr);
+    return matchSibling(tree_->nodes[index_].firstChild, localName, ns);
+}
+
+XmlTree::Element XmlTree::Element::nextSiblingElement(QStringView localName, QStringView ns) const
+{
+    Q_ASSERT(tree_ != nullptr);
+    return matchSibling(tree_->nodes[index_].next, localName, ns);
+}
+
+QDomElement XmlTree::Element::toDomElement(QDomDocument &doc) const
+{
+    if (!tree_)
+        return QDomElement();
+    return tree_->toDomElement(index_, doc);
+}
+
+void XmlTree::clear()
+{
+    // keeps allocated memory for the next element
+    nodes.clear();
+    attrs.clear();
+    strings.resize(0);
+    current = -1;
+}
+
+XmlTree::Element XmlTree::root() const
+{
+    if (nodes.empty())
+        return Element();
+    return Element(this, 0);
+}
+
+XmlTree::Span XmlTree::store(QStringView s)
+{
+    Span span { int(strings.size()), int(s.size()) };
+    strings.append(s.data(), int(s.size()));
+    return span;
+}
+
+int XmlTree::appendNode(Node &&n)
+{
+    int index = int(nodes.size());
+    n.parent  = current;
+    if (current != -1) {
+        auto &p = nodes[current];
+        if (p.lastChild == -1)
+            p.firstChild = index;
+        else
+            nodes[p.lastChild].next = index;
+        p.lastChild = index;
+    }
+    nodes.push_back(std::move(n));
+    return index;
+}
+
+void XmlTree::openElement(QStringView ns, QStringView localName)
+{
+    Q_ASSERT_X(current != -1 || nodes.empty(), "xml tree", "second root element");
+    Node n;
+    // children almost always share the namespace of their parent. don't store it twice
+    if (current != -1 && view(nodes[current].ns) == ns)
+        n.ns = nodes[current].ns;
+    else
+        n.ns = store(ns);
+    n.name      = store(localName);
+    n.firstAttr = int(attrs.size());
+    current     = appendNode(std::move(n));
+}
+
+void XmlTree::addAttribute(QStringView ns, QStringView prefix, QStringView name, QStringView value)
+{
+    Q_ASSERT(current != -1);
+    Attr a;
+    a.ns     = store(ns);
+    a.prefix = store(prefix);
+    a.name   = store(name);
+    a.value  = store(value);
+    attrs.push_back(a);
+    nodes[current].attrCount++;
+}
+
+void XmlTree::addText(QStringView text)
+{
+    Q_ASSERT(current != -1);
+    Node n;
+    n.isText = true;
+    n.text   = store(text);
+    appendNode(std::move(n));
+}
+
+bool XmlTree::closeElement()
+{
+    Q_ASSERT(current != -1);
+    current = nodes[current].parent;
+    return current == -1;
+}
+
+void XmlTree::appendText(int index, QString &out) const
+{
+    auto const &n = nodes[index];
+    if (n.isText) {
+        out.append(view(n.text).data(), n.text.length);
+        return;
+    }
+    for (int c = n.firstChild; c != -1; c = nodes[c].next)
+        appendText(c, out);
+}
+
+QDomElement XmlTree::toDomElement(int index, QDomDocument &doc) const
+{
+    auto const &n  = nodes[index];
+    auto        ns = view(n.ns);
+    QDomElement el;
+    if (ns.isEmpty())
+        el = doc.createElement(view(n.name).toString());
+    else
+        el = doc.createElementNS(ns.toString(), view(n.name).toString());
+
+    for (int i = n.firstAttr; i < n.firstAttr + n.attrCount; ++i) {
+        auto const &a = attrs[i];
+        QDomAttr    da;
+        if (a.ns.length == 0)
+            da = doc.createAttribute(view(a.name).toString());
+        else
+            da = doc.createAttributeNS(view(a.ns).toString(), view(a.name).toString());
+        da.setPrefix(view(a.prefix).toString());
+        da.setValue(view(a.value).toString());
+        if (a.ns.length == 0)
+            el.setAttributeNode(da);
+        else
+            el.setAttributeNodeNS(da);
+    }
+
+    for (int c = n.firstChild; c != -1; c = nodes[c].next) {
+        if (nodes[c].isText)
+            el.appendChild(doc.createTextNode(view(nodes[c].text).toString()));
+        else
+            el.appendChild(toDomElement(c, doc));
+    }
+    return el;
+}
+
 //----------------------------------------------------------------------------
 // Event
 //----------------------------------------------------------------------------
@@ -31,8 +238,14 @@ public:
     int                  type;
     QString              ns, ln, qn;
     QXmlStreamAttributes a;
-    QDomElement          e;
+    mutable QDomElement  e;
     QString              str;
+    qint64               size      = 0;
+    qint64               parseTime = 0;
+
+    // Tree mode
+    std::shared_ptr<const XmlTree> tree;
+    mutable QDomDocument           doc;
 
     QXmlStreamNamespaceDeclarations nsPrefixes;
 };
@@ -104,12 +317,26 @@ QString Parser::Event::actualString() const
     return d->str;
 }
 
+qint64 Parser::Event::size() const { return d ? d->size : 0; }
+
+qint64 Parser::Event::parseTime() const { return d ? d->parseTime : 0; }
+
 QDomElement Parser::Event::element() const
 {
-    Q_ASSERT(d != nullptr);
+    if (!d)
+        return QDomElement();
+    if (d->e.isNull() && d->tree)
+        d->e = d->tree->root().toDomElement(d->doc);
     return d->e;
 }
 
+XmlTree::Element Parser::Event::elementRef() const
+{
+    if (!d || !d->tree)
+        return XmlTree::Element();
+    return d->tree->root();
+}
+
 void Parser::Event::setDocumentOpen(const QString &namespaceURI, const QString &localName, const QString &qName,
                                     const QXmlStreamAttributes &atts, const QXmlStreamNamespaceDeclarations &nsPrefixes)
 {
@@ -138,6 +365,15 @@ void Parser::Event::setElement(const QDomElement &elem)
     d->e    = elem;
 }
 
+void Parser::Event::setElement(const std::shared_ptr<const XmlTree> &tree, const QDomDocument &doc)
+{
+    ensureD();
+    d->type = Element;
+    d->tree = tree;
+    d->doc  = doc;
+    d->e    = QDomElement();
+}
+
 void Parser::Event::setError()
 {
     ensureD();
@@ -150,11 +386,19 @@ void Parser::Event::setActualString(const QString &str)
     d->str = str;
 }
 
+void Parser::Event::setElementStats(qint64 size, qint64 parseTime)
+{
+    ensureD();
+    d->size      = size;
+    d->parseTime = parseTime;
+}
+
 //----------------------------------------------------------------------------
 // Parser
 //----------------------------------------------------------------------------
 class Parser::Private {
 public:
+    Parser::Mode          mode = Parser::Mode::Dom;
     QDomDocument          doc;
     QDomElement           curElement;
     QDomElement           element; // root part
@@ -167,22 +411,89 @@ public:
     std::queue<Event>     events;
     QString               streamQName;
 
+    std::shared_ptr<XmlTree> tree;      // element being built in Tree mode
+    std::shared_ptr<XmlTree> spareTree; // last emitted tree. reused when released by all events
+
+    // see Event::size() and Event::parseTime()
+    std::deque<QByteArray> fed;              // data given to the reader and not yet mapped by byteOffset()
+    int                    fedPos       = 0; // position in fed.front()
+    qint64                 mappedChars  = 0;
+    qint64                 mappedBytes  = 0;
+    qint64                 tokenStart   = 0; // character offset of the token being handled
+    qint64                 elementStart = 0; // byte offset of the top level element being built
+    qint64                 parseNsecs   = 0; // time spent on the element before the current collectEvents() call
+    QElapsedTimer          clock;
+
+    void addDataToReader(const QByteArray &data)
+    {
+        reader.addData(data);
+        fed.push_back(data);
+    }
+
+    // converts the reader's character offset to the offset in received utf-8 bytes. offsets must not go back
+    qint64 byteOffset(qint64 chars)
+    {
+        while (!fed.empty()) {
+            const auto &data = fed.front();
+            for (; fedPos < data.size(); ++fedPos) {
+                auto b = uchar(data.at(fedPos));
+                if ((b & 0xC0) != 0x80) { // not a continuation byte, so the next character starts here
+                    if (mappedChars >= chars)
+                        return mappedBytes;
+                    mappedChars += b >= 0xF0 ? 2 : 1; // 4-byte sequences are surrogate pairs in QString
+                }
+                ++mappedBytes;
+            }
+            fed.pop_front();
+            fedPos = 0;
+        }
+        return mappedBytes;
+    }
+
+    bool isBuildingElement() const { return mode == Parser::Mode::Tree ? bool(tree) : !curElement.isNull(); }
+
+    void startElement()
+    {
+        elementStart = byteOffset(tokenStart);
+        parseNsecs   = 0;
+        clock.start();
+    }
+
+    void finishElement(Event &e)
+    {
+        e.setElementStats(byteOffset(reader.characterOffset()) - elementStart, parseNsecs + clock.nsecsElapsed());
+        parseNsecs = 0;
+    }
+
+    XmlTree &currentTree()
+    {
+        if (!tree) {
+            if (spareTree && spareTree.use_count() == 1) {
+                tree = std::move(spareTree);
+                tree->clear();
+            } else {
+                tree = std::make_shared<XmlTree>();
+            }
+        }
+        return *tree;
+    }
+
     void pushDataToReader()
     {
         if (completeTag) {
             readerStarted = true;
             while (!in.empty()) {
                 if (in.front().constData() != completeTag) {
-                    reader.addData(in.front());
+                    addDataToReader(in.front());
                     in.erase(in.begin());
                 } else {
                     // Qt has some bugs, so ensure we push data only ending with '>'
                     if (completeOffset == in.front().size() - 1) {
-                        reader.addData(in.front());
+                        addDataToReader(in.front());
                         in.erase(in.begin());
                     } else {
                         QByteArray part = in.front().left(completeOffset + 1);
-                        reader.addData(part);
+                        addDataToReader(part);
                         in.front().remove(0, completeOffset + 1);
                     }
                     completeTag = nullptr;
@@ -194,7 +505,17 @@ public:
 
     void handleStartElement()
     {
-        auto    ns   = reader.namespaceUri().toString();
+        if (streamOpened && mode == Parser::Mode::Tree) {
+            if (!tree)
+                startElement();
+            auto &t = currentTree();
+            t.openElement(reader.namespaceUri(), reader.name());
+            const auto &attrs = reader.attributes();
+            for (auto const &a : attrs)
+                t.addAttribute(a.namespaceUri(), a.prefix(), a.name(), a.value());
+            return;
+        }
+        QString ns   = reader.namespaceUri().toString();
         QString name = reader.name().toString();
         if (streamOpened) {
             QDomElement newEl;
@@ -205,6 +526,7 @@ public:
             if (curElement.isNull()) {
                 curElement = newEl;
                 element    = newEl;
+                startElement();
             } else {
                 curElement = curElement.appendChild(newEl).toElement();
             }
@@ -234,6 +556,24 @@ public:
 
     void handleEndElement()
     {
+        if (mode == Parser::Mode::Tree) {
+            if (!tree) {
+                Q_ASSERT_X(reader.qualifiedName() == streamQName, "xml parser",
+                           "XML reader hasn't reported error for invalid element close");
+                Event e;
+                e.setDocumentClose(reader.namespaceUri().toString(), reader.name().toString(), streamQName);
+                events.push(e);
+                return;
+            }
+            if (tree->closeElement()) {
+                Event e;
+                e.setElement(tree, doc);
+                finishElement(e);
+                events.push(e);
+                spareTree = std::move(tree);
+            }
+            return;
+        }
         if (curElement.isNull() && reader.qualifiedName() == streamQName) {
             Event e;
             e.setDocumentClose(reader.namespaceUri().toString(), reader.name().toString(), streamQName);
@@ -267,6 +607,7 @@ public:
         if (curElement.parentNode().isNull()) {
             Event e;
             e.setElement(curElement);
+            finishElement(e);
             events.push(e);
         }
         curElement = curElement.parentNode().toElement();
@@ -274,6 +615,13 @@ public:
 
     void handleText()
     {
+        if (mode == Parser::Mode::Tree) {
+            if (tree)
+                tree->addText(reader.text());
+            else if (!reader.isWhitespace())
+                qWarning("Text node out of element (ignored): %s", qPrintable(reader.text().toString()));
+            return;
+        }
         if (curElement.isNull()) {
             if (!reader.isWhitespace())
                 qWarning("Text node out of element (ignored): %s", qPrintable(reader.text().toString()));
@@ -285,7 +633,10 @@ public:
 
     void collectEvents()
     {
-        auto tt = reader.readNext();
+        if (isBuildingElement())
+            clock.start(); // idle time between the calls isn't parsing
+        tokenStart = reader.characterOffset();
+        auto tt    = reader.readNext();
         while (tt != QXmlStreamReader::NoToken && tt != QXmlStreamReader::Invalid) {
             if (tt == QXmlStreamReader::StartElement) {
                 handleStartElement();
@@ -297,8 +648,11 @@ public:
                 Q_ASSERT_X(tt != QXmlStreamReader::EntityReference, "xml parser",
                            qPrintable(QString("unexpected xml entity: %1").arg(reader.text())));
             }
-            tt = reader.readNext();
+            tokenStart = reader.characterOffset();
+            tt         = reader.readNext();
         }
+        if (isBuildingElement())
+            parseNsecs += clock.nsecsElapsed();
         if (tt == QXmlStreamReader::Invalid) {
             if (reader.error() == QXmlStreamReader::PrematureEndOfDocumentError)
                 return;
@@ -328,7 +682,16 @@ Parser::Parser() { reset(); }
 
 Parser::~Parser() { }
 
-void Parser::reset() { d.reset(new Private); }
+void Parser::reset()
+{
+    auto mode = d ? d->mode : Mode::Dom;
+    d.reset(new Private);
+    d->mode = mode;
+}
+
+void Parser::setMode(Mode mode) { d->mode = mode; }
+
+Parser::Mode Parser::mode() const { return d->mode; }
 
 void Parser::appendData(const QByteArray &a)
 {
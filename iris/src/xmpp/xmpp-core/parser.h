@@ -25,11 +25,91 @@
 #include <QXmlStreamAttributes>
 
 #include <memory>
+#include <vector>
 
 namespace XMPP {
 
+// Compact read-only tree of one top-level element (usually a stanza).
+// All the strings of the element are kept in a single buffer and nodes refer to them by offset,
+// so building the tree costs a few vector appends per token instead of a heap allocated QDomNode
+// for every element, attribute and text node. The storage is reused by the parser once nobody
+// references the tree anymore.
+class XmlTree {
+public:
+    class Element {
+    public:
+        Element() = default;
+
+        bool        isNull() const { return tree_ == nullptr; }
+        QStringView namespaceURI() const;
+        QStringView localName() const;
+        bool        hasAttribute(QStringView name) const;
+        QStringView attribute(QStringView name) const; // attributes without namespace only
+        QString     text() const;
+        Element     firstChildElement(QStringView localName = {}, QStringView ns = {}) const;
+        Element     nextSiblingElement(QStringView localName = {}, QStringView ns = {}) const;
+
+        // builds a regular DOM copy of the element within the given document
+        QDomElement toDomElement(QDomDocument &doc) const;
+
+    private:
+        friend class XmlTree;
+        Element(const XmlTree *tree, int index) : tree_(tree), index_(index) { }
+        Element matchSibling(int index, QStringView localName, QStringView ns) const;
+
+        const XmlTree *tree_  = nullptr;
+        int            index_ = -1;
+    };
+
+    void    clear();
+    bool    isEmpty() const { return nodes.empty(); }
+    bool    isOpen() const { return current != -1; }
+    Element root() const;
+
+    // building
+    void openElement(QStringView ns, QStringView localName);
+    void addAttribute(QStringView ns, QStringView prefix, QStringView name, QStringView value);
+    void addText(QStringView text);
+    bool closeElement(); // returns true when the root element was closed
+
+private:
+    struct Span {
+        int offset = 0;
+        int length = 0;
+    };
+    struct Node {
+        Span ns, name, text;
+        int  parent     = -1;
+        int  firstChild = -1;
+        int  lastChild  = -1;
+        int  next       = -1;
+        int  firstAttr  = 0;
+        int  attrCount  = 0;
+        bool isText     = false;
+    };
+    struct Attr {
+        Span ns, prefix, name, value;
+    };
+
+    Span        store(QStringView s);
+    QStringView view(const Span &s) const { return QStringView(strings).mid(s.offset, s.length); }
+    int         appendNode(Node &&n);
+    void        appendText(int index, QString &out) const;
+    QDomElement toDomElement(int index, QDomDocument &doc) const;
+
+    std::vector<Node> nodes;
+    std::vector<Attr> attrs;
+    QString           strings;
+    int               current = -1;
+};
+
 class Parser {
 public:
+    enum class Mode {
+        Dom, // build every element as QDomElement right away
+        Tree // build XmlTree and make QDomElement only on request
+    };
+
     struct NSPrefix {
         QString name;
         QString value;
@@ -56,7 +136,12 @@ public:
         QXmlStreamAttributes atts() const;
 
         // for element
-        QDomElement element() const;
+        QDomElement      element() const;
+        XmlTree::Element elementRef() const; // Tree mode only. null otherwise
+
+        // for element. utf-8 bytes it took in the stream and time spent parsing it since its start tag
+        qint64 size() const;
+        qint64 parseTime() const; // nsecs
 
         // for any
         QString actualString() const;
@@ -66,8 +151,10 @@ public:
                              const QXmlStreamAttributes &atts, const QXmlStreamNamespaceDeclarations &nsPrefixes);
         void setDocumentClose(const QString &namespaceURI, const QString &localName, const QString &qName);
         void setElement(const QDomElement &elem);
+        void setElement(const std::shared_ptr<const XmlTree> &tree, const QDomDocument &doc);
         void setError();
         void setActualString(const QString &);
+        void setElementStats(qint64 size, qint64 parseTime);
 
     private:
         void ensureD();
@@ -79,6 +166,8 @@ public:
     ~Parser();
 
     void        reset();
+    void        setMode(Mode mode);
+    Mode        mode() const;
     void        appendData(const QByteArray &a);
     Event       readNext();
     QByteArray  unprocessed() const;
@@ -23,11 +23,14 @@
 
 #include "protocol.h"
 
+#include "xmpp_trafficstats.h"
+
 #ifdef XMPP_TEST
 #include "td.h"
 #endif
 
 #include <QByteArray>
+#include <QElapsedTimer>
 #include <QList>
 #include <QtCrypto>
 #include <optional>
@@ -82,14 +85,15 @@ Version::Version(int maj, int min)
 //----------------------------------------------------------------------------
 StreamFeatures::StreamFeatures()
 {
-    tls_supported      = false;
-    sasl_supported     = false;
-    bind_supported     = false;
-    tls_required       = false;
-    compress_supported = false;
-    sm_supported       = false;
-    session_supported  = false;
-    session_required   = false;
+    tls_supported       = false;
+    sasl_supported      = false;
+    bind_supported      = false;
+    tls_required        = false;
+    compress_supported  = false;
+    sm_supported        = false;
+    session_supported   = false;
+    session_required    = false;
+    rosterver_supported = false;
 }
 
 //----------------------------------------------------------------------------
@@ -482,7 +486,7 @@ bool BasicProtocol::handleCloseFinished()
     return true;
 }
 
-bool BasicProtocol::doStep(const QDomElement &e)
+bool BasicProtocol::doStep(const Parser::Event &pe)
 {
     // handle pending error
     if (delayedError) {
@@ -499,10 +503,11 @@ bool BasicProtocol::doStep(const QDomElement &e)
         return close();
     }
 
+    auto e = pe.elementRef();
     if (!e.isNull()) {
         // check for error
-        if (e.namespaceURI() == NS_ETHERX && e.tagName() == "error") {
-            extractStreamError(e);
+        if (e.namespaceURI() == QLatin1String(NS_ETHERX) && e.localName() == QLatin1String("error")) {
+            extractStreamError(pe.element());
             return error(ErrStream);
         }
     }
@@ -526,8 +531,17 @@ bool BasicProtocol::doStep(const QDomElement &e)
             // outgoing stanza?
             if (!i.stanzaToSend.isNull()) {
                 ++stanzasPending;
-                writeElement(i.stanzaToSend, TypeStanza, true);
                 event = ESend;
+                int size;
+                if (keepsWrittenStanzas()) {
+                    const QByteArray data = writeStanza(i.stanzaToSend, TypeStanza, true);
+                    size                  = data.size();
+                    stanzaWritten(data);
+                } else {
+                    size = writeElement(i.stanzaToSend, TypeStanza, true); // straight to the write buffer
+                }
+                if (trafficStats)
+                    trafficStats->addStanza(TrafficStats::Outgoing, i.stanzaToSend, size);
             }
             // direct send?
             else if (!i.stringToSend.isEmpty()) {
@@ -547,9 +561,13 @@ bool BasicProtocol::doStep(const QDomElement &e)
         }
     }
 
-    return doStep2(e);
+    return doStep2(pe);
 }
 
+bool BasicProtocol::keepsWrittenStanzas() const { return false; }
+
+void BasicProtocol::stanzaWritten(const QByteArray &) { }
+
 void BasicProtocol::itemWritten(int id, int)
 {
     if (id == TypeStanza) {
@@ -631,15 +649,17 @@ void CoreProtocol::needTimer(int seconds)
     timeout_sec = seconds;
 }
 
-void CoreProtocol::sendStanza(const QDomElement &e)
+bool CoreProtocol::keepsWrittenStanzas() const { return sm.isActive(); }
+
+void CoreProtocol::stanzaWritten(const QByteArray &data)
 {
-    if (sm.isActive()) {
-        int len = sm.addUnacknowledgedStanza(e);
-        if (len > 5 && len % 4 == 0)
-            if (needSMRequest())
-                event = ESend;
-    }
-    BasicProtocol::sendStanza(e);
+    // keep the bytes for resend. no need to serialize the stanza again on resume
+    int interval = sm.ackRequestInterval();
+    sm.addUnacknowledgedStanza(data);
+    if (sm.isAckRequestNeeded())
+        needSMRequest();
+    else if (sm.ackRequestInterval() != interval) // the first one to confirm. don't let it wait too long
+        needTimer(sm.ackRequestInterval());
 }
 
 void CoreProtocol::startClientOut(const Jid &_jid, bool _oldOnly, bool tlsActive, bool _doAuth, bool _doCompress)
@@ -871,12 +891,12 @@ void CoreProtocol::elementRecv(const QDomElement &e)
 #endif
 }
 
-bool CoreProtocol::doStep2(const QDomElement &e)
+bool CoreProtocol::doStep2(const Parser::Event &pe)
 {
     if (dialback)
-        return dialbackStep(e);
+        return dialbackStep(pe.element());
     else
-        return normalStep(e);
+        return normalStep(pe);
 }
 
 bool CoreProtocol::isValidStanza(const QDomElement &e) const
@@ -887,23 +907,30 @@ bool CoreProtocol::isValidStanza(const QDomElement &e) const
         && (kind == Stanza::Message || kind == Stanza::Presence || kind == Stanza::IQ);
 }
 
-bool CoreProtocol::streamManagementHandleStanza(const QDomElement &e)
+bool CoreProtocol::isValidStanza(const XmlTree::Element &e) const
+{
+    auto s = e.localName();
+    return e.namespaceURI() == QLatin1String(server ? NS_SERVER : NS_CLIENT)
+        && (s == QLatin1String("message") || s == QLatin1String("presence") || s == QLatin1String("iq"));
+}
+
+bool CoreProtocol::streamManagementHandleStanza(const XmlTree::Element &e)
 {
-    QString s = e.tagName();
-    if (s == "r") {
+    auto s = e.localName();
+    if (s == QLatin1String("r")) {
 #ifdef IRIS_SM_DEBUG
         qDebug() << "Stream Management: [<-?] Received request from server";
 #endif
         sendUrgent(sm.makeResponseStanza(doc));
         event = ESend;
         return true;
-    } else if (s == "a") {
-        quint32 last_id = e.attribute("h").toUInt();
+    } else if (s == QLatin1String("a")) {
+        quint32 last_id = e.attribute(u"h").toUInt();
 #ifdef IRIS_SM_DEBUG
         qDebug() << "Stream Management: [<--] Received ack response from server with h =" << last_id;
 #endif
         sm.processAcknowledgement(last_id);
-        needTimer(SM_TIMER_INTERVAL_SECS);
+        needTimer(sm.ackRequestInterval());
         event = EAck;
         return true;
     } else {
@@ -918,7 +945,7 @@ bool CoreProtocol::needSMRequest()
     QDomElement e = sm.generateRequestStanza(doc);
     if (!e.isNull()) {
         send(e);
-        needTimer(SM_TIMER_INTERVAL_SECS);
+        needTimer(sm.ackRequestInterval());
         return true;
     }
     return false;
@@ -1055,8 +1082,14 @@ bool CoreProtocol::dialbackStep(const QDomElement &e)
     return false;
 }
 
-bool CoreProtocol::normalStep(const QDomElement &e)
+bool CoreProtocol::normalStep(const Parser::Event &pe)
 {
+    // once the stream is established stanzas are routed by the lightweight tree and
+    // converted to DOM only when passed to the client
+    QDomElement e;
+    if (step != Done)
+        e = pe.element();
+
     if (step == Start) {
         if (isIncoming()) {
             need = NSASLMechs;
@@ -1360,6 +1393,9 @@ bool CoreProtocol::normalStep(const QDomElement &e)
                     f.session_required  = c.elementsByTagName(QLatin1String("optional")).count() == 0;
                     // more details https://tools.ietf.org/html/draft-cridland-xmpp-session-01
 
+                } else if (c.localName() == QLatin1String("ver") && c.namespaceURI() == NS_ROSTER_VERSIONING) {
+                    f.rosterver_supported = true;
+
                 } else {
                     unhandled.append(c);
                 }
@@ -1742,12 +1778,13 @@ bool CoreProtocol::normalStep(const QDomElement &e)
             } else if (e.localName() == "resumed") {
                 sm.resume(e.attribute("h").toUInt());
                 while (true) {
-                    QDomElement st = sm.getUnacknowledgedStanza();
+                    QByteArray st = sm.getUnacknowledgedStanza();
                     if (st.isNull())
                         break;
-                    send(st);
+                    writeSerialized(st, TypeElement);
                 }
-                needTimer(SM_TIMER_INTERVAL_SECS);
+                if (!sm.isAckRequestNeeded() || !needSMRequest())
+                    needTimer(sm.ackRequestInterval());
                 event = EReady;
                 step  = Done;
                 return true;
@@ -1763,18 +1800,25 @@ bool CoreProtocol::normalStep(const QDomElement &e)
     }
 
     if (isReady()) {
-        if (!e.isNull()) {
-            if (isValidStanza(e)) {
-                stanzaToRecv = e;
-                event        = EStanzaReady;
+        auto el = pe.elementRef();
+        if (!el.isNull()) {
+            if (isValidStanza(el)) {
+                QElapsedTimer domTime; // the tree is converted to dom here. it's a part of parsing too
+                if (trafficStats)
+                    domTime.start();
+                stanzaToRecv = e.isNull() ? pe.element() : e;
+                if (trafficStats)
+                    trafficStats->addStanza(TrafficStats::Incoming, stanzaToRecv, pe.size(),
+                                            pe.parseTime() + domTime.nsecsElapsed());
+                event = EStanzaReady;
                 setIncomingAsExternal();
                 return true;
             } else if (sm.isActive()) {
-                return streamManagementHandleStanza(e);
+                return streamManagementHandleStanza(el);
             }
         }
         if (sm.isActive()) {
-            if (sm.lastAckElapsed() >= SM_TIMER_INTERVAL_SECS) {
+            if (sm.lastAckElapsed() >= sm.ackRequestInterval()) {
                 if (needSMRequest())
                     event = ESend;
                 else
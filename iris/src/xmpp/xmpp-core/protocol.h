@@ -46,8 +46,11 @@
 #define NS_COMPRESS_FEATURE "http://jabber.org/features/compress"
 #define NS_COMPRESS_PROTOCOL "http://jabber.org/protocol/compress"
 #define NS_HOSTS "http://barracuda.com/xmppextensions/hosts"
+#define NS_ROSTER_VERSIONING "urn:xmpp:features:rosterver"
 
 namespace XMPP {
+class TrafficStats;
+
 class Version {
 public:
     Version(int maj = 0, int min = 0);
@@ -64,6 +67,7 @@ public:
     bool        sm_supported;
     bool        session_supported;
     bool        session_required;
+    bool        rosterver_supported;
     QStringList sasl_mechs;
     QStringList compression_mechs;
     QStringList hosts;
@@ -183,6 +187,8 @@ public:
 
     QByteArray spare; // filled with unprocessed data on NStartTLS and NSASLLayer
 
+    TrafficStats *trafficStats = nullptr; // not owned. stanzas are counted there when set
+
     bool isReady() const;
 
     enum { TypeElement, TypeStanza, TypeDirect, TypePing };
@@ -208,13 +214,15 @@ protected:
     void        handleDocOpen(const Parser::Event &pe);
     bool        handleError();
     bool        handleCloseFinished();
-    bool        doStep(const QDomElement &e);
+    bool        doStep(const Parser::Event &pe);
     void        itemWritten(int id, int size);
 
     virtual QString     defaultNamespace();
     virtual QStringList extraNamespaces(); // stringlist: prefix,uri,prefix,uri, [...]
     virtual void        handleStreamOpen(const Parser::Event &pe);
-    virtual bool        doStep2(const QDomElement &e) = 0;
+    virtual bool        doStep2(const Parser::Event &pe) = 0;
+    virtual bool        keepsWrittenStanzas() const; // stanzaWritten() wants the bytes
+    virtual void        stanzaWritten(const QByteArray &data);
 
     void setReady(bool b);
 
@@ -266,9 +274,6 @@ public:
     void reset();
     void needTimer(int seconds);
 
-    // reimplemented to do SM
-    void sendStanza(const QDomElement &e);
-
     void startClientOut(const Jid &jid, bool oldOnly, bool tlsActive, bool doAuth, bool doCompression);
     void startServerOut(const QString &to);
     void startDialbackOut(const QString &to, const QString &from);
@@ -356,9 +361,10 @@ private:
     bool       loginComplete();
 
     bool isValidStanza(const QDomElement &e) const;
-    bool streamManagementHandleStanza(const QDomElement &e);
+    bool isValidStanza(const XmlTree::Element &e) const;
+    bool streamManagementHandleStanza(const XmlTree::Element &e);
     bool grabPendingItem(const Jid &to, const Jid &from, int type, DBItem *item);
-    bool normalStep(const QDomElement &e);
+    bool normalStep(const Parser::Event &pe);
     bool dialbackStep(const QDomElement &e);
 
     bool needSMRequest();
@@ -371,7 +377,9 @@ private:
     QString     defaultNamespace();
     QStringList extraNamespaces();
     void        handleStreamOpen(const Parser::Event &pe);
-    bool        doStep2(const QDomElement &e);
+    bool        doStep2(const Parser::Event &pe);
+    bool        keepsWrittenStanzas() const;
+    void        stanzaWritten(const QByteArray &data);
     void        elementSend(const QDomElement &e);
     void        elementRecv(const QDomElement &e);
 };
@@ -28,6 +28,7 @@
 #include "securestream.h"
 
 #include "compressionhandler.h"
+#include "xmpp_streamcapture.h"
 #ifdef USE_TLSHANDLER
 #include "xmpp.h"
 #endif
@@ -239,7 +240,7 @@ public:
         }
 
         // put remainder into the layer tracker
-        if (type == SASL || tls_done)
+        if (type == SASL || type == Compression || tls_done)
             written += layer.finished(plain);
 
         return written;
@@ -340,6 +341,7 @@ private slots:
 class SecureStream::Private {
 public:
     ByteStream          *bs;
+    XMPP::StreamCapture *capture = nullptr;
     QList<SecureLayer *> layers;
     int                  pending;
     int                  errorCode;
@@ -451,12 +453,12 @@ void SecureStream::startTLSServer(QCA::TLS *t, const QByteArray &spare)
     insertData(spare);
 }
 
-void SecureStream::setLayerCompress(const QByteArray &spare)
+void SecureStream::setLayerCompress(const QByteArray &spare, int level)
 {
     if (!d->active || d->topInProgress || d->haveCompress())
         return;
 
-    SecureLayer *s = new SecureLayer(new CompressionHandler());
+    SecureLayer *s = new SecureLayer(new CompressionHandler(level));
     s->prebytes    = calcPrebytes();
     linkLayer(s);
     d->layers.append(s);
@@ -508,6 +510,17 @@ void SecureStream::closeTLS()
 
 int SecureStream::errorCode() const { return d->errorCode; }
 
+const CompressionHandler::Stats *SecureStream::compressionStats() const
+{
+    for (SecureLayer *s : std::as_const(d->layers)) {
+        if (s->type == SecureLayer::Compression)
+            return &s->p.compressionHandler->stats();
+    }
+    return nullptr;
+}
+
+void SecureStream::setCapture(XMPP::StreamCapture *capture) { d->capture = capture; }
+
 bool SecureStream::isOpen() const { return d->active; }
 
 void SecureStream::write(const QByteArray &a)
@@ -532,7 +545,9 @@ qint64 SecureStream::bytesToWrite() const { return d->pending; }
 
 void SecureStream::bs_readyRead()
 {
-    QByteArray a = d->bs->readAll();
+    QByteArray a = d->bs->readShared();
+    if (d->capture && d->capture->isCapturing(XMPP::StreamCapture::Wire))
+        d->capture->append(XMPP::StreamCapture::Incoming, a);
 
     // send to the first layer
     if (!d->layers.isEmpty()) {
@@ -639,7 +654,12 @@ void SecureStream::insertData(const QByteArray &a)
     }
 }
 
-void SecureStream::writeRawData(const QByteArray &a) { d->bs->write(a); }
+void SecureStream::writeRawData(const QByteArray &a)
+{
+    if (d->capture && d->capture->isCapturing(XMPP::StreamCapture::Wire))
+        d->capture->append(XMPP::StreamCapture::Outgoing, a);
+    d->bs->write(a);
+}
 
 void SecureStream::incomingData(const QByteArray &a)
 {
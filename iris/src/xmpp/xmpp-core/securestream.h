@@ -21,17 +21,17 @@
 #define SECURESTREAM_H
 
 #include "bytestream.h"
+#include "compressionhandler.h"
 
 #include <qca.h>
 
 #define USE_TLSHANDLER
-#ifdef USE_TLSHANDLER
 namespace XMPP {
+class StreamCapture;
+#ifdef USE_TLSHANDLER
 class TLSHandler;
-}
 #endif
-
-class CompressionHandler;
+}
 
 class SecureStream : public ByteStream {
     Q_OBJECT
@@ -42,7 +42,7 @@ public:
 
     void startTLSClient(QCA::TLS *t, const QByteArray &spare = QByteArray());
     void startTLSServer(QCA::TLS *t, const QByteArray &spare = QByteArray());
-    void setLayerCompress(const QByteArray &spare = QByteArray());
+    void setLayerCompress(const QByteArray &spare = QByteArray(), int level = -1);
     void setLayerSASL(QCA::SASL *s, const QByteArray &spare = QByteArray());
 #ifdef USE_TLSHANDLER
     void startTLSClient(XMPP::TLSHandler *t, const QString &server, const QByteArray &spare = QByteArray());
@@ -51,6 +51,12 @@ public:
     void closeTLS();
     int  errorCode() const;
 
+    // nullptr if compression isn't active
+    const CompressionHandler::Stats *compressionStats() const;
+
+    // captures bytes exchanged with the underlying stream if the capture is in Wire layer mode
+    void setCapture(XMPP::StreamCapture *capture);
+
     // reimplemented
     bool   isOpen() const;
     void   write(const QByteArray &);
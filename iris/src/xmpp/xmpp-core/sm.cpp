@@ -39,6 +39,7 @@ void SMState::resetCounters()
     received_count      = 0;
     server_last_handled = 0;
     send_queue.clear();
+    send_queue_bytes = 0;
 }
 
 StreamManagement::StreamManagement(QObject *parent) :
@@ -54,6 +55,9 @@ void StreamManagement::reset()
     sm_resend_pos                  = 0;
     sm_timeout_data.elapsed_timer  = QElapsedTimer();
     sm_timeout_data.waiting_answer = false;
+    sm_request_data.stanzas        = 0;
+    sm_request_data.bytes          = 0;
+    sm_request_data.over_limits    = false;
 }
 
 void StreamManagement::start(const QString &resumption_id)
@@ -72,6 +76,9 @@ void StreamManagement::resume(quint32 last_handled)
     processAcknowledgement(last_handled);
     sm_timeout_data.waiting_answer = false;
     sm_timeout_data.elapsed_timer.start();
+    // everything left in the queue is going to be resent and was never requested on this stream
+    sm_request_data.stanzas = int(state_.send_queue.size());
+    sm_request_data.bytes   = state_.send_queue_bytes;
 }
 
 void StreamManagement::setLocation(const QString &host, int port)
@@ -80,6 +87,12 @@ void StreamManagement::setLocation(const QString &host, int port)
     state_.resumption_location.port = quint16(port);
 }
 
+void StreamManagement::setUnackedLimits(int stanzas, qint64 bytes)
+{
+    sm_request_data.max_unacked       = stanzas > 0 ? stanzas : SM_DEFAULT_MAX_UNACKED_STANZAS;
+    sm_request_data.max_unacked_bytes = bytes > 0 ? bytes : SM_DEFAULT_MAX_UNACKED_BYTES;
+}
+
 int StreamManagement::lastAckElapsed() const
 {
     if (!sm_timeout_data.elapsed_timer.isValid())
@@ -92,6 +105,40 @@ int StreamManagement::lastAckElapsed() const
     return secs;
 }
 
+/**
+ * Returns how many seconds since the last ack may pass before the next request (or before the
+ * connection is considered dead if a request is already unanswered).
+ * With nothing to confirm it's just a liveness check, otherwise a few stanzas shouldn't wait too long.
+ */
+int StreamManagement::ackRequestInterval() const
+{
+    if (sm_timeout_data.waiting_answer || !sm_request_data.stanzas)
+        return SM_TIMER_INTERVAL_SECS;
+    return SM_ACK_DELAY_SECS;
+}
+
+bool StreamManagement::isOverLimits() const
+{
+    return state_.send_queue.size() >= sm_request_data.max_unacked
+        || state_.send_queue_bytes >= sm_request_data.max_unacked_bytes;
+}
+
+/**
+ * Checks if an ack has to be requested right after the last sent stanza.
+ * It happens once a batch of stanzas or bytes is sent, so a burst costs a few requests and its
+ * memory is released early. If the queue reaches its limits one more request is sent even when
+ * the previous one wasn't answered yet.
+ */
+bool StreamManagement::isAckRequestNeeded() const
+{
+    if (!sm_request_data.stanzas)
+        return false;
+    if (sm_timeout_data.waiting_answer)
+        return !sm_request_data.over_limits && isOverLimits();
+    return sm_request_data.stanzas >= SM_ACK_BATCH_STANZAS || sm_request_data.bytes >= SM_ACK_BATCH_BYTES
+        || isOverLimits();
+}
+
 int StreamManagement::takeAckedCount()
 {
     int cnt           = sm_stanzas_notify;
@@ -107,16 +154,19 @@ void StreamManagement::countInputRawData(int bytes)
     }
 }
 
-QDomElement StreamManagement::getUnacknowledgedStanza()
+QByteArray StreamManagement::getUnacknowledgedStanza()
 {
     if (sm_resend_pos < state_.send_queue.size())
         return state_.send_queue.at(sm_resend_pos++);
-    return QDomElement();
+    return QByteArray();
 }
 
-int StreamManagement::addUnacknowledgedStanza(const QDomElement &e)
+int StreamManagement::addUnacknowledgedStanza(const QByteArray &data)
 {
-    state_.send_queue.enqueue(e);
+    state_.send_queue.enqueue(data);
+    state_.send_queue_bytes += data.size();
+    ++sm_request_data.stanzas;
+    sm_request_data.bytes += data.size();
     int len = state_.send_queue.length();
 #ifdef IRIS_SM_DEBUG
     qDebug() << "Stream Management: [INF] Send queue length is changed: " << len;
@@ -132,13 +182,17 @@ void StreamManagement::processAcknowledgement(quint32 last_handled)
     bool f = false;
 #endif
     while (!state_.send_queue.isEmpty() && state_.server_last_handled != last_handled) {
-        state_.send_queue.dequeue();
+        state_.send_queue_bytes -= state_.send_queue.dequeue().size();
         ++state_.server_last_handled;
         ++sm_stanzas_notify;
 #ifdef IRIS_SM_DEBUG
         f = true;
 #endif
     }
+    // the server may confirm more than was requested
+    sm_request_data.over_limits = false;
+    sm_request_data.stanzas     = qMin(sm_request_data.stanzas, int(state_.send_queue.size()));
+    sm_request_data.bytes       = qMin(sm_request_data.bytes, state_.send_queue_bytes);
 #ifdef IRIS_SM_DEBUG
     if (f) {
         qDebug() << "Stream Management: [INF] Send queue length is changed: " << state_.send_queue.length();
@@ -159,15 +213,20 @@ void StreamManagement::markStanzaHandled()
 
 QDomElement StreamManagement::generateRequestStanza(QDomDocument &doc)
 {
-    if (!sm_timeout_data.waiting_answer) {
-#ifdef IRIS_SM_DEBUG
-        qDebug() << "Stream Management: [?->] Sending request of acknowledgment to server";
-#endif
+    if (sm_timeout_data.waiting_answer) {
+        if (!isAckRequestNeeded())
+            return QDomElement();
+        sm_request_data.over_limits = true; // and keep the timer of the first request
+    } else {
         sm_timeout_data.waiting_answer = true;
         sm_timeout_data.elapsed_timer.start();
-        return doc.createElementNS(NS_STREAM_MANAGEMENT, "r");
     }
-    return QDomElement();
+#ifdef IRIS_SM_DEBUG
+    qDebug() << "Stream Management: [?->] Sending request of acknowledgment to server";
+#endif
+    sm_request_data.stanzas = 0;
+    sm_request_data.bytes   = 0;
+    return doc.createElementNS(NS_STREAM_MANAGEMENT, "r");
 }
 
 QDomElement StreamManagement::makeResponseStanza(QDomDocument &doc)
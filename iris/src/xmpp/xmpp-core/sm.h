@@ -20,6 +20,7 @@
 #ifndef XMPP_SM_H
 #define XMPP_SM_H
 
+#include <QByteArray>
 #include <QDomElement>
 #include <QElapsedTimer>
 #include <QObject>
@@ -27,6 +28,11 @@
 
 #define NS_STREAM_MANAGEMENT "urn:xmpp:sm:3"
 #define SM_TIMER_INTERVAL_SECS 40
+#define SM_ACK_DELAY_SECS 5 // how long a few unacknowledged stanzas may wait for a request
+#define SM_ACK_BATCH_STANZAS 8
+#define SM_ACK_BATCH_BYTES 32768
+#define SM_DEFAULT_MAX_UNACKED_STANZAS 200
+#define SM_DEFAULT_MAX_UNACKED_BYTES (512 * 1024)
 
 // #define IRIS_SM_DEBUG
 
@@ -44,7 +50,8 @@ public:
     bool                enabled;
     quint32             received_count;
     quint32             server_last_handled;
-    QQueue<QDomElement> send_queue;
+    QQueue<QByteArray>  send_queue; // unacknowledged stanzas exactly as they were written
+    qint64              send_queue_bytes;
     QString             resumption_id;
     struct {
         QString host;
@@ -63,17 +70,22 @@ public:
     void                 start(const QString &resumption_id);
     void                 resume(quint32 last_handled);
     void                 setLocation(const QString &host, int port);
+    void                 setUnackedLimits(int stanzas, qint64 bytes);
     int                  lastAckElapsed() const;
+    int                  ackRequestInterval() const;
+    bool                 isAckRequestNeeded() const;
     int                  takeAckedCount();
     void                 countInputRawData(int bytes);
-    QDomElement          getUnacknowledgedStanza();
-    int                  addUnacknowledgedStanza(const QDomElement &e);
+    QByteArray           getUnacknowledgedStanza();
+    int                  addUnacknowledgedStanza(const QByteArray &data);
     void                 processAcknowledgement(quint32 last_handled);
     void                 markStanzaHandled();
     QDomElement          generateRequestStanza(QDomDocument &doc);
     QDomElement          makeResponseStanza(QDomDocument &doc);
 
 private:
+    bool isOverLimits() const;
+
     SMState state_;
     bool    sm_started;
     bool    sm_resumed;
@@ -83,6 +95,13 @@ private:
         QElapsedTimer elapsed_timer;
         bool          waiting_answer = false;
     } sm_timeout_data;
+    struct {
+        int    stanzas           = 0; // sent after the last <r/>
+        qint64 bytes             = 0;
+        bool   over_limits       = false; // extra <r/> was sent because of the limits. don't repeat it till an answer
+        int    max_unacked       = SM_DEFAULT_MAX_UNACKED_STANZAS;
+        qint64 max_unacked_bytes = SM_DEFAULT_MAX_UNACKED_BYTES;
+    } sm_request_data;
 };
 } // namespace XMPP
 
@@ -0,0 +1,238 @@
+/*
+ * stanzaserializer.cpp - direct DOM to UTF-8 xml writer for outgoing stanzas
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "stanzaserializer.h"
+
+#include <QDomNamedNodeMap>
+
+#define NS_XML "http://www.w3.org/XML/1998/namespace"
+
+namespace XMPP {
+
+namespace {
+    enum class Escape { None, Text, Attribute };
+
+    inline bool lowSurrogate(ushort ch) { return ch >= 0xDC00 && ch <= 0xDFFF; }
+
+    inline bool highSurrogate(ushort ch) { return ch >= 0xD800 && ch <= 0xDBFF; }
+
+    // Encodes s to UTF-8 and escapes it in the same loop.
+    // See validChar() in xmlprotocol.cpp for the allowed range.
+    void appendUtf8(QByteArray &out, const QString &s, Escape mode)
+    {
+        const QChar *p   = s.constData();
+        const int    len = int(s.size());
+        for (int i = 0; i < len; ++i) {
+            const ushort c = p[i].unicode();
+            if (c < 0x80) {
+                if (mode != Escape::None) {
+                    switch (c) {
+                    case '&':
+                        out.append("&amp;", 5);
+                        continue;
+                    case '<':
+                        out.append("&lt;", 4);
+                        continue;
+                    case '>':
+                        out.append("&gt;", 4);
+                        continue;
+                    case '"':
+                        if (mode == Escape::Attribute) {
+                            out.append("&quot;", 6);
+                            continue;
+                        }
+                        break;
+                    case '\t':
+                    case '\n':
+                    case '\r':
+                        if (mode == Escape::Attribute) {
+                            // keep whitespace in attributes from being normalized by the receiver
+                            out.append(c == '\t' ? "&#9;" : c == '\n' ? "&#10;" : "&#13;");
+                            continue;
+                        }
+                        break;
+                    default:
+                        if (c < 0x20) {
+                            qDebug("Dropping invalid XML char U+%04x", c);
+                            continue;
+                        }
+                    }
+                }
+                out.append(char(c));
+            } else if (c < 0x800) {
+                out.append(char(0xC0 | (c >> 6)));
+                out.append(char(0x80 | (c & 0x3F)));
+            } else if (highSurrogate(c) && i + 1 < len && lowSurrogate(p[i + 1].unicode())) {
+                const uint u = 0x10000 + ((uint(c) - 0xD800) << 10) + (uint(p[i + 1].unicode()) - 0xDC00);
+                ++i;
+                out.append(char(0xF0 | (u >> 18)));
+                out.append(char(0x80 | ((u >> 12) & 0x3F)));
+                out.append(char(0x80 | ((u >> 6) & 0x3F)));
+                out.append(char(0x80 | (u & 0x3F)));
+            } else if (highSurrogate(c) || lowSurrogate(c) || c == 0xFFFE || c == 0xFFFF) {
+                qDebug("Dropping invalid XML char U+%04x", c);
+            } else {
+                out.append(char(0xE0 | (c >> 12)));
+                out.append(char(0x80 | ((c >> 6) & 0x3F)));
+                out.append(char(0x80 | (c & 0x3F)));
+            }
+        }
+    }
+
+    inline void appendQName(QByteArray &out, const QString &prefix, const QString &name)
+    {
+        if (!prefix.isEmpty()) {
+            appendUtf8(out, prefix, Escape::None);
+            out.append(':');
+        }
+        appendUtf8(out, name, Escape::None);
+    }
+
+    inline void appendAttribute(QByteArray &out, const QString &prefix, const QString &name, const QString &value)
+    {
+        out.append(' ');
+        appendQName(out, prefix, name);
+        out.append("=\"", 2);
+        appendUtf8(out, value, Escape::Attribute);
+        out.append('"');
+    }
+} // namespace
+
+void StanzaSerializer::setRootElement(const QDomElement &root)
+{
+    rootScope.clear();
+    if (!root.namespaceURI().isEmpty())
+        rootScope.push_back({ root.prefix().isNull() ? QString::fromLatin1("") : root.prefix(), root.namespaceURI() });
+
+    // extra namespaces of the root are set as attributes. see BasicProtocol::docElement()
+    QDomNamedNodeMap al = root.attributes();
+    for (int i = 0; i < al.count(); ++i) {
+        QDomAttr a    = al.item(i).toAttr();
+        QString  name = a.name();
+        if (name == QLatin1String("xmlns"))
+            rootScope.push_back({ QString::fromLatin1(""), a.value() });
+        else if (name.startsWith(QLatin1String("xmlns:")))
+            rootScope.push_back({ name.mid(6), a.value() });
+    }
+}
+
+void StanzaSerializer::clear() { rootScope.clear(); }
+
+int StanzaSerializer::serialize(const QDomElement &e, QByteArray &out) const
+{
+    auto start = out.size();
+    auto scope = rootScope;
+    writeElement(e, scope, out);
+    return int(out.size() - start);
+}
+
+QByteArray StanzaSerializer::toUtf8(const QDomElement &e) const
+{
+    QByteArray ret;
+    serialize(e, ret);
+    return ret;
+}
+
+void StanzaSerializer::writeElement(const QDomElement &e, std::vector<Binding> &scope, QByteArray &out) const
+{
+    auto lookup = [&scope](const QString &prefix) -> const QString * {
+        for (auto it = scope.crbegin(); it != scope.crend(); ++it) {
+            if (it->prefix == prefix)
+                return &it->uri;
+        }
+        return nullptr;
+    };
+
+    const auto       scopeSize = scope.size();
+    QDomNamedNodeMap al        = e.attributes();
+    QString          ns        = e.namespaceURI();
+    QString          prefix    = e.prefix().isNull() ? QString::fromLatin1("") : e.prefix();
+    QString          name      = e.localName().isEmpty() ? e.tagName() : e.localName();
+    if (ns.isNull()) {
+        // created with createElement(). the namespace may be set as a plain attribute
+        QDomAttr xmlns = e.attributeNode(QStringLiteral("xmlns"));
+        if (!xmlns.isNull())
+            ns = xmlns.value();
+    }
+
+    out.append('<');
+    appendQName(out, prefix, name);
+    if (!ns.isNull()) {
+        auto current = lookup(prefix);
+        if (!current || *current != ns) {
+            appendAttribute(out, prefix.isEmpty() ? QString() : QString::fromLatin1("xmlns"),
+                            prefix.isEmpty() ? QString::fromLatin1("xmlns") : prefix, ns);
+            scope.push_back({ prefix, ns });
+        }
+    }
+
+    for (int i = 0; i < al.count(); ++i) {
+        QDomAttr a   = al.item(i).toAttr();
+        QString  ans = a.namespaceURI();
+        if (ans.isNull()) {
+            QString aname = a.name();
+            if (aname == QLatin1String("xmlns"))
+                continue; // already handled above
+            if (aname.startsWith(QLatin1String("xmlns:")))
+                scope.push_back({ aname.mid(6), a.value() });
+            appendAttribute(out, QString(), aname, a.value());
+        } else if (ans == QLatin1String(NS_XML)) {
+            appendAttribute(out, QString::fromLatin1("xml"), a.localName(), a.value());
+        } else {
+            QString aprefix = a.prefix();
+            if (aprefix.isEmpty()) {
+                // the default namespace doesn't apply to attributes. reuse a prefix bound to it or make one up
+                for (auto it = scope.crbegin(); it != scope.crend() && aprefix.isEmpty(); ++it) {
+                    if (!it->prefix.isEmpty() && it->uri == ans && *lookup(it->prefix) == ans)
+                        aprefix = it->prefix;
+                }
+                for (int n = 1; aprefix.isEmpty(); ++n) {
+                    auto candidate = QString::fromLatin1("ns%1").arg(n);
+                    if (!lookup(candidate))
+                        aprefix = candidate;
+                }
+            }
+            auto current = lookup(aprefix);
+            if (!current || *current != ans) {
+                appendAttribute(out, QString::fromLatin1("xmlns"), aprefix, ans);
+                scope.push_back({ aprefix, ans });
+            }
+            appendAttribute(out, aprefix, a.localName(), a.value());
+        }
+    }
+
+    QDomNode n = e.firstChild();
+    if (n.isNull()) {
+        out.append("/>", 2);
+    } else {
+        out.append('>');
+        for (; !n.isNull(); n = n.nextSibling()) {
+            if (n.isElement())
+                writeElement(n.toElement(), scope, out);
+            else if (n.isText()) // CDATA sections are text too
+                appendUtf8(out, n.nodeValue(), Escape::Text);
+        }
+        out.append("</", 2);
+        appendQName(out, prefix, name);
+        out.append('>');
+    }
+    scope.resize(scopeSize);
+}
+
+} // namespace XMPP
@@ -0,0 +1,64 @@
+/*
+ * stanzaserializer.h - direct DOM to UTF-8 xml writer for outgoing stanzas
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XMPP_STANZASERIALIZER_H
+#define XMPP_STANZASERIALIZER_H
+
+#include <QByteArray>
+#include <QDomElement>
+#include <QString>
+
+#include <vector>
+
+namespace XMPP {
+
+/*
+ * Writes a stream level element as escaped UTF-8 in one pass over the DOM, without cloning it.
+ *
+ * Namespaces are tracked against the stream root element, so only declarations really differing
+ * from the parent scope are emitted. Elements without namespace inherit the namespace of their
+ * parent, and a plain "xmlns" attribute is treated as a namespace declaration, which makes the
+ * output the same as if the element went through addCorrectNS() first.
+ * As required by XMPP-Core '>' is always escaped and chars not allowed in XML are dropped.
+ */
+class StanzaSerializer {
+public:
+    // takes default namespace and prefix bindings from the root element (e.g. <stream:stream>)
+    void setRootElement(const QDomElement &root);
+    void clear();
+
+    // appends the element to out and returns the number of bytes written
+    int serialize(const QDomElement &e, QByteArray &out) const;
+
+    QByteArray toUtf8(const QDomElement &e) const;
+
+private:
+    struct Binding {
+        QString prefix; // empty for default namespace
+        QString uri;
+    };
+
+    void writeElement(const QDomElement &e, std::vector<Binding> &scope, QByteArray &out) const;
+
+    std::vector<Binding> rootScope;
+};
+
+} // namespace XMPP
+
+#endif // XMPP_STANZASERIALIZER_H
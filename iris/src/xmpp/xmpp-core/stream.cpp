@@ -51,9 +51,11 @@
 #ifdef XMPP_TEST
 #include "td.h"
 #endif
+#include "xmpp_streamcapture.h"
 
 #include <QByteArray>
 #include <QList>
+#include <QMetaMethod>
 #include <QPointer>
 #include <QTextStream>
 #include <QTimer>
@@ -138,6 +140,8 @@ public:
         sasl_ssf   = 0;
         tls_warned = false;
         using_tls  = false;
+        corked     = false;
+        outgoing.clear();
     }
 
     Jid                    jid;
@@ -157,15 +161,16 @@ public:
 
     bool in_rrsig = false;
 
-    Connector    *conn       = nullptr;
-    ByteStream   *bs         = nullptr;
-    TLSHandler   *tlsHandler = nullptr;
-    QCA::TLS     *tls        = nullptr;
-    QCA::SASL    *sasl       = nullptr;
-    SecureStream *ss         = nullptr;
-    CoreProtocol  client;
-    CoreProtocol  srv;
-    QString       lang;
+    Connector     *conn       = nullptr;
+    ByteStream    *bs         = nullptr;
+    TLSHandler    *tlsHandler = nullptr;
+    QCA::TLS      *tls        = nullptr;
+    QCA::SASL     *sasl       = nullptr;
+    SecureStream  *ss         = nullptr;
+    StreamCapture *capture    = nullptr;
+    CoreProtocol   client;
+    CoreProtocol   srv;
+    QString        lang;
 
     QString defRealm;
 
@@ -177,7 +182,8 @@ public:
     bool tls_warned = false;
     bool using_tls;
     bool doAuth;
-    bool doCompress = false;
+    bool doCompress       = false;
+    int  compressionLevel = -1;
 
     QStringList sasl_mechlist;
 
@@ -188,6 +194,10 @@ public:
 
     QList<Stanza *> in;
 
+    // stanzas written during one event loop iteration are processed at once. see ClientStream::write()
+    bool       corked = false;
+    QByteArray outgoing; // data of consecutive ESend steps, written to the SecureStream in one go
+
     QTimer timeout_timer;
     QTimer noopTimer;
     int    noop_time;
@@ -221,6 +231,7 @@ ClientStream::ClientStream(const QString &host, const QString &defRealm, ByteStr
     [[maybe_unused]] QByteArray spare = d->bs->readAll();
 
     d->ss = new SecureStream(d->bs);
+    d->ss->setCapture(d->capture);
     connect(d->ss, SIGNAL(readyRead()), SLOT(ss_readyRead()));
     connect(d->ss, SIGNAL(bytesWritten(qint64)), SLOT(ss_bytesWritten(qint64)));
     connect(d->ss, SIGNAL(tlsHandshaken()), SLOT(ss_tlsHandshaken()));
@@ -463,6 +474,25 @@ void ClientStream::setLocalAddr(const QHostAddress &addr, quint16 port)
 
 void ClientStream::setCompress(bool compress) { d->doCompress = compress; }
 
+void ClientStream::setCompressionLevel(int level) { d->compressionLevel = level; }
+
+bool ClientStream::isCompressed() const { return d->ss && d->ss->compressionStats(); }
+
+ClientStream::CompressionStats ClientStream::compressionStats() const
+{
+    CompressionStats ret;
+    auto             s = d->ss ? d->ss->compressionStats() : nullptr;
+    if (s) {
+        ret.plainOut      = s->plainOut;
+        ret.compressedOut = s->compressedOut;
+        ret.compressedIn  = s->compressedIn;
+        ret.plainIn       = s->plainIn;
+        ret.deflateNsecs  = s->deflateNsecs;
+        ret.inflateNsecs  = s->inflateNsecs;
+    }
+    return ret;
+}
+
 int ClientStream::errorCondition() const { return d->errCond; }
 
 QString ClientStream::errorText() const { return d->errText; }
@@ -476,6 +506,8 @@ bool ClientStream::old() const { return d->client.old; }
 void ClientStream::close()
 {
     if (d->state == Active) {
+        if (d->corked)
+            processNext(); // send what was written before closing
         d->state = Closing;
         d->client.shutdown();
         processNext();
@@ -518,7 +550,15 @@ void ClientStream::write(const Stanza &s)
 {
     if (d->state == Active) {
         d->client.sendStanza(s.element());
-        processNext();
+        // Don't push each stanza through compression/TLS separately. Everything written till
+        // we return to the event loop goes out as one chunk (e.g. presence to all the rooms)
+        if (!d->corked) {
+            d->corked = true;
+            QTimer::singleShot(0, this, [this]() {
+                if (d->corked)
+                    processNext();
+            });
+        }
     }
 }
 
@@ -534,6 +574,7 @@ void ClientStream::cr_connected()
     QByteArray spare = d->bs->readAll();
 
     d->ss = new SecureStream(d->bs);
+    d->ss->setCapture(d->capture);
     connect(d->ss, SIGNAL(readyRead()), SLOT(ss_readyRead()));
     connect(d->ss, SIGNAL(bytesWritten(qint64)), SLOT(ss_bytesWritten(qint64)));
     connect(d->ss, SIGNAL(tlsHandshaken()), SLOT(ss_tlsHandshaken()));
@@ -597,7 +638,9 @@ void ClientStream::bs_error(int)
 
 void ClientStream::ss_readyRead()
 {
-    QByteArray a = d->ss->readAll();
+    QByteArray a = d->ss->readShared();
+    if (d->capture && d->capture->isCapturing(StreamCapture::Xml))
+        d->capture->append(StreamCapture::Incoming, a);
 
 #ifdef XMPP_DEBUG
     qDebug("ClientStream: recv: %d [%s]\n", a.size(), a.data());
@@ -817,6 +860,8 @@ void ClientStream::srvProcessNext()
 #ifdef XMPP_DEBUG
                 qDebug("Need Send: {%s}\n", a.data());
 #endif
+                if (d->capture && d->capture->isCapturing(StreamCapture::Xml))
+                    d->capture->append(StreamCapture::Outgoing, a);
                 d->ss->write(a);
             }
             break;
@@ -875,28 +920,36 @@ void ClientStream::processNext()
     }
 
     QPointer<QObject> self = this;
+    d->corked              = false; // the send queue is processed below
 
     while (1) {
 #ifdef XMPP_DEBUG
         qDebug("Processing step...\n");
 #endif
         bool ok = d->client.processStep();
-        // deal with send/received items
-        for (const XmlProtocol::TransferItem &i : std::as_const(d->client.transferItemList)) {
-            if (i.isExternal)
-                continue;
-            QString str;
-            if (i.isString) {
-                // skip whitespace pings
-                if (i.str.trimmed().isEmpty())
+        if (!ok || d->client.event != CoreProtocol::ESend)
+            flushOutgoing(); // before anything may change the security layers
+        // deal with send/received items. don't convert anything to string if nobody listens
+        static const QMetaMethod incomingSignal = QMetaMethod::fromSignal(&ClientStream::incomingXml);
+        static const QMetaMethod outgoingSignal = QMetaMethod::fromSignal(&ClientStream::outgoingXml);
+        bool logXml = isSignalConnected(incomingSignal) || isSignalConnected(outgoingSignal);
+        if (logXml) {
+            for (const XmlProtocol::TransferItem &i : std::as_const(d->client.transferItemList)) {
+                if (i.isExternal)
                     continue;
-                str = i.str;
-            } else
-                str = d->client.elementToString(i.elem);
-            if (i.isSent)
-                emit outgoingXml(str);
-            else
-                emit incomingXml(str);
+                QString str;
+                if (i.isString) {
+                    // skip whitespace pings
+                    if (i.str.trimmed().isEmpty())
+                        continue;
+                    str = i.str;
+                } else
+                    str = d->client.elementToString(i.element());
+                if (i.isSent)
+                    emit outgoingXml(str);
+                else
+                    emit incomingXml(str);
+            }
         }
 
 #ifdef XMPP_DEBUG
@@ -948,7 +1001,7 @@ void ClientStream::processNext()
 #ifdef XMPP_DEBUG
                 qDebug("Need Send: {%s}\n", a.data());
 #endif
-                d->ss->write(a);
+                d->outgoing += a;
             }
             break;
         }
@@ -1114,7 +1167,7 @@ bool ClientStream::handleNeed()
 #ifdef XMPP_DEBUG
         qDebug("Need compress\n");
 #endif
-        d->ss->setLayerCompress(d->client.spare);
+        d->ss->setLayerCompress(d->client.spare, d->compressionLevel);
         return true;
     }
     case CoreProtocol::NSASLFirst: {
@@ -1288,6 +1341,17 @@ void ClientStream::sm_timeout()
     }
 }
 
+void ClientStream::flushOutgoing()
+{
+    if (d->outgoing.isEmpty())
+        return;
+    if (d->capture && d->capture->isCapturing(StreamCapture::Xml))
+        d->capture->append(StreamCapture::Outgoing, d->outgoing);
+    QByteArray a;
+    a.swap(d->outgoing);
+    d->ss->write(a);
+}
+
 void ClientStream::doNoop()
 {
     if (d->state == Active) {
@@ -1299,6 +1363,15 @@ void ClientStream::doNoop()
     }
 }
 
+void ClientStream::setCapture(StreamCapture *capture)
+{
+    d->capture = capture;
+    if (d->ss)
+        d->ss->setCapture(capture);
+}
+
+void ClientStream::setTrafficStats(TrafficStats *stats) { d->client.trafficStats = stats; }
+
 void ClientStream::writeDirect(const QString &s)
 {
     if (d->state == Active) {
@@ -1534,6 +1607,8 @@ bool ClientStream::isResumed() const { return d->client.sm.isResumed(); }
 
 void ClientStream::setSMEnabled(bool e) { d->client.sm.state().setEnabled(e); }
 
+void ClientStream::setSMUnackedLimits(int stanzas, qint64 bytes) { d->client.sm.setUnackedLimits(stanzas, bytes); }
+
 void ClientStream::setTimer(int secs)
 {
     d->timeout_timer.setSingleShot(true);
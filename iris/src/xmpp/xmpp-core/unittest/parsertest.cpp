@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "qttestutil/qttestutil.h"
+#include "xmpp/xmpp-core/parser.h"
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+using namespace XMPP;
+
+static const QByteArray STREAM_HEADER
+    = "<?xml version='1.0'?><stream:stream xmlns='jabber:client' xmlns:stream='http://etherx.jabber.org/streams'"
+      " from='example.org' id='s1' version='1.0' xml:lang='en'>";
+
+// namespaces and prefixes, attributes, text and CDATA, and a stream level element
+static const QByteArray STANZAS
+    = "<iq type='result' id='1'><query xmlns='jabber:iq:roster'><item jid='a@example.org'/></query>"
+      "<p:pubsub xmlns:p='http://jabber.org/protocol/pubsub'><p:items node='n'/></p:pubsub>"
+      "<x xmlns=''><y/></x></iq>"
+      "<message to='a@example.org' xml:lang='de' xmlns:e='urn:ext' e:attr='v &amp; &quot;w&quot;'>"
+      "<body a='1' b='2'>x</body></message>"
+      "<message><body>1 &lt; 2 &amp;&amp; &#x1F600; &#169;</body>"
+      "<html xmlns='http://jabber.org/protocol/xhtml-im'><body xmlns='http://www.w3.org/1999/xhtml'>"
+      "a<b>bold</b> c\n</body></html></message>"
+      "<message><body><![CDATA[<b>not a tag</b> & co]]> tail</body></message>"
+      "<stream:features><starttls xmlns='urn:ietf:params:xml:ns:xmpp-tls'/></stream:features>";
+
+static const QByteArray STREAM_CLOSE = "</stream:stream>";
+
+// namespace, name, prefix, attributes and text of the element and its children. adjacent text nodes are merged,
+// since the DOM path adds one per token of the reader
+static QString dump(const QDomElement &e)
+{
+    auto name = [](const QDomNode &n) { return n.localName().isEmpty() ? n.nodeName() : n.localName(); };
+
+    QString     out = QString("<{%1}%2:%3").arg(e.namespaceURI(), e.prefix(), name(e));
+    QStringList attrs;
+    auto        map = e.attributes();
+    for (int i = 0; i < map.count(); i++) {
+        auto a = map.item(i).toAttr();
+        attrs += QString(" {%1}%2:%3='%4'").arg(a.namespaceURI(), a.prefix(), name(a), a.value());
+    }
+    attrs.sort();
+    out += attrs.join(QString()) + QLatin1Char('>');
+
+    QString text;
+    for (auto n = e.firstChild(); !n.isNull(); n = n.nextSibling()) {
+        if (n.isText()) { // CDATA sections are text nodes too
+            text += n.toText().data();
+            continue;
+        }
+        if (!text.isEmpty())
+            out += QString("[%1]").arg(text);
+        text.clear();
+        if (n.isElement())
+            out += dump(n.toElement());
+    }
+    if (!text.isEmpty())
+        out += QString("[%1]").arg(text);
+    return out + QLatin1String("</>");
+}
+
+class ParserTest : public QObject {
+    Q_OBJECT
+
+    static QList<Parser::Event> parse(Parser &parser, const QByteArray &data, int chunkSize)
+    {
+        QList<Parser::Event> events;
+        for (int i = 0; i < data.size(); i += chunkSize) {
+            parser.appendData(data.mid(i, chunkSize));
+            for (auto e = parser.readNext(); !e.isNull(); e = parser.readNext())
+                events += e;
+        }
+        return events;
+    }
+
+    static QList<Parser::Event> parse(Parser::Mode mode, const QByteArray &data, int chunkSize)
+    {
+        Parser parser;
+        parser.setMode(mode);
+        return parse(parser, data, chunkSize);
+    }
+
+    // the tree accessors the stream code uses give the same as the DOM
+    static void compareRef(const XmlTree::Element &ref, const QDomElement &e)
+    {
+        QVERIFY(!ref.isNull());
+        QCOMPARE(ref.namespaceURI().toString(), e.namespaceURI());
+        QCOMPARE(ref.localName().toString(), e.localName().isEmpty() ? e.tagName() : e.localName());
+        QCOMPARE(ref.text(), e.text());
+        auto map = e.attributes();
+        for (int i = 0; i < map.count(); i++) {
+            auto a = map.item(i).toAttr();
+            if (!a.namespaceURI().isEmpty())
+                continue; // not accessible by the plain name
+            QVERIFY(ref.hasAttribute(a.name()));
+            QCOMPARE(ref.attribute(a.name()).toString(), a.value());
+        }
+        auto c = ref.firstChildElement();
+        auto d = e.firstChildElement();
+        for (; !c.isNull() && !d.isNull(); c = c.nextSiblingElement(), d = d.nextSiblingElement())
+            compareRef(c, d);
+        QVERIFY(c.isNull() && d.isNull());
+    }
+
+    static void compareEvents(const QList<Parser::Event> &dom, const QList<Parser::Event> &tree)
+    {
+        QCOMPARE(tree.size(), dom.size());
+        for (int i = 0; i < dom.size(); i++) {
+            QCOMPARE(tree[i].type(), dom[i].type());
+            QCOMPARE(tree[i].namespaceURI(), dom[i].namespaceURI());
+            QCOMPARE(tree[i].localName(), dom[i].localName());
+            QCOMPARE(tree[i].qName(), dom[i].qName());
+            if (dom[i].type() == Parser::Event::DocumentOpen) {
+                QCOMPARE(tree[i].nsprefix(), dom[i].nsprefix());
+                QCOMPARE(tree[i].nsprefix("stream"), dom[i].nsprefix("stream"));
+            }
+            if (dom[i].type() != Parser::Event::Element)
+                continue;
+            QCOMPARE(dump(tree[i].element()), dump(dom[i].element()));
+            QCOMPARE(tree[i].size(), dom[i].size());
+            QVERIFY(dom[i].elementRef().isNull());
+            compareRef(tree[i].elementRef(), dom[i].element());
+        }
+    }
+
+private slots:
+    void testModesAgree()
+    {
+        const QByteArray data = STREAM_HEADER + STANZAS + STREAM_CLOSE;
+        const auto       dom  = parse(Parser::Mode::Dom, data, data.size());
+        QCOMPARE(dom.size(), 7);
+        QCOMPARE(dom.first().type(), Parser::Event::DocumentOpen);
+        QCOMPARE(dom.last().type(), Parser::Event::DocumentClose);
+
+        // what both should give, checked once here on the DOM path
+        auto iq = dom[1].element();
+        QCOMPARE(iq.namespaceURI(), QStringLiteral("jabber:client"));
+        QCOMPARE(iq.firstChildElement("query").namespaceURI(), QStringLiteral("jabber:iq:roster"));
+        QCOMPARE(iq.firstChildElement("pubsub").namespaceURI(), QStringLiteral("http://jabber.org/protocol/pubsub"));
+        QCOMPARE(iq.firstChildElement("x").namespaceURI(), QString());
+        auto msg = dom[2].element();
+        QCOMPARE(msg.attributeNS("urn:ext", "attr"), QStringLiteral("v & \"w\""));
+        QCOMPARE(msg.attributeNS("http://www.w3.org/XML/1998/namespace", "lang"), QStringLiteral("de"));
+        QCOMPARE(dom[3].element().firstChildElement("body").text(),
+                 QString::fromUtf8("1 < 2 && \xf0\x9f\x98\x80 \xc2\xa9"));
+        QCOMPARE(dom[4].element().text(), QStringLiteral("<b>not a tag</b> & co tail"));
+        QCOMPARE(dom[5].element().namespaceURI(), QStringLiteral("http://etherx.jabber.org/streams"));
+
+        compareEvents(dom, parse(Parser::Mode::Tree, data, data.size()));
+        // all at once or a byte at a time, it's the same
+        compareEvents(dom, parse(Parser::Mode::Tree, data, 1));
+        compareEvents(parse(Parser::Mode::Dom, data, 1), parse(Parser::Mode::Tree, data, 1));
+    }
+
+    void testStreamRestart()
+    {
+        // as after STARTTLS or SASL success: the parser is reset and a new stream starts
+        const QByteArray first  = STREAM_HEADER + "<message><body>before</body></message>";
+        const QByteArray second = STREAM_HEADER + STANZAS;
+
+        QList<QList<Parser::Event>> restarted; // dom, tree
+        for (auto mode : { Parser::Mode::Dom, Parser::Mode::Tree }) {
+            Parser parser;
+            parser.setMode(mode);
+            auto before = parse(parser, first, 7);
+            QCOMPARE(before.size(), 2);
+
+            parser.reset();
+            QCOMPARE(parser.mode(), mode);
+            auto after = parse(parser, second, 7);
+            QCOMPARE(after.size(), 6);
+            QCOMPARE(after.first().type(), Parser::Event::DocumentOpen);
+            restarted += after;
+
+            // an element of the old stream is still fine
+            QCOMPARE(before[1].element().text(), QStringLiteral("before"));
+        }
+        compareEvents(restarted[0], restarted[1]);
+        compareEvents(parse(Parser::Mode::Dom, second, second.size()), restarted[1]);
+    }
+
+    void testElementConversion()
+    {
+        const QByteArray data = STREAM_HEADER + STANZAS;
+        Parser           parser;
+        parser.setMode(Parser::Mode::Tree);
+        parser.appendData(STREAM_HEADER);
+        QCOMPARE(parser.readNext().type(), Parser::Event::DocumentOpen);
+        parser.appendData(STANZAS);
+
+        // kept while the parser goes on, so its tree can't be reused for the next elements
+        auto kept = parser.readNext();
+        QCOMPARE(kept.type(), Parser::Event::Element);
+        const auto expected = dump(parse(Parser::Mode::Dom, data, data.size())[1].element());
+        for (int i = 0; i < 4; i++) {
+            auto e = parser.readNext();
+            QCOMPARE(e.type(), Parser::Event::Element);
+            QVERIFY(!e.element().isNull()); // converted and dropped
+        }
+
+        // converted on the first request, once
+        auto copy = kept;
+        auto el   = kept.element();
+        QVERIFY(!el.isNull());
+        QVERIFY(!el.ownerDocument().isNull());
+        QVERIFY(el == kept.element());
+        QVERIFY(el == copy.element());
+        QCOMPARE(dump(el), expected);
+        QCOMPARE(kept.elementRef().localName().toString(), QStringLiteral("iq"));
+
+        // changes to the converted element stay with the event. the tree keeps what was parsed
+        el.setAttribute("id", "2");
+        QCOMPARE(kept.element().attribute("id"), QStringLiteral("2"));
+        QCOMPARE(kept.elementRef().attribute(u"id").toString(), QStringLiteral("1"));
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(ParserTest);
+#include "parsertest.moc"
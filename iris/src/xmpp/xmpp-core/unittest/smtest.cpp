@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "qttestutil/qttestutil.h"
+#include "xmpp/xmpp-core/sm.h"
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+using namespace XMPP;
+
+class StreamManagementTest : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testBatchRequest()
+    {
+        StreamManagement sm;
+        QDomDocument     doc;
+        sm.start(QString());
+        QCOMPARE(sm.ackRequestInterval(), SM_TIMER_INTERVAL_SECS);
+        for (int i = 1; i < SM_ACK_BATCH_STANZAS; ++i) {
+            sm.addUnacknowledgedStanza("<message/>");
+            QVERIFY(!sm.isAckRequestNeeded());
+        }
+        QCOMPARE(sm.ackRequestInterval(), SM_ACK_DELAY_SECS);
+        sm.addUnacknowledgedStanza("<message/>");
+        QVERIFY(sm.isAckRequestNeeded());
+        QVERIFY(!sm.generateRequestStanza(doc).isNull());
+        QVERIFY(!sm.isAckRequestNeeded());
+        QVERIFY(sm.generateRequestStanza(doc).isNull()); // already waiting
+
+        sm.processAcknowledgement(SM_ACK_BATCH_STANZAS);
+        QCOMPARE(sm.takeAckedCount(), SM_ACK_BATCH_STANZAS);
+        QCOMPARE(sm.state().send_queue_bytes, qint64(0));
+    }
+
+    void testBytesRequest()
+    {
+        StreamManagement sm;
+        sm.start(QString());
+        sm.addUnacknowledgedStanza(QByteArray(SM_ACK_BATCH_BYTES, 'x'));
+        QVERIFY(sm.isAckRequestNeeded());
+    }
+
+    void testLimits()
+    {
+        StreamManagement sm;
+        QDomDocument     doc;
+        sm.setUnackedLimits(20, 0);
+        sm.start(QString());
+        for (int i = 0; i < SM_ACK_BATCH_STANZAS; ++i)
+            sm.addUnacknowledgedStanza("<iq/>");
+        QVERIFY(!sm.generateRequestStanza(doc).isNull());
+        for (int i = SM_ACK_BATCH_STANZAS; i < 19; ++i) {
+            sm.addUnacknowledgedStanza("<iq/>");
+            QVERIFY(!sm.isAckRequestNeeded());
+        }
+        // the first request isn't answered yet, but the queue is full
+        sm.addUnacknowledgedStanza("<iq/>");
+        QVERIFY(sm.isAckRequestNeeded());
+        QVERIFY(!sm.generateRequestStanza(doc).isNull());
+        sm.addUnacknowledgedStanza("<iq/>");
+        QVERIFY(!sm.isAckRequestNeeded()); // just once till an answer
+    }
+
+    void testResend()
+    {
+        StreamManagement sm;
+        sm.start(QString());
+        sm.addUnacknowledgedStanza("<message id='1'/>");
+        sm.addUnacknowledgedStanza("<message id='2'/>");
+        sm.addUnacknowledgedStanza("<message id='3'/>");
+        sm.reset(); // reconnection
+        sm.resume(1);
+        QCOMPARE(sm.getUnacknowledgedStanza(), QByteArray("<message id='2'/>"));
+        QCOMPARE(sm.getUnacknowledgedStanza(), QByteArray("<message id='3'/>"));
+        QVERIFY(sm.getUnacknowledgedStanza().isNull());
+        QCOMPARE(sm.state().send_queue_bytes, qint64(34));
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(StreamManagementTest);
+#include "smtest.moc"
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "qttestutil/qttestutil.h"
+#include "xmpp/xmpp-core/protocol.h"
+#include "xmpp/xmpp-core/stanzaserializer.h"
+#include "xmpp/xmpp-im/xmpp_xmlcommon.h"
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+using namespace XMPP;
+
+class StanzaSerializerTest : public QObject {
+    Q_OBJECT
+
+    QDomDocument     doc;
+    StanzaSerializer serializer;
+
+    QDomElement message()
+    {
+        QDomElement m = doc.createElementNS(NS_CLIENT, "message");
+        m.setAttribute("to", "room@conference.example.com");
+        m.setAttribute("type", "groupchat");
+        m.setAttribute("id", "a1b2c3d4");
+        m.appendChild(textTag(&doc, "body", QString::fromUtf8("Hello <world> & \"friends\" \xF0\x9F\x98\x80")));
+        QDomElement active = doc.createElementNS("http://jabber.org/protocol/chatstates", "active");
+        m.appendChild(active);
+        QDomElement origin = doc.createElementNS("urn:xmpp:sid:0", "origin-id");
+        origin.setAttribute("id", "a1b2c3d4");
+        m.appendChild(origin);
+        return m;
+    }
+
+    QDomElement presence()
+    {
+        QDomElement p = doc.createElement("presence");
+        p.setAttribute("to", "room@conference.example.com/nick");
+        p.appendChild(textTag(&doc, "show", "away"));
+        p.appendChild(textTag(&doc, "status", "Lunch"));
+        QDomElement c = doc.createElementNS("http://jabber.org/protocol/caps", "c");
+        c.setAttribute("hash", "sha-1");
+        c.setAttribute("node", "https://psi-plus.com");
+        c.setAttribute("ver", "q07IKJEyjvHSyhy//CH0CxmKi8w=");
+        p.appendChild(c);
+        return p;
+    }
+
+    QDomElement iq()
+    {
+        QDomElement i = createIQ(&doc, "set", "", "roster_1");
+        QDomElement q = doc.createElement("query");
+        q.setAttribute("xmlns", "jabber:iq:roster");
+        QDomElement item = doc.createElement("item");
+        item.setAttribute("jid", "juliet@example.com");
+        item.setAttribute("name", "Juliet");
+        item.appendChild(textTag(&doc, "group", "Friends"));
+        q.appendChild(item);
+        i.appendChild(q);
+        return i;
+    }
+
+    QByteArray oldPath(CoreProtocol &p, const QDomElement &e) { return p.elementToString(addCorrectNS(e)).toUtf8(); }
+
+private slots:
+    void initTestCase()
+    {
+        QDomElement root = doc.createElementNS(NS_ETHERX, "stream:stream");
+        root.setAttribute("xmlns", NS_CLIENT);
+        serializer.setRootElement(root);
+    }
+
+    void testDefaultNamespaceIsOmitted()
+    {
+        QCOMPARE(serializer.toUtf8(doc.createElementNS(NS_CLIENT, "presence")), QByteArray("<presence/>"));
+    }
+
+    void testEscaping()
+    {
+        QDomElement e = doc.createElementNS(NS_CLIENT, "message");
+        e.setAttribute("id", "a\"b<c>");
+        e.appendChild(doc.createTextNode(QString::fromLatin1("x>y&z") + QChar(0x1)));
+        QCOMPARE(serializer.toUtf8(e), QByteArray("<message id=\"a&quot;b&lt;c&gt;\">x&gt;y&amp;z</message>"));
+    }
+
+    void testInheritedAndHardcodedNamespaces()
+    {
+        // note: QDom doesn't keep attributes order, so only one attribute per element here
+        QDomElement i = createIQ(&doc, "get", "", "");
+        QDomElement q = doc.createElement("query");
+        q.setAttribute("xmlns", "jabber:iq:roster");
+        q.appendChild(doc.createElement("item"));
+        i.appendChild(q);
+        QCOMPARE(serializer.toUtf8(i),
+                 QByteArray("<iq type=\"get\"><query xmlns=\"jabber:iq:roster\"><item/></query></iq>"));
+    }
+
+    void testNamespacedAttributeWithoutPrefix()
+    {
+        QDomElement x = doc.createElementNS("urn:test", "x");
+        x.setAttributeNS("urn:attr", "name", "v");
+        QDomElement y = doc.createElementNS("urn:test", "y");
+        y.setAttributeNS("urn:attr", "name", "w"); // the prefix of the parent is reused
+        x.appendChild(y);
+        QCOMPARE(serializer.toUtf8(x),
+                 QByteArray("<x xmlns=\"urn:test\" xmlns:ns1=\"urn:attr\" ns1:name=\"v\"><y ns1:name=\"w\"/></x>"));
+    }
+
+    void testSurrogatePairs()
+    {
+        QDomElement e = doc.createElementNS(NS_CLIENT, "body");
+        e.appendChild(doc.createTextNode(QString::fromUtf8("\xF0\x9F\x98\x80") + QChar(0xD800)));
+        QCOMPARE(serializer.toUtf8(e), QByteArray("<body>\xF0\x9F\x98\x80</body>"));
+    }
+
+    void benchmarkOldPath_data()
+    {
+        QTest::addColumn<int>("kind");
+        QTest::newRow("message") << 0;
+        QTest::newRow("presence") << 1;
+        QTest::newRow("iq") << 2;
+    }
+
+    void benchmarkOldPath()
+    {
+        QFETCH(int, kind);
+        CoreProtocol p;
+        QDomElement  e = kind == 0 ? message() : kind == 1 ? presence() : iq();
+        QBENCHMARK { oldPath(p, e); }
+    }
+
+    void benchmarkSerializer_data() { benchmarkOldPath_data(); }
+
+    void benchmarkSerializer()
+    {
+        QFETCH(int, kind);
+        QDomElement e = kind == 0 ? message() : kind == 1 ? presence() : iq();
+        QByteArray  out;
+        QBENCHMARK
+        {
+            out.resize(0);
+            serializer.serialize(e, out);
+        }
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(StanzaSerializerTest);
+#include "stanzaserializertest.moc"
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "qttestutil/qttestutil.h"
+#include "xmpp/xmpp-core/parser.h"
+#include "xmpp/xmpp-core/xmpp_trafficstats.h"
+
+#include <QDomDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QtTest/QtTest>
+
+using namespace XMPP;
+
+class TrafficStatsTest : public QObject {
+    Q_OBJECT
+
+    static QDomElement parse(QDomDocument &doc, const QString &xml)
+    {
+        doc.setContent(xml, true);
+        return doc.documentElement();
+    }
+
+private slots:
+    void testKeyIsPayloadNamespace()
+    {
+        QDomDocument doc;
+        auto         key = TrafficStats::keyOf(parse(doc,
+                                                "<message xmlns='jabber:client'><body>hi</body>"
+                                                        "<active xmlns='http://jabber.org/protocol/chatstates'/></message>"));
+        QCOMPARE(key.first, QString("message"));
+        QCOMPARE(key.second, QString("http://jabber.org/protocol/chatstates"));
+
+        key = TrafficStats::keyOf(parse(doc, "<presence xmlns='jabber:client'><show>away</show></presence>"));
+        QCOMPARE(key.first, QString("presence"));
+        QVERIFY(key.second.isEmpty());
+    }
+
+    void testCounters()
+    {
+        QDomDocument doc;
+        TrafficStats stats;
+        auto         iq = parse(doc, "<iq xmlns='jabber:client' type='result'><query xmlns='jabber:iq:roster'/></iq>");
+        stats.addStanza(TrafficStats::Incoming, iq, 100, 5000);
+        stats.addStanza(TrafficStats::Incoming, iq, 50, 1000);
+        stats.addDispatch(iq, 20000);
+        stats.addStanza(TrafficStats::Outgoing, iq, 70);
+
+        const auto in = stats.incoming().value({ "iq", "jabber:iq:roster" });
+        QCOMPARE(in.stanzas, quint64(2));
+        QCOMPARE(in.bytes, quint64(150));
+        QCOMPARE(in.parse, qint64(6));
+        QCOMPARE(in.maxDispatch, qint64(20));
+        QCOMPARE(stats.outgoing().value({ "iq", "jabber:iq:roster" }).bytes, quint64(70));
+        QVERIFY(stats.since() > 0);
+
+        stats.reset();
+        QVERIFY(stats.incoming().isEmpty());
+        QCOMPARE(stats.since(), qint64(0));
+    }
+
+    void testIncomingSizeInBytes()
+    {
+        const QByteArray header = "<stream:stream xmlns='jabber:client' "
+                                  "xmlns:stream='http://etherx.jabber.org/streams'>";
+        const QByteArray body   = "<message><body>\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 \xf0\x9f\x98\x80"
+                                  "</body></message>";
+        for (auto mode : { Parser::Mode::Dom, Parser::Mode::Tree }) {
+            Parser parser;
+            parser.setMode(mode);
+            parser.appendData(header);
+            QCOMPARE(parser.readNext().type(), Parser::Event::DocumentOpen);
+            parser.appendData(" ");           // whitespace ping doesn't count
+            parser.appendData(body.left(20)); // split inside a multibyte character
+            parser.appendData(body.mid(20));
+            parser.appendData(body);
+
+            for (int i = 0; i < 2; i++) {
+                auto e = parser.readNext();
+                QCOMPARE(e.type(), Parser::Event::Element);
+                QCOMPARE(e.size(), qint64(body.size()));
+            }
+        }
+    }
+
+    void testHistogram()
+    {
+        TrafficStats::Histogram h;
+        for (int i = 0; i < 90; ++i)
+            h.add(300); // below 512
+        for (int i = 0; i < 10; ++i)
+            h.add(70000); // below 131072
+        QCOMPARE(h.count, quint64(100));
+        QCOMPARE(h.percentile(0.5), qint64(512));
+        QCOMPARE(h.percentile(0.95), qint64(70000)); // not above the max
+        QCOMPARE(h.max, qint64(70000));
+        QCOMPARE(h.average(), qint64(7270));
+    }
+
+    void testIqJson()
+    {
+        TrafficStats stats;
+        stats.addIqRoundTrip("jabber:iq:version", 2000000, false);
+        stats.addIqRoundTrip("jabber:iq:version", 4000000, true);
+        stats.addIqTimeout("jabber:iq:version");
+
+        const auto iq = stats.toJson().value("iq").toArray();
+        QCOMPARE(iq.size(), 1);
+        const auto o = iq.at(0).toObject();
+        QCOMPARE(o.value("ns").toString(), QString("jabber:iq:version"));
+        QCOMPARE(o.value("errors").toInt(), 1);
+        QCOMPARE(o.value("timeouts").toInt(), 1);
+        QCOMPARE(o.value("latency").toObject().value("count").toInt(), 2);
+        QCOMPARE(o.value("latency").toObject().value("maxUs").toInt(), 4000);
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(TrafficStatsTest);
+#include "trafficstatstest.moc"
@@ -245,7 +245,23 @@ XmlProtocol::TransferItem::TransferItem(const QDomElement &_elem, bool sent, boo
 {
 }
 
-XmlProtocol::XmlProtocol() { init(); }
+XmlProtocol::TransferItem::TransferItem(const Parser::Event &_event, bool sent, bool external) :
+    isSent(sent), isString(false), isExternal(external), event(_event)
+{
+}
+
+QDomElement XmlProtocol::TransferItem::element() const
+{
+    if (elem.isNull())
+        return event.element();
+    return elem;
+}
+
+XmlProtocol::XmlProtocol()
+{
+    init();
+    xml.setMode(Parser::Mode::Tree);
+}
 
 XmlProtocol::~XmlProtocol() { }
 
@@ -262,6 +278,7 @@ void XmlProtocol::reset()
 
     elem     = QDomElement();
     elemDoc  = QDomDocument();
+    serializer.clear();
     tagOpen  = QString();
     tagClose = QString();
     xml.reset();
@@ -332,8 +349,7 @@ bool XmlProtocol::processStep()
                 return true;
             }
             case Parser::Event::Element: {
-                QDomElement e = elemDoc.importNode(pe.element(), true).toElement();
-                transferItemList += TransferItem(e, false);
+                transferItemList += TransferItem(pe, false);
 
                 // elementRecv(pe.element());
                 break;
@@ -368,10 +384,17 @@ bool XmlProtocol::processStep()
 
 QString XmlProtocol::xmlEncoding() const { return xml.encoding().toString(); }
 
-QString XmlProtocol::elementToString(const QDomElement &e, bool clip)
+void XmlProtocol::ensureRootElement()
 {
-    if (elem.isNull())
+    if (elem.isNull()) {
         elem = elemDoc.importNode(docElement(), true).toElement();
+        serializer.setRootElement(elem);
+    }
+}
+
+QString XmlProtocol::elementToString(const QDomElement &e, bool clip)
+{
+    ensureRootElement();
 
     // Determine the appropriate 'fakeNS' to use
     QString ns;
@@ -477,10 +500,33 @@ int XmlProtocol::writeElement(const QDomElement &e, int id, bool external, bool
     if (e.isNull())
         return 0;
     transferItemList += TransferItem(e, true, external);
+    Q_UNUSED(clip) // the serializer never adds trailing whitespace
 
     // elementSend(e);
-    QString out = sanitizeForStream(elementToString(e, clip));
-    return internalWriteString(out, TrackItem::Custom, id, urgent);
+    ensureRootElement();
+    int size = serializer.serialize(e, urgent ? outDataUrgent : outDataNormal);
+    addTrackItem(size, TrackItem::Custom, id, urgent);
+    return size;
+}
+
+// like writeElement() but returns the written bytes, e.g. to keep them for a resend
+QByteArray XmlProtocol::writeStanza(const QDomElement &e, int id, bool external)
+{
+    if (e.isNull())
+        return QByteArray();
+    transferItemList += TransferItem(e, true, external);
+
+    ensureRootElement();
+    QByteArray data = serializer.toUtf8(e);
+    internalWriteData(data, TrackItem::Custom, id);
+    return data;
+}
+
+// writes an element serialized earlier by writeStanza(). e.g. to resend it
+int XmlProtocol::writeSerialized(const QByteArray &data, int id)
+{
+    transferItemList += TransferItem(QString::fromUtf8(data), true);
+    return internalWriteData(data, TrackItem::Custom, id);
 }
 
 QByteArray XmlProtocol::resetStream()
@@ -497,20 +543,26 @@ QByteArray XmlProtocol::resetStream()
     return spare;
 }
 
-int XmlProtocol::internalWriteData(const QByteArray &a, TrackItem::Type t, int id, bool urgent)
+void XmlProtocol::addTrackItem(int size, TrackItem::Type t, int id, bool urgent)
 {
     TrackItem i;
     i.type = t;
     i.id   = id;
-    i.size = a.size();
+    i.size = size;
 
-    if (urgent) {
+    if (urgent)
         trackQueueUrgent += i;
-        outDataUrgent += a;
-    } else {
+    else
         trackQueueNormal += i;
+}
+
+int XmlProtocol::internalWriteData(const QByteArray &a, TrackItem::Type t, int id, bool urgent)
+{
+    addTrackItem(a.size(), t, id, urgent);
+    if (urgent)
+        outDataUrgent += a;
+    else
         outDataNormal += a;
-    }
     return a.size();
 }
 
@@ -551,8 +603,7 @@ int XmlProtocol::processTrackQueue(QList<TrackItem> &queue, int bytes)
 
 void XmlProtocol::sendTagOpen()
 {
-    if (elem.isNull())
-        elem = elemDoc.importNode(docElement(), true).toElement();
+    ensureRootElement();
 
     QString xmlHeader;
     createRootXmlTags(elem, &xmlHeader, &tagOpen, &tagClose);
@@ -599,10 +650,9 @@ bool XmlProtocol::baseStep(const Parser::Event &pe)
         event = ERecvOpen;
         return true;
     } else if (state == Open) {
-        QDomElement e;
         if (pe.type() == Parser::Event::Element)
-            e = pe.element();
-        return doStep(e);
+            return doStep(pe);
+        return doStep(Parser::Event());
     }
     // Closing
     else {
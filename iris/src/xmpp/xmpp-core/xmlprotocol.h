@@ -21,6 +21,7 @@
 #define XMLPROTOCOL_H
 
 #include "parser.h"
+#include "stanzaserializer.h"
 
 #include <QList>
 #include <QObject>
@@ -81,12 +82,17 @@ public:
         TransferItem();
         TransferItem(const QString &str, bool sent, bool external = false);
         TransferItem(const QDomElement &elem, bool sent, bool external = false);
+        TransferItem(const Parser::Event &event, bool sent, bool external = false);
 
-        bool        isSent;     // else, received
-        bool        isString;   // else, is element
-        bool        isExternal; // not owned by protocol
-        QString     str;
-        QDomElement elem;
+        // received elements are converted to DOM only when requested
+        QDomElement element() const;
+
+        bool          isSent;     // else, received
+        bool          isString;   // else, is element
+        bool          isExternal; // not owned by protocol
+        QString       str;
+        QDomElement   elem;
+        Parser::Event event;
     };
     QList<TransferItem> transferItemList;
     void                setIncomingAsExternal();
@@ -98,7 +104,7 @@ protected:
     virtual bool        handleCloseFinished()                  = 0;
     virtual bool        stepAdvancesParser() const             = 0;
     virtual bool        stepRequiresElement() const;
-    virtual bool        doStep(const QDomElement &e) = 0;
+    virtual bool        doStep(const Parser::Event &pe) = 0; // pe is null or Element event
     virtual void        itemWritten(int id, int size);
 
     // 'debug'
@@ -112,6 +118,8 @@ protected:
     bool       close();
     int        writeString(const QString &s, int id, bool external);
     int        writeElement(const QDomElement &e, int id, bool external, bool clip = false, bool urgent = false);
+    QByteArray writeStanza(const QDomElement &e, int id, bool external);
+    int        writeSerialized(const QByteArray &data, int id);
     QByteArray resetStream();
 
 private:
@@ -132,12 +140,15 @@ private:
     bool         closeWritten;
 
     Parser           xml;
+    StanzaSerializer serializer;
     QByteArray       outDataNormal;
     QByteArray       outDataUrgent;
     QList<TrackItem> trackQueueNormal;
     QList<TrackItem> trackQueueUrgent;
 
     void init();
+    void ensureRootElement();
+    void addTrackItem(int size, TrackItem::Type t, int id, bool urgent);
     int  internalWriteData(const QByteArray &a, TrackItem::Type t, int id = -1, bool urgent = false);
     int  internalWriteString(const QString &s, TrackItem::Type t, int id = -1, bool urgent = false);
     int  processTrackQueue(QList<TrackItem> &queue, int bytes);
@@ -33,8 +33,10 @@ class QString;
 
 namespace XMPP {
 class Connector;
+class StreamCapture;
 class StreamFeatures;
 class TLSHandler;
+class TrafficStats;
 
 class ClientStream : public Stream {
     Q_OBJECT
@@ -90,6 +92,18 @@ public:
     };
     enum AllowPlainType { NoAllowPlain, AllowPlain, AllowPlainOverTLS };
 
+    struct CompressionStats {
+        qint64 plainOut      = 0;
+        qint64 compressedOut = 0;
+        qint64 compressedIn  = 0;
+        qint64 plainIn       = 0;
+        qint64 deflateNsecs  = 0;
+        qint64 inflateNsecs  = 0;
+
+        double outRatio() const { return compressedOut ? double(plainOut) / double(compressedOut) : 0.0; }
+        double inRatio() const { return compressedIn ? double(plainIn) / double(compressedIn) : 0.0; }
+    };
+
     ClientStream(Connector *conn, TLSHandler *tlsHandler = nullptr, QObject *parent = nullptr);
     ClientStream(const QString &host, const QString &defRealm, ByteStream *bs, QCA::TLS *tls = nullptr,
                  QObject *parent = nullptr); // server
@@ -134,7 +148,10 @@ public:
     void setLocalAddr(const QHostAddress &addr, quint16 port);
 
     // Compression
-    void setCompress(bool);
+    void             setCompress(bool);
+    void             setCompressionLevel(int level); // zlib level 1-9 or -1 for the default
+    bool             isCompressed() const;
+    CompressionStats compressionStats() const;
 
     // reimplemented
     QDomDocument &doc() const;
@@ -154,11 +171,14 @@ public:
 
     // extra
     void writeDirect(const QString &s);
+    void setCapture(StreamCapture *capture);   // not owned. must outlive the stream or be reset
+    void setTrafficStats(TrafficStats *stats); // not owned. must outlive the stream or be reset
     void setNoopTime(int mills);
 
     // Stream management
     bool isResumed() const;
     void setSMEnabled(bool enable);
+    void setSMUnackedLimits(int stanzas, qint64 bytes); // ack is requested early when reached. 0 for defaults
 
     // barracuda extension
     QStringList hosts() const;
@@ -212,6 +232,7 @@ private:
 
     void reset(bool all = false);
     void processNext();
+    void flushOutgoing();
     int  convertedSASLCond() const;
     bool handleNeed();
     void handleError();
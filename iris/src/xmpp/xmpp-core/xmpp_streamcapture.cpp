@@ -0,0 +1,131 @@
+/*
+ * xmpp_streamcapture.cpp - fixed size ring of raw stream bytes for debugging
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "xmpp_streamcapture.h"
+
+#include <QDateTime>
+
+#include <cstring>
+
+namespace XMPP {
+
+StreamCapture::StreamCapture(int capacity, Layer layer) : capacity_(capacity), layer_(layer) { }
+
+void StreamCapture::setLayer(Layer layer)
+{
+    if (layer_ != layer) {
+        layer_ = layer;
+        clear(); // don't mix encrypted and plain data
+    }
+}
+
+void StreamCapture::setCapacity(int bytes)
+{
+    capacity_ = bytes > HeaderSize ? bytes : 0;
+    ring      = QByteArray();
+    head      = 0;
+    used      = 0;
+}
+
+void StreamCapture::clear()
+{
+    head = 0;
+    used = 0;
+}
+
+void StreamCapture::put(const char *data, int size)
+{
+    int pos   = (head + used) % capacity_;
+    int first = qMin(size, capacity_ - pos);
+    std::memcpy(ring.data() + pos, data, size_t(first));
+    if (first < size)
+        std::memcpy(ring.data(), data + first, size_t(size - first));
+    used += size;
+}
+
+void StreamCapture::get(int pos, char *data, int size) const
+{
+    pos       = pos % capacity_;
+    int first = qMin(size, capacity_ - pos);
+    std::memcpy(data, ring.constData() + pos, size_t(first));
+    if (first < size)
+        std::memcpy(data + first, ring.constData(), size_t(size - first));
+}
+
+void StreamCapture::dropOldest()
+{
+    char header[HeaderSize];
+    get(head, header, HeaderSize);
+    quint32 size;
+    std::memcpy(&size, header + 9, sizeof(size));
+    int recordSize = HeaderSize + int(size);
+    head           = (head + recordSize) % capacity_;
+    used -= recordSize;
+}
+
+void StreamCapture::append(Direction direction, const QByteArray &data)
+{
+    if (capacity_ == 0 || data.isEmpty())
+        return;
+    if (ring.isEmpty())
+        ring.resize(capacity_); // allocated on first use only
+
+    // a chunk bigger than the whole ring. keep its tail
+    const char *bytes = data.constData();
+    int         size  = int(data.size());
+    if (size > capacity_ - HeaderSize) {
+        bytes += size - (capacity_ - HeaderSize);
+        size = capacity_ - HeaderSize;
+    }
+    while (capacity_ - used < HeaderSize + size)
+        dropOldest();
+
+    char    header[HeaderSize];
+    qint64  ts  = QDateTime::currentMSecsSinceEpoch();
+    quint32 len = quint32(size);
+    header[0]   = char(direction);
+    std::memcpy(header + 1, &ts, sizeof(ts));
+    std::memcpy(header + 9, &len, sizeof(len));
+    put(header, HeaderSize);
+    put(bytes, size);
+}
+
+QList<StreamCapture::Record> StreamCapture::records() const
+{
+    QList<Record> ret;
+    int           pos  = head;
+    int           left = used;
+    while (left > 0) {
+        char header[HeaderSize];
+        get(pos, header, HeaderSize);
+        Record  r;
+        quint32 size;
+        r.direction = Direction(header[0]);
+        std::memcpy(&r.timestamp, header + 1, sizeof(r.timestamp));
+        std::memcpy(&size, header + 9, sizeof(size));
+        r.data.resize(int(size));
+        get(pos + HeaderSize, r.data.data(), int(size));
+        ret.append(r);
+        pos = (pos + HeaderSize + int(size)) % capacity_;
+        left -= HeaderSize + int(size);
+    }
+    return ret;
+}
+
+} // namespace XMPP
@@ -0,0 +1,79 @@
+/*
+ * xmpp_streamcapture.h - fixed size ring of raw stream bytes for debugging
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XMPP_STREAMCAPTURE_H
+#define XMPP_STREAMCAPTURE_H
+
+#include <QByteArray>
+#include <QList>
+
+namespace XMPP {
+
+/*
+ * Keeps the most recent stream bytes exactly as they were read or written.
+ *
+ * Capturing is a memcpy into a preallocated ring, nothing is parsed or converted until
+ * records() is called, so it may stay enabled all the time (e.g. for post-mortem dumps
+ * in XML console). Oldest records are dropped when the ring is full.
+ */
+class StreamCapture {
+public:
+    enum Layer {
+        Xml, // plain xml. after decompression/decryption for incoming and before it for outgoing
+        Wire // bytes as they go to/from the socket (may be compressed and/or encrypted)
+    };
+    enum Direction { Incoming, Outgoing };
+
+    struct Record {
+        Direction  direction;
+        qint64     timestamp; // msecs since epoch
+        QByteArray data;
+    };
+
+    static constexpr int DefaultCapacity = 1024 * 1024;
+
+    explicit StreamCapture(int capacity = DefaultCapacity, Layer layer = Xml);
+
+    Layer layer() const { return layer_; }
+    void  setLayer(Layer layer);
+    int   capacity() const { return capacity_; }
+    void  setCapacity(int bytes); // 0 disables capturing. drops captured data
+    bool  isCapturing(Layer layer) const { return capacity_ > 0 && layer_ == layer; }
+
+    void          append(Direction direction, const QByteArray &data);
+    QList<Record> records() const;
+    void          clear();
+
+private:
+    enum { HeaderSize = 1 + 8 + 4 }; // direction, timestamp, size
+
+    void put(const char *data, int size);
+    void get(int pos, char *data, int size) const;
+    void dropOldest();
+
+    QByteArray ring;
+    int        capacity_;
+    Layer      layer_;
+    int        head = 0; // the oldest record
+    int        used = 0;
+};
+
+} // namespace XMPP
+
+#endif // XMPP_STREAMCAPTURE_H
@@ -0,0 +1,156 @@
+/*
+ * xmpp_trafficstats.cpp - per namespace stanza traffic and iq latency counters
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "xmpp_trafficstats.h"
+
+#include <QDateTime>
+#include <QDomElement>
+#include <QJsonArray>
+
+#include <algorithm>
+#include <cmath>
+
+namespace XMPP {
+
+void TrafficStats::Histogram::add(qint64 usecs)
+{
+    int bucket = 0;
+    for (qint64 v = usecs; v > 0 && bucket < Buckets - 1; v >>= 1)
+        ++bucket;
+    ++counts[bucket];
+    ++count;
+    total += usecs;
+    if (usecs > max)
+        max = usecs;
+}
+
+qint64 TrafficStats::Histogram::percentile(double p) const
+{
+    if (!count)
+        return 0;
+    const quint64 rank = std::max(quint64(1), quint64(std::ceil(p * double(count))));
+    quint64       seen = 0;
+    for (int i = 0; i < Buckets - 1; ++i) {
+        seen += counts[i];
+        if (seen >= rank)
+            return std::min(qint64(1) << i, max);
+    }
+    return max;
+}
+
+QJsonObject TrafficStats::Histogram::toJson() const
+{
+    int last = Buckets;
+    while (last > 0 && !counts[last - 1])
+        --last;
+    QJsonArray buckets;
+    for (int i = 0; i < last; ++i)
+        buckets.append(qint64(counts[i]));
+
+    return { { QStringLiteral("count"), qint64(count) },
+             { QStringLiteral("totalUs"), total },
+             { QStringLiteral("maxUs"), max },
+             { QStringLiteral("p50Us"), percentile(0.5) },
+             { QStringLiteral("p90Us"), percentile(0.9) },
+             { QStringLiteral("p99Us"), percentile(0.99) },
+             { QStringLiteral("log2Buckets"), buckets } };
+}
+
+TrafficStats::Key TrafficStats::keyOf(const QDomElement &stanza)
+{
+    const QString stanzaNs = stanza.namespaceURI();
+    for (QDomElement e = stanza.firstChildElement(); !e.isNull(); e = e.nextSiblingElement()) {
+        QString ns = e.namespaceURI();
+        if (ns != stanzaNs)
+            return { stanza.tagName(), ns };
+    }
+    return { stanza.tagName(), QString() };
+}
+
+void TrafficStats::addStanza(Direction direction, const QDomElement &stanza, qint64 bytes, qint64 parseNsecs)
+{
+    if (!since_)
+        since_ = QDateTime::currentMSecsSinceEpoch();
+    auto &c = (direction == Incoming ? incoming_ : outgoing_)[keyOf(stanza)];
+    ++c.stanzas;
+    c.bytes += quint64(bytes);
+    if (direction == Incoming) {
+        c.parse += parseNsecs / 1000;
+        parseTimes_.add(parseNsecs / 1000);
+    }
+}
+
+void TrafficStats::addDispatch(const QDomElement &stanza, qint64 nsecs)
+{
+    const qint64 usecs = nsecs / 1000;
+    auto        &c     = incoming_[keyOf(stanza)];
+    c.dispatch += usecs;
+    if (usecs > c.maxDispatch)
+        c.maxDispatch = usecs;
+    dispatchTimes_.add(usecs);
+}
+
+void TrafficStats::addIqRoundTrip(const QString &ns, qint64 nsecs, bool error)
+{
+    auto &c = iq_[ns];
+    c.latency.add(nsecs / 1000);
+    if (error)
+        ++c.errors;
+}
+
+void TrafficStats::addIqTimeout(const QString &ns) { ++iq_[ns].timeouts; }
+
+void TrafficStats::reset() { *this = TrafficStats(); }
+
+QJsonObject TrafficStats::toJson() const
+{
+    auto counters = [](const QHash<Key, Counters> &hash, bool incoming) {
+        QJsonArray list;
+        for (auto it = hash.cbegin(); it != hash.cend(); ++it) {
+            QJsonObject o { { QStringLiteral("kind"), it.key().first },
+                            { QStringLiteral("ns"), it.key().second },
+                            { QStringLiteral("stanzas"), qint64(it->stanzas) },
+                            { QStringLiteral("bytes"), qint64(it->bytes) } };
+            if (incoming) {
+                o.insert(QStringLiteral("parseUs"), it->parse);
+                o.insert(QStringLiteral("dispatchUs"), it->dispatch);
+                o.insert(QStringLiteral("maxDispatchUs"), it->maxDispatch);
+            }
+            list.append(o);
+        }
+        return list;
+    };
+
+    QJsonArray iq;
+    for (auto it = iq_.cbegin(); it != iq_.cend(); ++it) {
+        iq.append(QJsonObject { { QStringLiteral("ns"), it.key() },
+                                { QStringLiteral("errors"), qint64(it->errors) },
+                                { QStringLiteral("timeouts"), qint64(it->timeouts) },
+                                { QStringLiteral("latency"), it->latency.toJson() } });
+    }
+
+    return { { QStringLiteral("since"), QDateTime::fromMSecsSinceEpoch(since_).toUTC().toString(Qt::ISODate) },
+             { QStringLiteral("incoming"), counters(incoming_, true) },
+             { QStringLiteral("outgoing"), counters(outgoing_, false) },
+             { QStringLiteral("parseTimes"), parseTimes_.toJson() },
+             { QStringLiteral("dispatchTimes"), dispatchTimes_.toJson() },
+             { QStringLiteral("iq"), iq } };
+}
+
+} // namespace XMPP
@@ -0,0 +1,108 @@
+/*
+ * xmpp_trafficstats.h - per namespace stanza traffic and iq latency counters
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XMPP_TRAFFICSTATS_H
+#define XMPP_TRAFFICSTATS_H
+
+#include <QHash>
+#include <QJsonObject>
+#include <QPair>
+#include <QString>
+
+#include <array>
+
+class QDomElement;
+
+namespace XMPP {
+
+/*
+ * Where the stanza traffic of a stream comes from and where the time goes.
+ *
+ * Stanzas are counted per (kind, namespace), where kind is "message", "presence" or "iq"
+ * and namespace is the one of the first child element which isn't in the stream namespace,
+ * i.e. of the payload (empty if there is no payload). Counting is a hash lookup per stanza,
+ * so it stays enabled all the time. The stream reports sizes and parse times, the client
+ * reports dispatch times and iq round trips. See Client::trafficStats()
+ */
+class TrafficStats {
+public:
+    enum Direction { Incoming, Outgoing };
+
+    // Log2 histogram of durations. Bucket i counts values below 2^i microseconds,
+    // the last one everything above.
+    struct Histogram {
+        static constexpr int Buckets = 24;
+
+        std::array<quint64, Buckets> counts {};
+        quint64                      count = 0;
+        qint64                       total = 0; // usecs
+        qint64                       max   = 0; // usecs
+
+        void   add(qint64 usecs);
+        qint64 percentile(double p) const; // upper bound of the bucket with the p-th (0..1) value, in usecs
+        qint64 average() const { return count ? total / qint64(count) : 0; }
+
+        QJsonObject toJson() const;
+    };
+
+    struct Counters {
+        quint64 stanzas     = 0;
+        quint64 bytes       = 0; // utf-8 xml in both directions. tls and compression framing not included
+        qint64  parse       = 0; // usecs. incoming only
+        qint64  dispatch    = 0; // usecs. incoming only
+        qint64  maxDispatch = 0; // usecs
+    };
+
+    struct IqCounters {
+        Histogram latency; // from Task::go() to the result or error reply
+        quint64   errors   = 0;
+        quint64   timeouts = 0; // no reply at all. not in the histogram
+    };
+
+    using Key = QPair<QString, QString>; // kind, namespace
+
+    static Key keyOf(const QDomElement &stanza);
+
+    void addStanza(Direction direction, const QDomElement &stanza, qint64 bytes, qint64 parseNsecs = 0);
+    void addDispatch(const QDomElement &stanza, qint64 nsecs);
+    void addIqRoundTrip(const QString &ns, qint64 nsecs, bool error);
+    void addIqTimeout(const QString &ns);
+
+    const QHash<Key, Counters>       &incoming() const { return incoming_; }
+    const QHash<Key, Counters>       &outgoing() const { return outgoing_; }
+    const QHash<QString, IqCounters> &iq() const { return iq_; }
+    const Histogram                  &parseTimes() const { return parseTimes_; }
+    const Histogram                  &dispatchTimes() const { return dispatchTimes_; }
+    qint64                            since() const { return since_; } // msecs since epoch
+
+    void        reset();
+    QJsonObject toJson() const;
+
+private:
+    QHash<Key, Counters>       incoming_;
+    QHash<Key, Counters>       outgoing_;
+    QHash<QString, IqCounters> iq_;
+    Histogram                  parseTimes_;    // per incoming stanza
+    Histogram                  dispatchTimes_; // per incoming stanza
+    qint64                     since_ = 0;
+};
+
+} // namespace XMPP
+
+#endif // XMPP_TRAFFICSTATS_H
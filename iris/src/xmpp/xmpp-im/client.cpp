@@ -87,10 +87,14 @@
 #include "xmpp_pubsub.h"
 #include "xmpp_serverinfomanager.h"
 #include "xmpp_tasks.h"
+#include "xmpp_trafficstats.h"
 #include "xmpp_xmlcommon.h"
 
+#include <QElapsedTimer>
+#include <QHash>
 #include <QList>
 #include <QMap>
+#include <QMetaMethod>
 #include <QObject>
 #include <QPointer>
 #include <QTimer>
@@ -133,6 +137,8 @@ public:
     bool                    useTzoffset      = false; // manual tzoffset is old way of doing utc<->local translations
     bool                    active           = false;
     bool                    capsOptimization = false; // don't send caps every time
+    bool                    rosterCached     = false; // the server confirmed the roster version we had
+    QElapsedTimer           rosterTimer;
 
     LiveRoster                roster;
     ResourceList              resourceList;
@@ -156,6 +162,14 @@ public:
     EncryptionManager        *encryptionManager         = nullptr;
     const EncryptionMetadata *currentEncryptionMetadata = nullptr;
     JT_PushMessage           *pushMessage               = nullptr;
+
+    // dispatch index. tasks not found here are still reached by the linear scan from root
+    using PushKey = QPair<QString, QString>; // stanza kind (tag name), namespace of the first child element
+    QList<QPointer<Task>>                 watchers;  // see every stanza before the index
+    QHash<QString, QPointer<Task>>        pendingIq; // id of sent iq get/set -> task waiting for the result
+    QHash<PushKey, QList<QPointer<Task>>> pushHandlers;
+    DispatchStats                         dispatchStats;
+    TrafficStats                          trafficStats;
 };
 
 Client::Client(QObject *par) : QObject(par)
@@ -226,9 +240,9 @@ void Client::connectToServer(ClientStream *s, const Jid &j, bool auth)
     // connect(d->stream, SIGNAL(sslCertificateReady(QSSLCert)), SLOT(streamSSLCertificateReady(QSSLCert)));
     connect(d->stream, SIGNAL(readyRead()), SLOT(streamReadyRead()));
     // connect(d->stream, SIGNAL(closeFinished()), SLOT(streamCloseFinished()));
-    connect(d->stream, SIGNAL(incomingXml(QString)), SLOT(streamIncomingXml(QString)));
-    connect(d->stream, SIGNAL(outgoingXml(QString)), SLOT(streamOutgoingXml(QString)));
+    updateXmlRelay();
     connect(d->stream, SIGNAL(haveUnhandledFeatures()), SLOT(parseUnhandledStreamFeatures()));
+    s->setTrafficStats(&d->trafficStats);
 
     d->stream->connectToServer(j, auth);
 }
@@ -483,6 +497,7 @@ void Client::close(bool)
 
     if (d->stream) {
         d->stream->disconnect(this);
+        static_cast<ClientStream *>(d->stream)->setTrafficStats(nullptr);
         d->stream->close();
         d->stream = nullptr;
     }
@@ -541,15 +556,57 @@ void Client::streamReadyRead()
     while (d->stream && d->stream->stanzaAvailable()) {
         Stanza s = d->stream->read();
 
-        QString out = s.toString();
-        debug(QString("Client: incoming: [\n%1]\n").arg(out));
-        emit xmlIncoming(out);
+        if (isXmlLogged()) {
+            QString out = s.toString();
+            debug(QString("Client: incoming: [\n%1]\n").arg(out));
+            emit xmlIncoming(out);
+        }
 
-        QDomElement x = s.element();
+        QDomElement   x = s.element();
+        QElapsedTimer dispatchTime;
+        dispatchTime.start();
         distribute(x);
+        d->trafficStats.addDispatch(x, dispatchTime.nsecsElapsed());
     }
 }
 
+// Serializing every stanza for display is expensive, so it's done only when somebody
+// (e.g. XML console) listens to xmlIncoming/xmlOutgoing.
+bool Client::isXmlLogged() const
+{
+    static const QMetaMethod incomingSignal = QMetaMethod::fromSignal(&Client::xmlIncoming);
+    static const QMetaMethod outgoingSignal = QMetaMethod::fromSignal(&Client::xmlOutgoing);
+    return isSignalConnected(incomingSignal) || isSignalConnected(outgoingSignal);
+}
+
+void Client::updateXmlRelay()
+{
+    if (!d->stream)
+        return;
+    if (isXmlLogged()) {
+        connect(d->stream, SIGNAL(incomingXml(QString)), this, SLOT(streamIncomingXml(QString)), Qt::UniqueConnection);
+        connect(d->stream, SIGNAL(outgoingXml(QString)), this, SLOT(streamOutgoingXml(QString)), Qt::UniqueConnection);
+    } else {
+        disconnect(d->stream, SIGNAL(incomingXml(QString)), this, SLOT(streamIncomingXml(QString)));
+        disconnect(d->stream, SIGNAL(outgoingXml(QString)), this, SLOT(streamOutgoingXml(QString)));
+    }
+}
+
+void Client::connectNotify(const QMetaMethod &signal)
+{
+    if (signal == QMetaMethod::fromSignal(&Client::xmlIncoming)
+        || signal == QMetaMethod::fromSignal(&Client::xmlOutgoing))
+        updateXmlRelay();
+}
+
+void Client::disconnectNotify(const QMetaMethod &signal)
+{
+    // signal is invalid when disconnected with a wildcard
+    if (!signal.isValid() || signal == QMetaMethod::fromSignal(&Client::xmlIncoming)
+        || signal == QMetaMethod::fromSignal(&Client::xmlOutgoing))
+        updateXmlRelay();
+}
+
 void Client::streamIncomingXml(const QString &s)
 {
     QString str = s;
@@ -595,6 +652,107 @@ Task *Client::rootTask() { return d->root; }
 
 QDomDocument *Client::doc() const { return &d->doc; }
 
+const Client::DispatchStats &Client::dispatchStats() const { return d->dispatchStats; }
+
+void Client::resetDispatchStats() { d->dispatchStats = DispatchStats(); }
+
+const TrafficStats &Client::trafficStats() const { return d->trafficStats; }
+
+void Client::resetTrafficStats() { d->trafficStats.reset(); }
+
+void Client::addIqRoundTrip(const QString &ns, qint64 nsecs, bool error)
+{
+    d->trafficStats.addIqRoundTrip(ns, nsecs, error);
+}
+
+void Client::addIqTimeout(const QString &ns) { d->trafficStats.addIqTimeout(ns); }
+
+void Client::registerWatcher(Task *task) { d->watchers.append(task); }
+
+void Client::unregisterWatcher(Task *task) { d->watchers.removeAll(task); }
+
+void Client::registerIqTask(Task *task, const QString &id) { d->pendingIq.insert(id, task); }
+
+void Client::unregisterIqTask(Task *task, const QString &id)
+{
+    auto it = d->pendingIq.find(id);
+    if (it != d->pendingIq.end() && (it->isNull() || it->data() == task))
+        d->pendingIq.erase(it);
+}
+
+void Client::registerPushHandler(Task *task, const QString &kind, const QString &ns)
+{
+    d->pushHandlers[{ kind, ns }].append(task);
+}
+
+void Client::unregisterPushHandler(Task *task, const QString &kind, const QString &ns)
+{
+    auto it = d->pushHandlers.find({ kind, ns });
+    if (it == d->pushHandlers.end())
+        return;
+    it->removeAll(task);
+    if (it->isEmpty())
+        d->pushHandlers.erase(it);
+}
+
+/*
+ * Delivers the stanza to the task which is waiting for it without asking every task in the tree.
+ *
+ * Watchers (e.g. plugin filters) come first. They may take any stanza, as they did when they were
+ * scanned from the root before everybody else.
+ * iq result/error goes to the task which sent the request with the same id. The task still verifies
+ * the sender with iqVerify(), since 'from' of a server reply may be empty or a bare jid.
+ * Other stanzas are looked up by the tag name and the namespace of the first child element, in the order
+ * the handlers were registered. See Task::takePush().
+ * If no indexed task takes the stanza, it goes through the old linear scan of the task tree.
+ */
+bool Client::dispatch(const QDomElement &x)
+{
+    ++d->dispatchStats.stanzas;
+
+    if (!d->watchers.isEmpty()) {
+        const auto watchers = d->watchers; // a copy. a watcher may go away while taking the stanza
+        for (const auto &task : watchers) {
+            if (task && task->take(x)) {
+                ++d->dispatchStats.watched;
+                return true;
+            }
+        }
+    }
+
+    const QString kind = x.tagName();
+    if (kind == QLatin1String("iq")) {
+        const QString type = x.attribute(QStringLiteral("type"));
+        if (type == QLatin1String("result") || type == QLatin1String("error")) {
+            QPointer<Task> task = d->pendingIq.value(x.attribute(QStringLiteral("id")));
+            if (task && task->take(x)) {
+                ++d->dispatchStats.iqResults;
+                return true;
+            }
+        }
+    }
+
+    if (!d->pushHandlers.isEmpty()) {
+        QDomElement child = x.firstChildElement();
+        if (!child.isNull()) {
+            // a copy. handlers may register/unregister while taking the stanza
+            const auto handlers = d->pushHandlers.value({ kind, child.namespaceURI() });
+            for (const auto &task : handlers) {
+                if (task && task->takePush(x)) {
+                    ++d->dispatchStats.pushes;
+                    return true;
+                }
+            }
+        }
+    }
+
+    ++d->dispatchStats.slowPath;
+    if (d->root->take(x))
+        return true;
+    ++d->dispatchStats.unhandled;
+    return false;
+}
+
 void Client::distribute(const QDomElement &x)
 {
     static QString fromAttr(QStringLiteral("from"));
@@ -718,7 +876,7 @@ void Client::distributeDecrypted(const QDomElement &x, const EncryptionMetadata
 
     const auto previousMetadata  = d->currentEncryptionMetadata;
     d->currentEncryptionMetadata = metadata;
-    const bool handled           = rootTask()->take(x);
+    const bool handled           = dispatch(x);
     d->currentEncryptionMetadata = previousMetadata;
 
     if (!handled && (x.attribute("type") == "get" || x.attribute("type") == "set")) {
@@ -754,7 +912,7 @@ void Client::send(const QDomElement &x)
     // debug(QString("Client: outgoing: [\n%1]\n").arg(out));
     // xmlOutgoing(out);
 
-    QDomElement e = addCorrectNS(x);
+    QDomElement e = hasCorrectNS(x) ? x : addCorrectNS(x);
     Stanza      s = d->stream->createStanza(e);
     if (s.isNull()) { // e's namespace is not "jabber:client" or e.tagName is not in (message,presence,iq)
         // printf("bad stanza??\n");
@@ -764,10 +922,12 @@ void Client::send(const QDomElement &x)
     if (e.isNull()) {              // so it was changed by signal above
         return;
     }
-    QString out = s.toString();
-    // qWarning() << "Out: " << out;
-    debug(QString("Client: outgoing: [\n%1]\n").arg(out));
-    emit xmlOutgoing(out);
+    if (isXmlLogged()) {
+        QString out = s.toString();
+        // qWarning() << "Out: " << out;
+        debug(QString("Client: outgoing: [\n%1]\n").arg(out));
+        emit xmlOutgoing(out);
+    }
 
     // printf("x[%s] x2[%s] s[%s]\n", Stream::xmlToString(x).toLatin1(), Stream::xmlToString(e).toLatin1(),
     // s.toString().toLatin1());
@@ -848,6 +1008,11 @@ bool Client::isSessionRequired() const
     return d->stream && !d->stream->old() && d->stream->streamFeatures().session_required;
 }
 
+bool Client::isRosterVersioningSupported() const
+{
+    return d->stream && !d->stream->old() && d->stream->streamFeatures().rosterver_supported;
+}
+
 QString Client::host() const { return d->host; }
 
 QString Client::user() const { return d->user; }
@@ -1049,16 +1214,47 @@ void Client::pmMessage(const Message &m)
         emit messageReceived(m);
 }
 
-void Client::prRoster(const Roster &r) { importRoster(r); }
+void Client::prRoster(const Roster &r)
+{
+    if (!r.version().isNull())
+        d->roster.setVersion(r.version());
+    importRoster(r);
+}
+
+/**
+ * Restores the roster saved by the application in the previous session (e.g. to show it before
+ * the connection is established), so the next rosterRequest() can ask only for the changes (XEP-0237).
+ * No signals are emitted for the restored items.
+ */
+void Client::setCachedRoster(const Roster &r)
+{
+    d->roster.clear();
+    for (const auto &item : r)
+        d->roster += LiveRosterItem(item);
+    d->roster.setVersion(r.version());
+}
+
+/**
+ * Returns true if the last roster request found the roster version we had current, so nothing
+ * was imported.
+ */
+bool Client::isRosterCached() const { return d->rosterCached; }
 
 void Client::rosterRequest(bool withGroupsDelimiter)
 {
     if (!d->active)
         return;
 
+    // with versioning supported an empty version asks for a versioned roster if nothing is cached yet
+    QString version;
+    if (isRosterVersioningSupported())
+        version = d->roster.version().isNull() ? QStringLiteral("") : d->roster.version();
+    d->rosterCached = false;
+    d->rosterTimer.start();
+
     JT_Roster *r = new JT_Roster(rootTask());
     if (withGroupsDelimiter) {
-        connect(r, &JT_Roster::finished, this, [this, r]() mutable {
+        connect(r, &JT_Roster::finished, this, [this, r, version]() mutable {
             if (r->success()) {
                 d->roster.setGroupsDelimiter(r->groupsDelimiter());
                 emit rosterGroupsDelimiterRequestFinished(r->groupsDelimiter());
@@ -1066,7 +1262,7 @@ void Client::rosterRequest(bool withGroupsDelimiter)
 
             r = new JT_Roster(rootTask());
             connect(r, SIGNAL(finished()), SLOT(slotRosterRequestFinished()));
-            r->get();
+            r->get(version);
             d->roster.flagAllForDelete(); // mod_groups patch
             r->go(true);
         });
@@ -1076,7 +1272,7 @@ void Client::rosterRequest(bool withGroupsDelimiter)
         r->setTimeout(GROUPS_DELIMITER_TIMEOUT);
     } else {
         connect(r, SIGNAL(finished()), SLOT(slotRosterRequestFinished()));
-        r->get();
+        r->get(version);
         d->roster.flagAllForDelete(); // mod_groups patch
     }
 
@@ -1090,16 +1286,29 @@ void Client::slotRosterRequestFinished()
     if (r->success()) {
         // d->roster.flagAllForDelete(); // mod_groups patch
 
-        importRoster(r->roster());
-
-        for (LiveRoster::Iterator it = d->roster.begin(); it != d->roster.end();) {
-            LiveRosterItem &i = *it;
-            if (i.flagForDelete()) {
-                emit rosterItemRemoved(i);
-                it = d->roster.erase(it);
-            } else
-                ++it;
+        if (r->isUpToDate()) {
+            // nothing changed since the cached version. pushes follow otherwise
+            d->rosterCached = true;
+            for (LiveRosterItem &i : d->roster)
+                i.setFlagForDelete(false);
+        } else {
+            d->roster.setVersion(r->roster().version());
+            importRoster(r->roster());
+
+            for (LiveRoster::Iterator it = d->roster.begin(); it != d->roster.end();) {
+                LiveRosterItem &i = *it;
+                if (i.flagForDelete()) {
+                    emit rosterItemRemoved(i);
+                    it = d->roster.erase(it);
+                } else
+                    ++it;
+            }
         }
+        debug(QString("Client: roster %1 in %2 ms. %3 items received, version \"%4\"\n")
+                  .arg(d->rosterCached ? "confirmed" : "loaded")
+                  .arg(d->rosterTimer.elapsed())
+                  .arg(r->roster().count())
+                  .arg(d->roster.version()));
     } else {
         // don't report a disconnect.  Client::error() will do that.
         if (r->statusCode() == Task::ErrDisc)
@@ -1495,12 +1704,14 @@ void LiveRosterItem::setFlagForDelete(bool b) { v_flagForDelete = b; }
 class LiveRoster::Private {
 public:
     QString groupsDelimiter;
+    QString version;
 };
 
 LiveRoster::LiveRoster() : QList<LiveRosterItem>(), d(new LiveRoster::Private) { }
 LiveRoster::LiveRoster(const LiveRoster &other) : QList<LiveRosterItem>(other), d(new LiveRoster::Private)
 {
     d->groupsDelimiter = other.d->groupsDelimiter;
+    d->version         = other.d->version;
 }
 
 LiveRoster::~LiveRoster() { delete d; }
@@ -1509,6 +1720,7 @@ LiveRoster &LiveRoster::operator=(const LiveRoster &other)
 {
     QList<LiveRosterItem>::operator=(other);
     d->groupsDelimiter = other.d->groupsDelimiter;
+    d->version         = other.d->version;
     return *this;
 }
 void LiveRoster::flagAllForDelete()
@@ -1541,4 +1753,8 @@ void LiveRoster::setGroupsDelimiter(const QString &groupsDelimiter) { d->groupsD
 
 QString LiveRoster::groupsDelimiter() const { return d->groupsDelimiter; }
 
+void LiveRoster::setVersion(const QString &version) { d->version = version; }
+
+QString LiveRoster::version() const { return d->version; }
+
 }
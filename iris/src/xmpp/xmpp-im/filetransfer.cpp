@@ -649,7 +649,10 @@ bool JT_FT::take(const QDomElement &x)
 //----------------------------------------------------------------------------
 // JT_PushFT
 //----------------------------------------------------------------------------
-JT_PushFT::JT_PushFT(Task *parent) : Task(parent) { }
+JT_PushFT::JT_PushFT(Task *parent) : Task(parent)
+{
+    registerPush(QStringLiteral("iq"), QStringLiteral("http://jabber.org/protocol/si"));
+}
 
 JT_PushFT::~JT_PushFT() { }
 
@@ -57,4 +57,6 @@ namespace XMPP { namespace Jingle {
     }
 
     int Connection::component() const { return 0; }
+
+    qint64 Connection::sendFile(QFile *, qint64, qint64) { return -1; }
 }}
@@ -30,6 +30,8 @@
 
 #include <QNetworkDatagram>
 
+class QFile;
+
 namespace XMPP { namespace Jingle {
 
     class Connection : public ByteStream {
@@ -45,6 +47,10 @@ namespace XMPP { namespace Jingle {
         virtual int               component() const;
         virtual TransportFeatures features() const = 0;
 
+        // Sends size bytes of the file from offset bypassing userspace if the transport can do that.
+        // Returns sent bytes, 0 if it can't take anything now or -1 if not supported (write() then).
+        virtual qint64 sendFile(QFile *file, qint64 offset, qint64 size);
+
         inline void setId(const QString &id) { _id = id; }
         inline bool isRemote() const { return _isRemote; }
         inline void setRemote(bool value) { _isRemote = value; }
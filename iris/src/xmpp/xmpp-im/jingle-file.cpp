@@ -19,12 +19,11 @@
 
 #include "jingle-file.h"
 
+#include "jingle-ft.h"
+#include "xmpp_hashpool.h"
 #include "xmpp_xmlcommon.h"
 
 #include <QDomDocument>
-#include <QSemaphore>
-#include <QThread>
-#include <QTimer>
 
 namespace XMPP::Jingle::FileTransfer {
 
@@ -43,6 +42,7 @@ static const QString AMPLITUDES_TAG = QStringLiteral("amplitudes");
 static const QString WIDTH_TAG      = QStringLiteral("width");
 static const QString HEIGHT_TAG     = QStringLiteral("height");
 static const QString LENGTH_TAG     = QStringLiteral("length");
+static const QString SPLIT_TAG      = QStringLiteral("split");
 
 const QString AMPLITUDES_NS = QStringLiteral("urn:audio:amplitudes");
 
@@ -84,6 +84,7 @@ public:
     Thumbnail                    thumbnail;
     QList<Thumbnail>             extraThumbnails;
     QByteArray                   amplitudes;
+    QString                      splitId;
 };
 
 File::File() { }
@@ -116,6 +117,7 @@ File::File(const QDomElement &file)
     Thumbnail                    thumbnail;
     QList<Thumbnail>             extraThumbnails;
     QByteArray                   amplitudes;
+    QString                      splitId;
 
     bool ok;
 
@@ -222,6 +224,8 @@ File::File(const QDomElement &file)
             }
         } else if (ce.localName() == AMPLITUDES_TAG && ce.namespaceURI() == AMPLITUDES_NS) {
             amplitudes = QByteArray::fromBase64(ce.text().toLatin1());
+        } else if (ce.localName() == SPLIT_TAG && ce.namespaceURI() == PARALLEL_NS) {
+            splitId = ce.attribute(QStringLiteral("id"));
         }
     }
 
@@ -241,6 +245,7 @@ File::File(const QDomElement &file)
     p->thumbnail             = thumbnail;
     p->extraThumbnails       = extraThumbnails;
     p->amplitudes            = amplitudes;
+    p->splitId               = splitId;
 
     d = p;
 }
@@ -305,6 +310,11 @@ QDomElement File::toXml(QDomDocument *doc, const QString &ns, bool jingleExtensi
             el.appendChild(d->range.toXml(doc));
         if (!d->amplitudes.isEmpty())
             el.appendChild(XMLHelper::textTagNS(doc, AMPLITUDES_NS, AMPLITUDES_TAG, d->amplitudes));
+        if (!d->splitId.isEmpty()) {
+            auto split = doc->createElementNS(PARALLEL_NS, SPLIT_TAG);
+            split.setAttribute(QStringLiteral("id"), d->splitId);
+            el.appendChild(split);
+        }
     }
     return el;
 }
@@ -391,6 +401,8 @@ std::optional<std::uint64_t> File::size() const { return d ? d->size : std::opti
 
 Range File::range() const { return d ? d->range : Range(); }
 
+bool File::isRangeSupported() const { return d && (d->rangeSupported || d->range.isValid()); }
+
 Thumbnail        File::thumbnail() const { return d ? d->thumbnail : Thumbnail(); }
 QList<Thumbnail> File::thumbnails() const
 {
@@ -406,6 +418,7 @@ QByteArray                   File::amplitudes() const { return d ? d->amplitudes
 std::optional<std::uint32_t> File::width() const { return d ? d->width : std::optional<std::uint32_t> {}; }
 std::optional<std::uint32_t> File::height() const { return d ? d->height : std::optional<std::uint32_t> {}; }
 std::optional<std::uint64_t> File::length() const { return d ? d->length : std::optional<std::uint64_t> {}; }
+QString                      File::splitId() const { return d ? d->splitId : QString(); }
 
 void File::setDate(const QDateTime &date) { ensureD()->date = date; }
 
@@ -470,6 +483,7 @@ void File::setAmplitudes(const QByteArray &amplitudes) { ensureD()->amplitudes =
 void File::setWidth(std::uint32_t width) { ensureD()->width = width; }
 void File::setHeight(std::uint32_t height) { ensureD()->height = height; }
 void File::setLength(std::uint64_t length) { ensureD()->length = length; }
+void File::setSplitId(const QString &id) { ensureD()->splitId = id; }
 
 File::Private *File::ensureD()
 {
@@ -484,51 +498,20 @@ File::Private *File::ensureD()
 //----------------------------------------------------------------------------
 class FileHasher::Private {
 public:
-    QThread    thread;
-    StreamHash streamHash;
-    Hash       result;
-
-    Private(Hash::Type hashType) : streamHash(hashType) { }
+    HashJob *job;
 };
 
-FileHasher::FileHasher(Hash::Type type) : d(new Private(type))
-{
-    QSemaphore sem;
-    moveToThread(&d->thread);
-    QObject::connect(&d->thread, &QThread::started, this, [&sem]() { sem.release(); });
-    d->thread.start();
-    sem.acquire();
-}
+FileHasher::FileHasher(Hash::Type type) : d(new Private) { d->job = HashPool::instance()->stream({ type }, this); }
 
-FileHasher::~FileHasher()
-{
-    if (d->thread.isRunning()) {
-        addData(); // ensure exit called
-        d->thread.wait();
-    }
-}
+FileHasher::~FileHasher() = default; // the job is canceled with its deletion
 
-void FileHasher::addData(const QByteArray &data)
-{
-    QTimer::singleShot(0, this, [data, this]() {
-        // executed in a thread
-        d->streamHash.addData(data);
-        if (data.isEmpty()) {
-            d->result = d->streamHash.final();
-            thread()->exit();
-        }
-    });
-    if (data.isEmpty())
-        d->thread.wait();
-}
+void FileHasher::addData(const QByteArray &data) { d->job->addData(data); }
 
-Hash FileHasher::result()
+void FileHasher::addFile(const QString &fileName, qint64 offset, qint64 size)
 {
-    if (d->thread.isRunning()) {
-        addData(); // ensure exit called
-        d->thread.wait();
-    }
-    return d->result;
+    d->job->addFile(fileName, offset, size);
 }
 
+Hash FileHasher::result() { return d->job->waitForFinished().value(0); }
+
 }
@@ -55,6 +55,7 @@ public:
     QDomElement toMetadataXml(QDomDocument *doc) const;
     bool        merge(const File &other);
     bool        hasComputedHashes() const;
+    bool        isRangeSupported() const; // the peer can send a part of it
 
     QDateTime                    date() const;
     QString                      description() const;
@@ -73,6 +74,7 @@ public:
     std::optional<std::uint32_t> width() const;
     std::optional<std::uint32_t> height() const;
     std::optional<std::uint64_t> length() const;
+    QString                      splitId() const; // the same in all the ranges of a file sent in parallel
 
     void setDate(const QDateTime &date);
     void setDescription(const QString &desc);
@@ -91,6 +93,7 @@ public:
     void setWidth(std::uint32_t width);
     void setHeight(std::uint32_t height);
     void setLength(std::uint64_t length);
+    void setSplitId(const QString &id);
 
 private:
     QDomElement toXml(QDomDocument *doc, const QString &ns, bool jingleExtensions) const;
@@ -107,9 +110,17 @@ public:
 
     /**
      * @brief addData add next portion of data for hash computation.
-     * @param data to be added to hash function. if empty it will signal hashing thread to exit
+     * @param data to be added to hash function. if empty it marks the end of the data
      */
     void addData(const QByteArray &data = QByteArray());
+
+    /**
+     * @brief addFile adds size bytes of the file from offset, read in the hashing pool.
+     *
+     * To continue hashing of a file received in several attempts, or of what was sent without reading it.
+     * The result is invalid if it can't be read.
+     */
+    void addFile(const QString &fileName, qint64 offset, qint64 size);
     Hash result();
 
 private:
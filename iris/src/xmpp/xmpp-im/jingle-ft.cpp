@@ -29,6 +29,8 @@
 #include <QRandomGenerator>
 #endif
 #include <QDeadlineTimer>
+#include <QElapsedTimer>
+#include <QFile>
 #include <QFileInfo>
 #include <QMetaObject>
 #include <QMimeDatabase>
@@ -37,6 +39,7 @@
 #include <QThread>
 #include <QTimer>
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
 
@@ -45,8 +48,17 @@ using namespace std::chrono_literals;
 namespace XMPP { namespace Jingle { namespace FileTransfer {
 
     const QString  NS               = QStringLiteral("urn:xmpp:jingle:apps:file-transfer:5");
+    const QString  PARALLEL_NS      = QStringLiteral("http://psi-im.org/jingle/ft-parallel-ranges");
+    const QString  RESUME_NS        = QStringLiteral("http://psi-im.org/jingle/ft-resume-checksum");
     constexpr auto FINALIZE_TIMEOUT = 30s;
 
+    // block sizes of fast stream transports w/o a block size of their own. The block grows while the transport
+    // drains faster than we fill it, but not beyond what it sends in BLOCK_DRAIN_TIME at the measured rate.
+    constexpr quint64 MIN_BLOCK_SIZE   = 8192;
+    constexpr quint64 MAX_BLOCK_SIZE   = 1024 * 1024;
+    constexpr auto    BLOCK_DRAIN_TIME = 50ms;
+    constexpr auto    RATE_WINDOW      = 250ms;
+
     // tags
     static const QString CHECKSUM_TAG = QStringLiteral("checksum");
     static const QString RECEIVED_TAG = QStringLiteral("received");
@@ -118,7 +130,7 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
 
     void Manager::closeAll(const QString &) { }
 
-    QStringList Manager::discoFeatures() const { return { NS }; }
+    QStringList Manager::discoFeatures() const { return { NS, PARALLEL_NS, RESUME_NS }; }
 
     Client *Manager::client()
     {
@@ -166,6 +178,11 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
         QList<Hash>                        incomingChecksum;
         QTimer                            *finalizeTimer = nullptr;
         FileHasher                        *hasher        = nullptr;
+        quint64                            blockSize     = 0; // adaptive one. 0 if fixed
+        quint64                            blockLimit    = MAX_BLOCK_SIZE;
+        quint64                            rateBytes     = 0;
+        QElapsedTimer                      rateTimer;
+        bool                               zeroCopy = false; // file goes to the socket w/o reading it
 
         void setState(State s)
         {
@@ -235,12 +252,35 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
         {
             device              = dev;
             closeDeviceOnFinish = closeOnFinish;
-            if (file.hash().isValid() && file.hash().data().isEmpty() && file.range().hashes.isEmpty()) {
-                // no precomputated hashes
-                hasher = new FileHasher(file.hash().type());
+            auto hash           = file.hash();
+            if (hash.isValid() && file.range().hashes.isEmpty() && (hash.data().isEmpty() || amIReceiver())) {
+                // no precomputated hashes or we have to check the precomputed one
+                hasher = new FileHasher(hash.type());
+                if (!hash.data().isEmpty())
+                    incomingChecksum = file.hashes(); // no <checksum> will come
+                // A precomputed hash is of the whole file, and peers with RESUME_NS stream the checksum of
+                // the whole file too. Then the part which came before a resume is hashed from the disk.
+                // Others checksum just the range they send. Ranges offered as such are checked on their own.
+                auto offset = acceptFile.range().offset;
+                auto source = qobject_cast<QFile *>(dev);
+                bool whole  = !hash.data().isEmpty() || q->pad()->session()->peerFeatures().test(RESUME_NS);
+                if (offset && !file.range().isValid() && whole) {
+                    if (source) {
+                        hasher->addFile(source->fileName(), 0, qint64(offset));
+                    } else {
+                        qDebug("jingle-ft: can't check resumed transfer with %s",
+                               qUtf8Printable(q->pad()->session()->peer().full()));
+                        delete hasher;
+                        hasher = nullptr;
+                        incomingChecksum.clear();
+                    }
+                }
             }
             if (q->senders() == q->pad()->session()->role()) {
-                writeNextBlockToTransport();
+                // the hasher reads what is sent this way from the file in its own thread
+                zeroCopy = !dev->isSequential() && qobject_cast<QFile *>(dev)
+                    && !(connection->features() & TransportFeature::MessageOriented);
+                writeToTransport();
             } else {
                 readNextBlockFromTransport();
             }
@@ -249,10 +289,50 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
         inline std::size_t getBlockSize()
         {
             auto sz = connection->blockSize();
-            return sz ? sz : 8192;
+            return sz ? sz : (blockSize ? blockSize : MIN_BLOCK_SIZE);
+        }
+
+        void adaptBlockSize(qint64 written)
+        {
+            if (!blockSize)
+                return;
+            if (!rateTimer.isValid())
+                rateTimer.start();
+            rateBytes += quint64(written);
+            auto elapsed = rateTimer.elapsed();
+            if (elapsed >= RATE_WINDOW.count()) {
+                blockLimit = qBound(MIN_BLOCK_SIZE, rateBytes * quint64(BLOCK_DRAIN_TIME.count()) / quint64(elapsed),
+                                    MAX_BLOCK_SIZE);
+                rateBytes  = 0;
+                rateTimer.restart();
+            }
+            if (connection->bytesToWrite() == 0)
+                blockSize = qMin(blockSize * 2, blockLimit); // starving. we are too slow to fill it
+            else if (blockSize > blockLimit)
+                blockSize = blockLimit;
         }
 
-        void writeNextBlockToTransport()
+        // Keeps the transport a couple of blocks ahead. In zero-copy mode the socket buffer is the queue, so we
+        // push as long as nothing is buffered in userspace.
+        void writeToTransport()
+        {
+            if (!device || q->_state == State::Finished)
+                return;
+            qint64 budget = 4 * MAX_BLOCK_SIZE;
+            while (budget > 0) {
+                auto queued = quint64(connection->bytesToWrite());
+                if (zeroCopy ? queued > 0 : queued >= 2 * getBlockSize())
+                    return;
+                auto written = writeNextBlockToTransport();
+                if (written <= 0)
+                    return;
+                budget -= written;
+            }
+            QTimer::singleShot(0, q, [this]() { writeToTransport(); }); // let others run too
+        }
+
+        // returns bytes handed to the transport
+        qint64 writeNextBlockToTransport()
         {
             if (bytesLeft && *bytesLeft == 0) {
                 if (hasher) {
@@ -260,27 +340,50 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
                     if (hash.isValid()) {
                         outgoingChecksum << hash;
                         emit q->updated();
-                        return;
+                        return 0;
                     }
                 }
                 expectReceived();
-                return; // everything is written
+                return 0; // everything is written
             }
             quint64 sz = getBlockSize();
             if (bytesLeft && sz > *bytesLeft) {
                 sz = *bytesLeft;
             }
+            if (zeroCopy) {
+                // nothing is copied, so there is no point in small blocks
+                auto pos  = device->pos();
+                auto sent = connection->sendFile(static_cast<QFile *>(device), pos,
+                                                 qint64(bytesLeft ? qMin(*bytesLeft, MAX_BLOCK_SIZE) : MAX_BLOCK_SIZE));
+                if (sent > 0) {
+                    if (!device->seek(pos + sent)) {
+                        handleStreamFail(QString::fromLatin1("source device failed"));
+                        return 0;
+                    }
+                    if (hasher)
+                        hasher->addFile(static_cast<QFile *>(device)->fileName(), pos, sent);
+                    emit q->progress(pos + sent);
+                    if (bytesLeft) {
+                        *bytesLeft -= quint64(sent);
+                    }
+                    return sent;
+                }
+                if (sent < 0)
+                    zeroCopy = false; // not supported by the transport or the platform
+                // Otherwise the socket is full or it's the end of the file. A regular block either finds the end
+                // or gets us bytesWritten() when there is room again.
+            }
             QByteArray data;
             if (device->isSequential()) {
                 sz = qMin(sz, quint64(device->bytesAvailable()));
                 if (!sz)
-                    return; // we will come back on readyRead
+                    return 0; // we will come back on readyRead
             }
             data.resize(sz);
             auto readSz = device->read(data.data(), sz);
             if (readSz < 0) {
                 handleStreamFail(QString::fromLatin1("source device failed"));
-                return;
+                return 0;
             }
             data.resize(readSz);
             if (readSz == 0) {
@@ -291,14 +394,14 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
                         if (hash.isValid()) {
                             outgoingChecksum << hash;
                             emit q->updated();
-                            return;
+                            return 0;
                         }
                     }
                     setState(State::Finished);
                 } else {
                     handleStreamFail();
                 }
-                return;
+                return 0;
             } else if (hasher) {
                 hasher->addData(data);
             }
@@ -306,18 +409,19 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
             if (connection->features() & TransportFeature::MessageOriented) {
                 if (!connection->writeDatagram(data)) {
                     handleStreamFail();
-                    return;
+                    return 0;
                 }
             } else {
                 if (connection->write(data) == -1) {
                     handleStreamFail();
-                    return;
+                    return 0;
                 }
             }
             emit q->progress(device->pos());
             if (bytesLeft) {
                 *bytesLeft -= data.size();
             }
+            return readSz;
         }
 
         void readNextBlockFromTransport()
@@ -329,7 +433,7 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
                 if (connection->features() & TransportFeature::MessageOriented) {
                     data = connection->readDatagram().data();
                 } else {
-                    quint64 sz = 65536; // shall we respect transport->blockSize() ?
+                    quint64 sz = MAX_BLOCK_SIZE; // take whatever came at once
                     if (bytesLeft && sz > *bytesLeft) {
                         sz = *bytesLeft;
                     }
@@ -368,6 +472,9 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
             qDebug("jingle-ft: connected. ready to transfer user data with %s",
                    qUtf8Printable(q->pad()->session()->peer().full()));
             connection = newConnection;
+            if (!connection->blockSize() && (connection->features() & TransportFeature::Fast)
+                && !(connection->features() & TransportFeature::MessageOriented))
+                blockSize = MIN_BLOCK_SIZE;
 
             lastReason = {};
             lastError  = {};
@@ -375,6 +482,8 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
             if (acceptFile.range().isValid()) {
                 if (acceptFile.range().length) {
                     bytesLeft = acceptFile.range().length;
+                } else if (acceptFile.size() && *acceptFile.size() >= acceptFile.range().offset) {
+                    bytesLeft = *acceptFile.size() - acceptFile.range().offset; // till the end
                 }
             } else {
                 bytesLeft = acceptFile.size();
@@ -387,7 +496,7 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
                     connection->setReadHook([this](char *buf, qint64 size) {
                         // in streaming mode we need this to compute hash sum and detect stream end is size was defined
                         if (hasher) {
-                            hasher->addData(QByteArray::fromRawData(buf, size));
+                            hasher->addData(QByteArray(buf, int(size))); // hashed later in the pool
                         }
                         if (bytesLeft) {
                             *bytesLeft -= quint64(size);
@@ -422,9 +531,9 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
                                qUtf8Printable(q->pad()->session()->peer().full()));
                         writeLoggingStarted = true;
                     }
-                    auto bs = getBlockSize();
-                    if (q->pad()->session()->role() == q->senders() && quint64(connection->bytesToWrite()) < bs) {
-                        writeNextBlockToTransport();
+                    if (q->pad()->session()->role() == q->senders()) {
+                        adaptBlockSize(bytes);
+                        writeToTransport();
                     }
                 },
                 Qt::QueuedConnection);
@@ -460,7 +569,11 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
             }
             if (hasher) {
                 auto expectedHash = hasher->result();
-                bool found        = false;
+                if (!expectedHash.isValid()) { // e.g. failed to read what we got before resume
+                    q->remove(Reason::Condition::MediaError, "failed to compute checksum");
+                    return;
+                }
+                bool found = false;
                 for (auto const &h : std::as_const(incomingChecksum)) {
                     if (h.type() != expectedHash.type())
                         continue;
@@ -617,6 +730,39 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
 
     void Application::setAcceptFile(const File &file) const { d->acceptFile = file; }
 
+    QList<Application *> Application::splitToRanges(int count)
+    {
+        QList<Application *> parts { this };
+        auto                 size = d->file.size();
+        if (!size || count < 2 || *size < quint64(count) || _state > State::Created)
+            return parts;
+
+        auto chunk = *size / quint64(count);
+        auto file  = d->file;
+        file.setSplitId(_contentName); // unique in the session
+        file.setThumbnails({});        // one is enough
+        for (int i = 1; i < count; ++i) {
+            auto app = static_cast<Application *>(_pad->session()->newContent(NS, _senders));
+            if (!app)
+                break;
+            auto offset = chunk * quint64(i);
+            file.setRange(Range(offset, i == count - 1 ? *size - offset : chunk));
+            app->setFile(file);
+            parts << app;
+        }
+        if (parts.size() == 1)
+            return parts;
+        if (parts.size() < count) { // the last one has to take the rest
+            auto last    = parts.last();
+            auto range   = last->d->file.range();
+            range.length = *size - range.offset;
+            last->d->file.setRange(range);
+        }
+        d->file.setRange(Range(0, chunk));
+        d->file.setSplitId(_contentName);
+        return parts;
+    }
+
     bool Application::isTransportReplaceEnabled() const { return _state < State::Active; }
 
     void Application::prepareTransport()
@@ -759,8 +905,42 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
         d->setDevice(dev, closeOnFinish);
     }
 
+    QIODevice *Application::device() const { return d->device; }
+
     Connection::Ptr Application::connection() const { return d->connection.staticCast<XMPP::Jingle::Connection>(); }
 
+    QList<QList<Application *>> groupRanges(const QList<Application *> &apps)
+    {
+        QList<QList<Application *>>         ret;
+        QMap<QString, QList<Application *>> bySplit;
+        for (auto app : apps) {
+            auto file = app->file();
+            if (file.size() && file.range().length && !file.splitId().isEmpty())
+                bySplit[file.splitId()].append(app);
+            else
+                ret.append({ app });
+        }
+        for (auto &parts : bySplit) {
+            std::sort(parts.begin(), parts.end(), [](Application *a, Application *b) {
+                return a->file().range().offset < b->file().range().offset;
+            });
+            auto    first = parts.first()->file();
+            quint64 end   = 0;
+            for (auto app : std::as_const(parts)) {
+                auto file = app->file();
+                if (file.range().offset != end || file.size() != first.size() || file.name() != first.name())
+                    break;
+                end += file.range().length;
+            }
+            if (end == *first.size() && parts.size() > 1)
+                ret.append(parts);
+            else
+                for (auto app : std::as_const(parts))
+                    ret.append({ app });
+        }
+        return ret;
+    }
+
     Pad::Pad(Manager *manager, Session *session) : _manager(manager), _session(session) { }
 
     QDomElement Pad::takeOutgoingSessionInfoUpdate()
@@ -795,9 +975,11 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
                 Checksum checksum(el);
                 auto     app = session()->content(checksum.name, checksum.creator);
                 if (app) {
-                    qDebug("jignle-ft: got checksum: %s for %s", qPrintable(checksum.file.hashes().value(0).toString()),
+                    auto const &range  = checksum.file.range(); // ranges have their own hashes
+                    auto        hashes = range.hashes.isEmpty() ? checksum.file.hashes() : range.hashes;
+                    qDebug("jignle-ft: got checksum: %s for %s", qPrintable(hashes.value(0).toString()),
                            qUtf8Printable(session()->peer().full()));
-                    static_cast<Application *>(app)->d->onIncomingChecksum(checksum.file.hashes());
+                    static_cast<Application *>(app)->d->onIncomingChecksum(hashes);
                 }
                 return true;
             } else if (el.tagName() == RECEIVED_TAG) {
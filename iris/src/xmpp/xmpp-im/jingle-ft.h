@@ -33,6 +33,8 @@ class Thumbnail;
 namespace XMPP { namespace Jingle { namespace FileTransfer {
 
     extern const QString NS;
+    extern const QString PARALLEL_NS; // the peer joins ranges of a file sent in parallel contents
+    extern const QString RESUME_NS;   // the peer checksums a resumed file as a whole, not just the rest of it
     class Manager;
 
     class Pad : public ApplicationManagerPad {
@@ -75,6 +77,17 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
         File acceptFile() const; // either local or remote File as an answer to the offer
         void setAcceptFile(const File &file) const;
 
+        /**
+         * @brief splitToRanges splits the file offer into count contents sending a range of the file each.
+         *
+         * Every content gets a transport connection of its own, so the file goes in parallel streams.
+         * All the parts get the same File::splitId(). The peer has to support PARALLEL_NS to put it together,
+         * see groupRanges().
+         * Has to be called after setFile() and before the offer is sent.
+         * @return all the parts, this one first. The new ones have to be added to the session too.
+         */
+        QList<Application *> splitToRanges(int count);
+
         /**
          * @brief setStreamingMode enables external download control.
          *
@@ -91,6 +104,7 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
         void setStreamingMode(bool mode = true);
 
         void            setDevice(QIODevice *dev, bool closeOnFinish = true);
+        QIODevice      *device() const;
         Connection::Ptr connection() const;
 
         // next method are used by Jingle::Session and usually shouldn't be called manually
@@ -121,6 +135,15 @@ namespace XMPP { namespace Jingle { namespace FileTransfer {
         std::unique_ptr<Private> d;
     };
 
+    /**
+     * @brief groupRanges finds contents which together carry one file, see Application::splitToRanges().
+     *
+     * Contents marked with the same File::splitId() whose ranges cover the file exactly come as one group
+     * sorted by offset.
+     * Anything else comes as a group of one.
+     */
+    QList<QList<Application *>> groupRanges(const QList<Application *> &apps);
+
     class Manager : public XMPP::Jingle::ApplicationManager {
         Q_OBJECT
     public:
@@ -591,55 +591,9 @@ namespace XMPP { namespace Jingle { namespace ICE {
             auto extDisco = q->pad()->session()->manager()->client()->externalServiceDiscovery();
             using namespace std::chrono_literals;
             if (extDisco->isSupported()) {
-                extDisco->services(q,
-                                   [this](const ExternalServiceList &services) {
-                                       ExternalService::Ptr stun;
-                                       ExternalService::Ptr turnUdp;
-                                       ExternalService::Ptr turnTcp;
-                                       for (auto const &s : std::as_const(services)) {
-                                           if (s->type == QLatin1String("stun")
-                                               && (s->transport.isEmpty() || s->transport == QLatin1String("udp")))
-                                               stun = s;
-                                           else if (s->type == QLatin1String("turn")) {
-                                               if (s->transport == QLatin1String("tcp"))
-                                                   turnTcp = s;
-                                               else
-                                                   turnUdp = s;
-                                           }
-                                       }
-                                       Resolver::ResolveList resList;
-                                       if (stun) {
-                                           stunBindAddr.setAddress(stun->host);
-                                           stunBindPort = stun->port;
-                                           if (stunBindAddr.isNull())
-                                               resList.emplace_back(stun->host, std::ref(stunBindAddr));
-                                       }
-                                       if (turnTcp) {
-                                           stunRelayTcpAddr.setAddress(turnTcp->host);
-                                           stunRelayTcpPort = turnTcp->port;
-                                           stunRelayTcpUser = turnTcp->username;
-                                           stunRelayTcpPass = turnTcp->password;
-                                           if (stunRelayTcpAddr.isNull())
-                                               resList.emplace_back(turnTcp->host, std::ref(stunRelayTcpAddr));
-                                       }
-                                       if (turnUdp) {
-                                           stunRelayUdpAddr.setAddress(turnUdp->host);
-                                           stunRelayUdpPort = turnUdp->port;
-                                           stunRelayUdpUser = turnUdp->username;
-                                           stunRelayUdpPass = turnUdp->password;
-                                           if (stunRelayUdpAddr.isNull())
-                                               resList.emplace_back(turnUdp->host, std::ref(stunRelayUdpAddr));
-                                       }
-                                       if (resList.empty()) {
-                                           startIce();
-                                       } else {
-                                           Resolver::resolve(q, resList, [this]() {
-                                               qDebug("resolver finished");
-                                               startIce();
-                                           });
-                                       }
-                                   },
-                                   5min, { "stun", "turn" });
+                extDisco->services(
+                    q, [this](const ExternalServiceList &services) { useExternalServices(services); }, 5min,
+                    { "stun", "turn" });
                 return;
             }
 
@@ -662,6 +616,89 @@ namespace XMPP { namespace Jingle { namespace ICE {
                               });
         }
 
+        void useExternalServices(const ExternalServiceList &services)
+        {
+            ExternalService::Ptr stun;
+            ExternalService::Ptr turnUdp;
+            ExternalService::Ptr turnTcp;
+            for (auto const &s : std::as_const(services)) {
+                if (s->type == QLatin1String("stun")
+                    && (s->transport.isEmpty() || s->transport == QLatin1String("udp")))
+                    stun = s;
+                else if (s->type == QLatin1String("turn")) {
+                    if (s->transport == QLatin1String("tcp"))
+                        turnTcp = s;
+                    else
+                        turnUdp = s;
+                }
+            }
+
+            // restricted turn servers need credentials. those are cached for the account until they expire
+            using namespace std::chrono_literals;
+            QSet<ExternalServiceId> ids;
+            for (auto const &turn : { turnUdp, turnTcp }) {
+                if (turn && turn->needsNewCreds(5min))
+                    ids.insert({ turn->host, turn->type, turn->port });
+            }
+            if (ids.isEmpty()) {
+                setupExternalServices(stun, turnUdp, turnTcp);
+                return;
+            }
+
+            auto extDisco = q->pad()->session()->manager()->client()->externalServiceDiscovery();
+            extDisco->credentials(
+                q,
+                [this, stun, turnUdp, turnTcp](const ExternalServiceList &creds) {
+                    for (auto const &c : creds) {
+                        for (auto const &turn : { turnUdp, turnTcp }) {
+                            if (turn && turn->host == c->host && turn->type == c->type
+                                && (c->port == 0 || turn->port == c->port)) {
+                                turn->username = c->username;
+                                turn->password = c->password;
+                            }
+                        }
+                    }
+                    setupExternalServices(stun, turnUdp, turnTcp);
+                },
+                ids, 5min);
+        }
+
+        void setupExternalServices(ExternalService::Ptr stun, ExternalService::Ptr turnUdp,
+                                   ExternalService::Ptr turnTcp)
+        {
+            Resolver::ResolveList resList;
+            if (stun) {
+                stunBindAddr.setAddress(stun->host);
+                stunBindPort = stun->port;
+                if (stunBindAddr.isNull())
+                    resList.emplace_back(stun->host, std::ref(stunBindAddr));
+            }
+            if (turnTcp) {
+                stunRelayTcpAddr.setAddress(turnTcp->host);
+                stunRelayTcpPort = turnTcp->port;
+                stunRelayTcpUser = turnTcp->username;
+                stunRelayTcpPass = turnTcp->password;
+                if (stunRelayTcpAddr.isNull())
+                    resList.emplace_back(turnTcp->host, std::ref(stunRelayTcpAddr));
+            }
+            if (turnUdp) {
+                stunRelayUdpAddr.setAddress(turnUdp->host);
+                stunRelayUdpPort = turnUdp->port;
+                stunRelayUdpUser = turnUdp->username;
+                stunRelayUdpPass = turnUdp->password;
+                if (stunRelayUdpAddr.isNull())
+                    resList.emplace_back(turnUdp->host, std::ref(stunRelayUdpAddr));
+            }
+            if (resList.empty()) {
+                startIce();
+            } else {
+                Resolver::resolve(q, resList, [this]() {
+                    qDebug("resolver finished");
+                    startIce();
+                });
+            }
+        }
+
         void startIce()
         {
             auto manager = dynamic_cast<Manager *>(q->_pad->manager())->d.get();
@@ -28,6 +28,7 @@
 #include "xmpp_client.h"
 #include "xmpp_serverinfomanager.h"
 
+#include <QDeadlineTimer>
 #include <QElapsedTimer>
 #include <QNetworkInterface>
 #include <QTimer>
@@ -96,6 +97,13 @@ namespace XMPP { namespace Jingle { namespace S5B {
 
         qint64 bytesToWrite() const { return client ? client->bytesToWrite() : 0; }
 
+        qint64 sendFile(QFile *file, qint64 offset, qint64 size)
+        {
+            if (mode == Transport::Tcp && client)
+                return client->sendFile(file, offset, size);
+            return -1;
+        }
+
         void close()
         {
             if (!client) {
@@ -642,21 +650,34 @@ namespace XMPP { namespace Jingle { namespace S5B {
             return false;
         }
 
-        // queries proxy's host/port and sends the candidate to remote
-        void queryS5BProxy(const Jid &j, const QString &cid)
+        // queries proxy's host/port and sends the candidate to remote.
+        // returns true if those are known for the account already and the candidate is ready to be sent
+        bool queryS5BProxy(const Jid &j, const QString &cid)
         {
+            auto m  = static_cast<Manager *>(q->_pad->manager());
+            auto sh = m->cachedProxy(j);
+            if (!sh.host().isEmpty()) {
+                auto it = localCandidates.find(cid);
+                if (it != localCandidates.end() && it->second.state() == Candidate::Probing) {
+                    it->second.setHost(sh.host());
+                    it->second.setPort(quint16(sh.port()));
+                    it->second.setState(Candidate::New);
+                    pendingActions |= Private::NewCandidate;
+                    return true;
+                }
+                return false;
+            }
+
             proxiesInDiscoCount++;
-            auto query = new JT_S5B(q->_pad->session()->manager()->client()->rootTask());
-            connect(query, &JT_S5B::finished, q, [this, query, cid]() {
+            m->queryProxy(j, q, [this, cid](const StreamHost &sh) {
                 if (!proxyDiscoveryInProgress) {
                     return;
                 }
                 bool candidateUpdated = false;
                 auto it               = localCandidates.find(cid);
                 if (it != localCandidates.end() && it->second.state() == Candidate::Probing) {
-                    auto &c  = it->second;
-                    auto  sh = query->proxyInfo();
-                    if (query->success() && !sh.host().isEmpty() && sh.port()) {
+                    auto &c = it->second;
+                    if (!sh.host().isEmpty() && sh.port()) {
                         // it can be discarded by this moment (e.g. got success on a higher priority
                         // candidate). so we have to check.
                         c.setHost(sh.host());
@@ -679,8 +700,7 @@ namespace XMPP { namespace Jingle { namespace S5B {
                     checkAndFinishNegotiation();
                 }
             });
-            query->requestProxyInfo(j);
-            query->go(true);
+            return false;
         }
 
         void discoS5BProxy()
@@ -710,6 +730,7 @@ namespace XMPP { namespace Jingle { namespace S5B {
                 auto m         = static_cast<Manager *>(q->_pad->manager());
                 Jid  userProxy = m->userProxy();
 
+                bool cached         = false; // some candidates are ready right away
                 bool userProxyFound = !userProxy.isValid();
                 for (const auto &i : items) {
                     quint16 localPref = 0;
@@ -721,16 +742,21 @@ namespace XMPP { namespace Jingle { namespace S5B {
                     Candidate c(q, i.jid(), generateCid(), localPref);
                     localCandidates.emplace(c.cid(), c);
                     qDebug("new local candidate: %s", qPrintable(c.toString()));
-                    queryS5BProxy(i.jid(), c.cid());
+                    cached |= queryS5BProxy(i.jid(), c.cid());
                 }
                 if (!userProxyFound) {
                     Candidate c(q, userProxy, generateCid(), 1);
                     localCandidates.emplace(c.cid(), c);
                     qDebug("new local candidate: %s", qPrintable(c.toString()));
-                    queryS5BProxy(userProxy, c.cid());
-                } else if (items.count() == 0) {
-                    // seems like we don't have any proxy
+                    cached |= queryS5BProxy(userProxy, c.cid());
+                }
+                if (!proxiesInDiscoCount) {
+                    // seems like we don't have any proxy or all of them were cached
                     proxyDiscoveryInProgress = false;
+                }
+                if (cached) {
+                    emit q->updated();
+                } else if (!proxyDiscoveryInProgress) {
                     checkAndFinishNegotiation();
                 }
             });
@@ -1698,6 +1724,12 @@ namespace XMPP { namespace Jingle { namespace S5B {
 
     class Manager::Private {
     public:
+        struct CachedProxy {
+            StreamHost       streamHost;
+            QDeadlineTimer   expires;
+            QPointer<JT_S5B> query;
+        };
+
         XMPP::Jingle::Manager *jingleManager = nullptr;
 
         // FIMME it's reuiqred to split transports by direction otherwise we gonna hit conflicts.
@@ -1705,6 +1737,8 @@ namespace XMPP { namespace Jingle { namespace S5B {
         QSet<QPair<Jid, QString>>   sids;
         QHash<QString, Transport *> key2transport;
         Jid                         proxy;
+        QHash<Jid, CachedProxy>     proxies; // shared by all the transports of the account
+        std::chrono::milliseconds   proxyCacheTtl = std::chrono::minutes(60);
     };
 
     Manager::Manager(QObject *parent) : TransportManager(parent), d(new Private) { }
@@ -1784,6 +1818,49 @@ namespace XMPP { namespace Jingle { namespace S5B {
 
     void Manager::setUserProxy(const Jid &jid) { d->proxy = jid; }
 
+    void Manager::setProxyCacheTtl(std::chrono::milliseconds ttl) { d->proxyCacheTtl = ttl; }
+
+    StreamHost Manager::cachedProxy(const Jid &proxy)
+    {
+        auto it = d->proxies.constFind(proxy);
+        if (it == d->proxies.constEnd() || it->expires.hasExpired())
+            return StreamHost();
+
+        StreamHost sh = it->streamHost;
+        if (it->expires.remainingTimeAsDuration() < d->proxyCacheTtl / 2)
+            queryProxy(proxy, this, [](const StreamHost &) { });
+        return sh;
+    }
+
+    void Manager::queryProxy(const Jid &proxy, QObject *ctx, std::function<void(const StreamHost &)> &&callback)
+    {
+        auto &entry = d->proxies[proxy];
+        if (!entry.query) {
+            auto query  = new JT_S5B(d->jingleManager->client()->rootTask());
+            entry.query = query;
+            // connected before any caller so they see the updated cache
+            connect(query, &JT_S5B::finished, this, [this, proxy, query]() {
+                auto it = d->proxies.find(proxy);
+                if (it == d->proxies.end())
+                    return;
+                auto sh = query->proxyInfo();
+                if (query->success() && !sh.host().isEmpty() && sh.port()) {
+                    it->streamHost = sh;
+                    it->expires    = QDeadlineTimer(d->proxyCacheTtl);
+                } else {
+                    d->proxies.erase(it); // next transport will try again
+                }
+            });
+            query->requestProxyInfo(proxy);
+            query->go(true);
+        }
+
+        auto query = entry.query.data();
+        connect(query, &JT_S5B::finished, ctx, [query, cb = std::move(callback)]() {
+            cb(query->success() ? query->proxyInfo() : StreamHost());
+        });
+    }
+
     //----------------------------------------------------------------
     // Pad
     //----------------------------------------------------------------
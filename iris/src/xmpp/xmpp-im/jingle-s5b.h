@@ -23,11 +23,15 @@
 #include <iris/irisnet/noncore/tcpportreserver.h>
 #include <iris/xmpp-im/jingle-transport.h>
 
+#include <chrono>
+#include <functional>
+
 class QHostAddress;
 class SocksClient;
 
 namespace XMPP {
 class Client;
+class StreamHost;
 
 namespace Jingle { namespace S5B {
     extern const QString NS;
@@ -201,6 +205,28 @@ namespace Jingle { namespace S5B {
         Jid  userProxy() const;
         void setUserProxy(const Jid &jid);
 
+        /**
+         * @brief cachedProxy returns host/port recently reported by a SOCKS5 proxy, so new transports of the
+         *        account can offer it without asking the proxy again. An entry getting old is refreshed in the
+         *        background.
+         * @return the streamhost or one with an empty host if the proxy isn't known
+         */
+        StreamHost cachedProxy(const Jid &proxy);
+
+        /**
+         * @brief queryProxy requests host/port from the proxy and caches them. Simultaneous queries to the same
+         *        proxy are sent just once.
+         * @param ctx      - if ctx dies, the callback won't be called
+         * @param callback - gets the streamhost or one with an empty host on failure
+         */
+        void queryProxy(const Jid &proxy, QObject *ctx, std::function<void(const StreamHost &)> &&callback);
+
+        /**
+         * @brief setProxyCacheTtl sets how long host/port reported by a proxy are trusted. An hour by default
+         * @param ttl
+         */
+        void setProxyCacheTtl(std::chrono::milliseconds ttl);
+
         /**
          * @brief addKeyMapping sets mapping between key/socks hostname used for direct connection and transport.
          *        The key is sha1(sid, initiator full jid, responder full jid)
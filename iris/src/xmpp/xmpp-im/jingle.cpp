@@ -386,7 +386,11 @@ namespace XMPP { namespace Jingle {
         QList<QString> externalSessions;
 
     public:
-        JTPush(Task *parent) : Task(parent) { }
+        JTPush(Task *parent) : Task(parent)
+        {
+            registerPush(QStringLiteral("iq"), ::XMPP::Jingle::NS);
+            registerPush(QStringLiteral("iq"), JINGLEPUB_NS);
+        }
 
         ~JTPush() { }
 
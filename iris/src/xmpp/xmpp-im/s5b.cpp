@@ -1981,7 +1981,7 @@ StreamHost JT_S5B::proxyInfo() const { return d->proxyInfo; }
 //----------------------------------------------------------------------------
 // JT_PushS5B
 //----------------------------------------------------------------------------
-JT_PushS5B::JT_PushS5B(Task *parent) : Task(parent) { }
+JT_PushS5B::JT_PushS5B(Task *parent) : Task(parent) { registerPush(QStringLiteral("iq"), QLatin1String(S5B_NS)); }
 
 JT_PushS5B::~JT_PushS5B() { }
 
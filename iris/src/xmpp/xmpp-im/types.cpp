@@ -760,9 +760,59 @@ public:
     Forwarding                               forwarding;          // XEP-0297
     Message::Reactions                       reactions;           // XEP-0444
     QString                                  retraction;          // XEP-0424
+
+    // Extensions of a received message are decoded on the first access to them.
+    // fromStanza only indexes the stanza children by namespace.
+    enum Ext : quint32 {
+        ExtPubSubEvent = 1 << 0,
+        ExtBoB         = 1 << 1,
+        ExtXHtml       = 1 << 2,
+        ExtOob         = 1 << 3,
+        ExtEvent       = 1 << 4,
+        ExtChatState   = 1 << 5,
+        ExtReceipts    = 1 << 6,
+        ExtSigned      = 1 << 7,
+        ExtEncrypted   = 1 << 8,
+        ExtAddresses   = 1 << 9,
+        ExtRosterX     = 1 << 10,
+        ExtConference  = 1 << 11,
+        ExtNick        = 1 << 12,
+        ExtSxe         = 1 << 13,
+        ExtMUCUser     = 1 << 14,
+        ExtHttpAuth    = 1 << 15,
+        ExtXData       = 1 << 16, // jabber:x:data or the one inside urn:xmpp:captcha
+        ExtIBB         = 1 << 17,
+        ExtCorrection  = 1 << 18,
+        ExtReference   = 1 << 19,
+        ExtFileSharing = 1 << 20, // file-sharing and sources
+        ExtAttachTo    = 1 << 21,
+        ExtJinglePub   = 1 << 22,
+        ExtReactions   = 1 << 23,
+        ExtRetraction  = 1 << 24,
+        ExtAll         = (1u << 25) - 1
+    };
+
+    QList<QPair<Ext, QDomElement>> extElements; // not decoded yet
+    quint32                        pending = 0;
+
+    static Ext extOf(const QString &ns);
+
+    inline Private *decoded(quint32 exts)
+    {
+        if (pending & exts)
+            decode(pending & exts);
+        return this;
+    }
+
+private:
+    void decode(quint32 exts);
+    void decode(Ext ext, const QList<QDomElement> &elements);
 };
 
 #define MessageD() (d ? d : (d = new Private))
+// Private with the given extension decoded from the received stanza
+#define MessageExt(ext) (d->decoded(Private::Ext##ext))
+#define MessageDExt(ext) (MessageD()->decoded(Private::Ext##ext))
 //! \brief Constructs Message with given Jid information.
 //!
 //! This function will construct a Message container.
@@ -870,7 +920,7 @@ QString Message::body(const QLocale &lang) const { return body(lang.bcp47Name())
 HTMLElement Message::html(const QString &lang) const
 {
     if (containsHTML()) {
-        if (d->htmlElements.contains(lang))
+        if (d->htmlElements.contains(lang)) // decoded by containsHTML()
             return d->htmlElements[lang];
         else
             return d->htmlElements.begin().value();
@@ -882,7 +932,7 @@ HTMLElement Message::html(const QString &lang) const
 //!
 //! Returns true if there is at least one xhtml-im body
 //! in the message.
-bool Message::containsHTML() const { return d && !(d->htmlElements.isEmpty()); }
+bool Message::containsHTML() const { return d && !(MessageExt(XHtml)->htmlElements.isEmpty()); }
 
 QString Message::thread() const { return d ? d->thread : QString(); }
 
@@ -947,7 +997,7 @@ void Message::setBody(const QString &s, const QString &lang)
 //! \param s - body node
 //! \param lang - body language
 //! \note The body should be in xhtml.
-void Message::setHTML(const HTMLElement &e, const QString &lang) { MessageD()->htmlElements[lang] = e; }
+void Message::setHTML(const HTMLElement &e, const QString &lang) { MessageDExt(XHtml)->htmlElements[lang] = e; }
 
 void Message::setThread(const QString &s, bool send)
 {
@@ -961,7 +1011,7 @@ void Message::setError(const Stanza::Error &err) { MessageD()->error = err; }
 const QList<PubSubEvent> &Message::pubSubEvents() const
 {
     static const QList<PubSubEvent> empty;
-    return d ? d->pubSubEvents : empty;
+    return d ? MessageExt(PubSubEvent)->pubSubEvents : empty;
 }
 
 QString Message::pubsubNode() const
@@ -969,7 +1019,7 @@ QString Message::pubsubNode() const
     if (!d)
         return {};
     QString node;
-    for (const auto &event : d->pubSubEvents) {
+    for (const auto &event : MessageExt(PubSubEvent)->pubSubEvents) {
         if (event.type() == PubSubEvent::Type::Items)
             node = event.node();
     }
@@ -981,7 +1031,7 @@ QList<PubSubItem> Message::pubsubItems() const
     QList<PubSubItem> items;
     if (!d)
         return items;
-    for (const auto &event : d->pubSubEvents) {
+    for (const auto &event : MessageExt(PubSubEvent)->pubSubEvents) {
         if (event.type() != PubSubEvent::Type::Items)
             continue;
         // Preserve the legacy accessor's behavior: payload-less item
@@ -999,7 +1049,7 @@ QList<PubSubRetraction> Message::pubsubRetractions() const
     QList<PubSubRetraction> retractions;
     if (!d)
         return retractions;
-    for (const auto &event : d->pubSubEvents) {
+    for (const auto &event : MessageExt(PubSubEvent)->pubSubEvents) {
         if (event.type() == PubSubEvent::Type::Items)
             retractions += event.retractions();
     }
@@ -1015,39 +1065,39 @@ void Message::setTimeStamp(const QDateTime &ts, bool send)
 }
 
 //! \brief Return list of urls attached to message.
-UrlList Message::urlList() const { return d ? d->urlList : UrlList(); }
+UrlList Message::urlList() const { return d ? MessageExt(Oob)->urlList : UrlList(); }
 
 //! \brief Add Url to the url list.
 //!
 //! \param url - url to append
-void Message::urlAdd(const Url &u) { MessageD()->urlList += u; }
+void Message::urlAdd(const Url &u) { MessageDExt(Oob)->urlList += u; }
 
 //! \brief clear out the url list.
 void Message::urlsClear()
 {
     if (d) {
-        d->urlList.clear();
+        MessageExt(Oob)->urlList.clear();
     }
 }
 
 //! \brief Set urls to send
 //!
 //! \param urlList - list of urls to send
-void Message::setUrlList(const UrlList &list) { MessageD()->urlList = list; }
+void Message::setUrlList(const UrlList &list) { MessageDExt(Oob)->urlList = list; }
 
 //! \brief Return list of addresses attached to message.
-AddressList Message::addresses() const { return d ? d->addressList : AddressList(); }
+AddressList Message::addresses() const { return d ? MessageExt(Addresses)->addressList : AddressList(); }
 
 //! \brief Add Address to the address list.
 //!
 //! \param address - address to append
-void Message::addAddress(const Address &a) { MessageD()->addressList += a; }
+void Message::addAddress(const Address &a) { MessageDExt(Addresses)->addressList += a; }
 
 //! \brief clear out the address list.
 void Message::clearAddresses()
 {
     if (d) {
-        d->addressList.clear();
+        MessageExt(Addresses)->addressList.clear();
     }
 }
 
@@ -1057,7 +1107,7 @@ AddressList Message::findAddresses(Address::Type t) const
         return AddressList();
     }
     AddressList matches;
-    for (const Address &a : std::as_const(d->addressList)) {
+    for (const Address &a : std::as_const(MessageExt(Addresses)->addressList)) {
         if (a.type() == t)
             matches.append(a);
     }
@@ -1067,66 +1117,75 @@ AddressList Message::findAddresses(Address::Type t) const
 //! \brief Set addresses to send
 //!
 //! \param list - list of addresses to send
-void Message::setAddresses(const AddressList &list) { MessageD()->addressList = list; }
+void Message::setAddresses(const AddressList &list) { MessageDExt(Addresses)->addressList = list; }
 
-RosterExchangeItems Message::rosterExchangeItems() const { return d ? d->rosterExchangeItems : RosterExchangeItems(); }
+RosterExchangeItems Message::rosterExchangeItems() const
+{
+    return d ? MessageExt(RosterX)->rosterExchangeItems : RosterExchangeItems();
+}
 
-void Message::setRosterExchangeItems(const RosterExchangeItems &items) { MessageD()->rosterExchangeItems = items; }
+void Message::setRosterExchangeItems(const RosterExchangeItems &items)
+{
+    MessageDExt(RosterX)->rosterExchangeItems = items;
+}
 
-QString Message::eventId() const { return d ? d->eventId : QString(); }
+QString Message::eventId() const { return d ? MessageExt(Event)->eventId : QString(); }
 
-void Message::setEventId(const QString &id) { MessageD()->eventId = id; }
+void Message::setEventId(const QString &id) { MessageDExt(Event)->eventId = id; }
 
-bool Message::containsEvents() const { return d && !d->eventList.isEmpty(); }
+bool Message::containsEvents() const { return d && !MessageExt(Event)->eventList.isEmpty(); }
 
-bool Message::containsEvent(MsgEvent e) const { return d && d->eventList.contains(e); }
+bool Message::containsEvent(MsgEvent e) const { return d && MessageExt(Event)->eventList.contains(e); }
 
 void Message::addEvent(MsgEvent e)
 {
-    if (!MessageD()->eventList.contains(e)) {
+    if (!MessageDExt(Event)->eventList.contains(e)) {
         if (e == CancelEvent || containsEvent(CancelEvent))
             d->eventList.clear(); // Reset list
         d->eventList += e;
     }
 }
 
-ChatState Message::chatState() const { return d ? d->chatState : StateNone; }
+ChatState Message::chatState() const { return d ? MessageExt(ChatState)->chatState : StateNone; }
 
-void Message::setChatState(ChatState state) { MessageD()->chatState = state; }
+void Message::setChatState(ChatState state) { MessageDExt(ChatState)->chatState = state; }
 
-MessageReceipt Message::messageReceipt() const { return d ? d->messageReceipt : ReceiptNone; }
+MessageReceipt Message::messageReceipt() const { return d ? MessageExt(Receipts)->messageReceipt : ReceiptNone; }
 
-void Message::setMessageReceipt(MessageReceipt messageReceipt) { MessageD()->messageReceipt = messageReceipt; }
+void Message::setMessageReceipt(MessageReceipt messageReceipt)
+{
+    MessageDExt(Receipts)->messageReceipt = messageReceipt;
+}
 
-QString Message::messageReceiptId() const { return d ? d->messageReceiptId : QString(); }
+QString Message::messageReceiptId() const { return d ? MessageExt(Receipts)->messageReceiptId : QString(); }
 
-void Message::setMessageReceiptId(const QString &s) { MessageD()->messageReceiptId = s; }
+void Message::setMessageReceiptId(const QString &s) { MessageDExt(Receipts)->messageReceiptId = s; }
 
-QString Message::xsigned() const { return d ? d->xsigned : QString(); }
+QString Message::xsigned() const { return d ? MessageExt(Signed)->xsigned : QString(); }
 
-void Message::setXSigned(const QString &s) { MessageD()->xsigned = s; }
+void Message::setXSigned(const QString &s) { MessageDExt(Signed)->xsigned = s; }
 
-QString Message::xencrypted() const { return d ? d->xencrypted : QString(); }
+QString Message::xencrypted() const { return d ? MessageExt(Encrypted)->xencrypted : QString(); }
 
-void Message::setXEncrypted(const QString &s) { MessageD()->xencrypted = s; }
+void Message::setXEncrypted(const QString &s) { MessageDExt(Encrypted)->xencrypted = s; }
 
-QList<int> Message::getMUCStatuses() const { return d ? d->mucStatuses : QList<int>(); }
+QList<int> Message::getMUCStatuses() const { return d ? MessageExt(MUCUser)->mucStatuses : QList<int>(); }
 
-void Message::addMUCStatus(int i) { MessageD()->mucStatuses += i; }
+void Message::addMUCStatus(int i) { MessageDExt(MUCUser)->mucStatuses += i; }
 
-void Message::addMUCInvite(const MUCInvite &i) { MessageD()->mucInvites += i; }
+void Message::addMUCInvite(const MUCInvite &i) { MessageDExt(MUCUser)->mucInvites += i; }
 
-QList<MUCInvite> Message::mucInvites() const { return d ? d->mucInvites : QList<MUCInvite>(); }
+QList<MUCInvite> Message::mucInvites() const { return d ? MessageExt(MUCUser)->mucInvites : QList<MUCInvite>(); }
 
-void Message::setMUCDecline(const MUCDecline &de) { MessageD()->mucDecline = de; }
+void Message::setMUCDecline(const MUCDecline &de) { MessageDExt(MUCUser)->mucDecline = de; }
 
-MUCDecline Message::mucDecline() const { return d ? d->mucDecline : MUCDecline(); }
+MUCDecline Message::mucDecline() const { return d ? MessageExt(MUCUser)->mucDecline : MUCDecline(); }
 
-QString Message::mucPassword() const { return d ? d->mucPassword : QString(); }
+QString Message::mucPassword() const { return d ? MessageExt(MUCUser)->mucPassword : QString(); }
 
-void Message::setMUCPassword(const QString &p) { MessageD()->mucPassword = p; }
+void Message::setMUCPassword(const QString &p) { MessageDExt(MUCUser)->mucPassword = p; }
 
-bool Message::hasMUCUser() const { return d && d->hasMUCUser; }
+bool Message::hasMUCUser() const { return d && MessageExt(MUCUser)->hasMUCUser; }
 
 Message::StanzaId Message::stanzaId() const { return d ? d->stanzaId : StanzaId(); }
 
@@ -1140,87 +1199,93 @@ QString Message::encryptionProtocol() const { return d ? d->encryptionProtocol :
 
 void Message::setEncryptionProtocol(const QString &protocol) { MessageD()->encryptionProtocol = protocol; }
 
-QList<Reference> Message::references() const { return d ? d->references : QList<Reference>(); }
+QList<Reference> Message::references() const { return d ? MessageExt(Reference)->references : QList<Reference>(); }
 
-void Message::addReference(const Reference &r) { MessageD()->references.append(r); }
+void Message::addReference(const Reference &r) { MessageDExt(Reference)->references.append(r); }
 
-void Message::setReferences(const QList<Reference> &r) { MessageD()->references = r; }
+void Message::setReferences(const QList<Reference> &r) { MessageDExt(Reference)->references = r; }
 
 QList<StatelessFileSharing::FileSharing> Message::fileSharings() const
 {
-    return d ? d->fileSharings : QList<StatelessFileSharing::FileSharing>();
+    return d ? MessageExt(FileSharing)->fileSharings : QList<StatelessFileSharing::FileSharing>();
 }
 void Message::addFileSharing(const StatelessFileSharing::FileSharing &sharing)
 {
     if (sharing.isValid())
-        MessageD()->fileSharings.append(sharing);
+        MessageDExt(FileSharing)->fileSharings.append(sharing);
 }
 void Message::setFileSharings(const QList<StatelessFileSharing::FileSharing> &sharings)
 {
-    MessageD()->fileSharings = sharings;
+    MessageDExt(FileSharing)->fileSharings = sharings;
 }
 QList<StatelessFileSharing::Sources> Message::attachedFileSources() const
 {
-    return d ? d->attachedFileSources : QList<StatelessFileSharing::Sources>();
+    return d ? MessageExt(FileSharing)->attachedFileSources : QList<StatelessFileSharing::Sources>();
 }
 void Message::addAttachedFileSources(const StatelessFileSharing::Sources &sources)
 {
     if (sources.isValid())
-        MessageD()->attachedFileSources.append(sources);
+        MessageDExt(FileSharing)->attachedFileSources.append(sources);
 }
 void Message::setAttachedFileSources(const QList<StatelessFileSharing::Sources> &sources)
 {
-    MessageD()->attachedFileSources = sources;
+    MessageDExt(FileSharing)->attachedFileSources = sources;
 }
-QString                  Message::attachToId() const { return d ? d->attachToId : QString(); }
-void                     Message::setAttachToId(const QString &id) { MessageD()->attachToId = id; }
+QString                  Message::attachToId() const { return d ? MessageExt(AttachTo)->attachToId : QString(); }
+void                     Message::setAttachToId(const QString &id) { MessageDExt(AttachTo)->attachToId = id; }
 QList<Jingle::JinglePub> Message::jinglePublications() const
 {
-    return d ? d->jinglePublications : QList<Jingle::JinglePub>();
+    return d ? MessageExt(JinglePub)->jinglePublications : QList<Jingle::JinglePub>();
 }
 void Message::addJinglePublication(const Jingle::JinglePub &publication)
 {
     if (publication.isValid())
-        MessageD()->jinglePublications.append(publication);
+        MessageDExt(JinglePub)->jinglePublications.append(publication);
 }
 void Message::setJinglePublications(const QList<Jingle::JinglePub> &publications)
 {
-    MessageD()->jinglePublications = publications;
+    MessageDExt(JinglePub)->jinglePublications = publications;
 }
 
-void Message::setReactions(const XMPP::Message::Reactions &reactions) { MessageD()->reactions = reactions; }
+void Message::setReactions(const XMPP::Message::Reactions &reactions) { MessageDExt(Reactions)->reactions = reactions; }
 
-XMPP::Message::Reactions Message::reactions() const { return d ? d->reactions : Reactions {}; }
+XMPP::Message::Reactions Message::reactions() const { return d ? MessageExt(Reactions)->reactions : Reactions {}; }
 
-void Message::setRetraction(const QString &retractedMessageId) { MessageD()->retraction = retractedMessageId; }
+void Message::setRetraction(const QString &retractedMessageId)
+{
+    MessageDExt(Retraction)->retraction = retractedMessageId;
+}
 
-QString Message::retraction() const { return d ? d->retraction : QString {}; }
+QString Message::retraction() const { return d ? MessageExt(Retraction)->retraction : QString {}; }
 
-QString Message::invite() const { return d ? d->invite : QString(); }
+QString Message::invite() const { return d ? MessageExt(Conference)->invite : QString(); }
 
-void Message::setInvite(const QString &s) { MessageD()->invite = s; }
+void Message::setInvite(const QString &s) { MessageDExt(Conference)->invite = s; }
 
-QString Message::nick() const { return d ? d->nick : QString(); }
+QString Message::nick() const { return d ? MessageExt(Nick)->nick : QString(); }
 
-void Message::setNick(const QString &n) { MessageD()->nick = n; }
+void Message::setNick(const QString &n) { MessageDExt(Nick)->nick = n; }
 
-void Message::setHttpAuthRequest(const HttpAuthRequest &req) { MessageD()->httpAuthRequest = req; }
+void Message::setHttpAuthRequest(const HttpAuthRequest &req) { MessageDExt(HttpAuth)->httpAuthRequest = req; }
 
-HttpAuthRequest Message::httpAuthRequest() const { return d ? d->httpAuthRequest : HttpAuthRequest(); }
+HttpAuthRequest Message::httpAuthRequest() const
+{
+    return d ? MessageExt(HttpAuth)->httpAuthRequest : HttpAuthRequest();
+}
 
-void Message::setForm(const XData &form) { MessageD()->xdata = form; }
+void Message::setForm(const XData &form) { MessageDExt(XData)->xdata = form; }
 
-XData Message::getForm() const { return d ? d->xdata : XData(); }
+XData Message::getForm() const { return d ? MessageExt(XData)->xdata : XData(); }
 
-QDomElement Message::sxe() const { return d ? d->sxe : QDomElement(); }
+QDomElement Message::sxe() const { return d ? MessageExt(Sxe)->sxe : QDomElement(); }
 
-void Message::setSxe(const QDomElement &e) { MessageD()->sxe = e; }
+void Message::setSxe(const QDomElement &e) { MessageDExt(Sxe)->sxe = e; }
 
-void Message::addBoBData(const BoBData &bob) { MessageD()->bobDataList.append(bob); }
+void Message::addBoBData(const BoBData &bob) { MessageDExt(BoB)->bobDataList.append(bob); }
 
-QList<BoBData> Message::bobDataList() const { return d ? d->bobDataList : QList<BoBData>(); }
+QList<BoBData> Message::bobDataList() const { return d ? MessageExt(BoB)->bobDataList : QList<BoBData>(); }
 
-IBBData Message::ibbData() const { return d ? d->ibbData : IBBData(); }
+IBBData Message::ibbData() const { return d ? MessageExt(IBB)->ibbData : IBBData(); }
 
 //! \brief Returns Jid of the remote contact
 //!
@@ -1269,9 +1334,9 @@ bool Message::wasEncrypted() const { return d && d->wasEncrypted; }
 
 void Message::setWasEncrypted(bool b) { MessageD()->wasEncrypted = b; }
 
-QString Message::replaceId() const { return d ? d->replaceId : QString(); }
+QString Message::replaceId() const { return d ? MessageExt(Correction)->replaceId : QString(); }
 
-void Message::setReplaceId(const QString &id) { MessageD()->replaceId = id; }
+void Message::setReplaceId(const QString &id) { MessageDExt(Correction)->replaceId = id; }
 
 void Message::setProcessingHints(const ProcessingHints &hints) { MessageD()->processingHints = hints; }
 
@@ -1282,6 +1347,7 @@ Stanza Message::toStanza(Stream *stream) const
     if (!d) {
         return Stanza();
     }
+    d->decoded(Private::ExtAll);
 
     Stanza s = stream->createStanza(Stanza::Message, d->to, typeStr());
     if (!d->from.isEmpty())
@@ -1655,19 +1721,15 @@ bool Message::fromStanza(const Stanza &s, bool useTimeZoneOffset, int timeZoneOf
         setType(Type::Normal); // everything unknown is normal by rfc6121
     }
 
-    d->subject.clear();
-    d->body.clear();
-    d->htmlElements.clear();
-    d->thread = QString();
-
     QDomElement root = s.element();
 
-    XDomNodeList nl = root.childNodes();
-    int          n;
     bool         hasBodyOrThread = false;
     bool         hasSubject      = false;
+    QDomElement  delay, legacyDelay;
+    const auto  &baseNS = s.baseNS();
     for (QDomElement e = root.firstChildElement(); !e.isNull(); e = e.nextSiblingElement()) {
-        if (e.namespaceURI() == s.baseNS()) {
+        const QString ns = e.namespaceURI();
+        if (ns == baseNS) {
             if (e.tagName() == QLatin1String("subject")) {
                 hasSubject   = true;
                 QString lang = e.attributeNS(NS_XML, "lang", "");
@@ -1684,8 +1746,136 @@ bool Message::fromStanza(const Stanza &s, bool useTimeZoneOffset, int timeZoneOf
                 hasBodyOrThread = true;
                 d->thread       = e.text();
             }
-        } else if (e.tagName() == QLatin1String("event")
-                   && e.namespaceURI() == QLatin1String("http://jabber.org/protocol/pubsub#event")) {
+        } else if (ns == QLatin1String("urn:xmpp:hints")) {
+            if (e.tagName() == QLatin1String("no-permanent-store"))
+                d->processingHints |= NoPermanentStore;
+            else if (e.tagName() == QLatin1String("no-store"))
+                d->processingHints |= NoStore;
+            else if (e.tagName() == QLatin1String("no-copy"))
+                d->processingHints |= NoCopy;
+            else if (e.tagName() == QLatin1String("store"))
+                d->processingHints |= Store;
+        } else if (ns == QLatin1String("urn:xmpp:sid:0")) {
+            if (e.tagName() == QLatin1String("origin-id")) {
+                d->originId = e.attribute(QStringLiteral("id"));
+            } else if (e.tagName() == QLatin1String("stanza-id")) {
+                d->stanzaId.id = e.attribute(QStringLiteral("id"));
+                d->stanzaId.by = Jid(e.attribute(QStringLiteral("by")));
+            }
+        } else if (ns == QLatin1String("urn:xmpp:delay")) {
+            if (delay.isNull() && e.localName() == QLatin1String("delay"))
+                delay = e;
+        } else if (ns == QLatin1String("jabber:x:delay")) {
+            if (legacyDelay.isNull() && e.localName() == QLatin1String("x"))
+                legacyDelay = e;
+        } else if (auto ext = Private::extOf(ns)) {
+            d->extElements.append({ ext, e });
+            d->pending |= ext;
+        }
+    }
+
+    d->pureSubject = hasSubject && !hasBodyOrThread; // this is somewhat important for muc
+
+    if (s.type() == "error")
+        d->error = s.error();
+
+    // timestamp
+    QDateTime stamp;
+    if (!delay.isNull()) {
+        stamp = QDateTime::fromString(delay.attribute("stamp").left(19), Qt::ISODate);
+    } else if (!legacyDelay.isNull()) {
+        stamp = stamp2TS(legacyDelay.attribute("stamp"));
+    }
+    if (!stamp.isNull()) {
+        if (useTimeZoneOffset) {
+            d->timeStamp = stamp.addSecs(timeZoneOffset * 3600);
+        } else {
+#if QT_VERSION < QT_VERSION_CHECK(6, 9, 0)
+            stamp.setTimeSpec(Qt::UTC);
+#else
+            stamp.setTimeZone(QTimeZone::UTC);
+#endif
+            d->timeStamp = stamp.toLocalTime();
+        }
+        d->timeStampSend = true;
+        d->spooled       = true;
+    } else {
+        d->timeStamp     = QDateTime::currentDateTime();
+        d->timeStampSend = false;
+        d->spooled       = false;
+    }
+
+    return true;
+}
+
+Message::Private::Ext Message::Private::extOf(const QString &ns)
+{
+    static const QHash<QString, Ext> exts {
+        { QStringLiteral("http://jabber.org/protocol/pubsub#event"), ExtPubSubEvent },
+        { QStringLiteral("urn:xmpp:bob"), ExtBoB },
+        { QStringLiteral("http://jabber.org/protocol/xhtml-im"), ExtXHtml },
+        { QStringLiteral("jabber:x:oob"), ExtOob },
+        { QStringLiteral("jabber:x:event"), ExtEvent },
+        { QStringLiteral("http://jabber.org/protocol/chatstates"), ExtChatState },
+        { QStringLiteral("urn:xmpp:receipts"), ExtReceipts },
+        { QStringLiteral("jabber:x:signed"), ExtSigned },
+        { QStringLiteral("jabber:x:encrypted"), ExtEncrypted },
+        { QStringLiteral("http://jabber.org/protocol/address"), ExtAddresses },
+        { QStringLiteral("http://jabber.org/protocol/rosterx"), ExtRosterX },
+        { QStringLiteral("jabber:x:conference"), ExtConference },
+        { QStringLiteral("http://jabber.org/protocol/nick"), ExtNick },
+        { QStringLiteral("http://jabber.org/protocol/sxe"), ExtSxe },
+        { QStringLiteral("http://jabber.org/protocol/muc#user"), ExtMUCUser },
+        { QStringLiteral("http://jabber.org/protocol/http-auth"), ExtHttpAuth },
+        { QStringLiteral("urn:xmpp:captcha"), ExtXData },
+        { QStringLiteral("jabber:x:data"), ExtXData },
+        { QString::fromLatin1(IBBManager::ns()), ExtIBB },
+        { QStringLiteral("urn:xmpp:message-correct:0"), ExtCorrection },
+        { REFERENCE_NS, ExtReference },
+        { StatelessFileSharing::NS, ExtFileSharing },
+        { StatelessFileSharing::MESSAGE_ATTACHING_NS, ExtAttachTo },
+        { Jingle::JINGLEPUB_NS, ExtJinglePub },
+        { QStringLiteral("urn:xmpp:reactions:0"), ExtReactions },
+        { QStringLiteral("urn:xmpp:message-retract:1"), ExtRetraction }
+    };
+    return exts.value(ns, Ext(0));
+}
+
+void Message::Private::decode(quint32 exts)
+{
+    pending &= ~exts;
+    for (quint32 ext = 1; ext & ExtAll; ext <<= 1) {
+        if (!(exts & ext))
+            continue;
+        QList<QDomElement> elements;
+        for (auto it = extElements.begin(); it != extElements.end();) {
+            if (it->first == ext) {
+                elements.append(it->second);
+                it = extElements.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        decode(Ext(ext), elements);
+    }
+}
+
+static QDomElement firstByName(const QList<QDomElement> &elements, const QString &localName)
+{
+    for (const auto &e : elements)
+        if (e.localName() == localName)
+            return e;
+    return QDomElement();
+}
+
+void Message::Private::decode(Ext ext, const QList<QDomElement> &elements)
+{
+    QDomElement t;
+    switch (ext) {
+    case ExtPubSubEvent:
+        for (const auto &e : elements) {
+            if (e.tagName() != QLatin1String("event"))
+                continue;
             constexpr auto pubSubEventNs = "http://jabber.org/protocol/pubsub#event";
             for (auto eventElement = e.firstChildElement(); !eventElement.isNull();
                  eventElement      = eventElement.nextSiblingElement()) {
@@ -1727,325 +1917,265 @@ bool Message::fromStanza(const Stanza &s, bool useTimeZoneOffset, int timeZoneOf
                     }
                 }
 
-                d->pubSubEvents += PubSubEvent(eventType, eventElement.attribute(QStringLiteral("node")), items,
-                                               retractions, eventElement);
+                pubSubEvents += PubSubEvent(eventType, eventElement.attribute(QStringLiteral("node")), items,
+                                            retractions, eventElement);
             }
-        } else if (e.tagName() == QLatin1String("no-permanent-store")
-                   && e.namespaceURI() == QLatin1String("urn:xmpp:hints")) {
-            d->processingHints |= NoPermanentStore;
-        } else if (e.tagName() == QLatin1String("no-store") && e.namespaceURI() == QLatin1String("urn:xmpp:hints")) {
-            d->processingHints |= NoStore;
-        } else if (e.tagName() == QLatin1String("no-copy") && e.namespaceURI() == QLatin1String("urn:xmpp:hints")) {
-            d->processingHints |= NoCopy;
-        } else if (e.tagName() == QLatin1String("store") && e.namespaceURI() == QLatin1String("urn:xmpp:hints")) {
-            d->processingHints |= Store;
-        } else if (e.tagName() == QLatin1String("origin-id") && e.namespaceURI() == QLatin1String("urn:xmpp:sid:0")) {
-            d->originId = e.attribute(QStringLiteral("id"));
-        } else if (e.tagName() == QLatin1String("stanza-id") && e.namespaceURI() == QLatin1String("urn:xmpp:sid:0")) {
-            d->stanzaId.id = e.attribute(QStringLiteral("id"));
-            d->stanzaId.by = Jid(e.attribute(QStringLiteral("by")));
-        }
-
-        else {
-            // printf("extension element: [%s]\n", e.tagName().latin1());
         }
-    }
-
-    d->pureSubject = hasSubject && !hasBodyOrThread; // this is somewhat important for muc
-
-    if (s.type() == "error")
-        d->error = s.error();
+        break;
 
     // Bits of Binary XEP-0231
-    nl = childElementsByTagNameNS(root, "urn:xmpp:bob", "data");
-    for (n = 0; n < nl.count(); ++n) {
-        addBoBData(BoBData(nl.item(n).toElement()));
-    }
+    case ExtBoB:
+        for (const auto &e : elements)
+            if (e.localName() == QLatin1String("data"))
+                bobDataList.append(BoBData(e));
+        break;
 
     // xhtml-im
-    nl = childElementsByTagNameNS(root, "http://jabber.org/protocol/xhtml-im", "html");
-    if (nl.count()) {
-        nl = nl.item(0).childNodes();
-        for (n = 0; n < nl.count(); ++n) {
-            QDomElement e = nl.item(n).toElement();
+    case ExtXHtml:
+        t = firstByName(elements, QStringLiteral("html"));
+        for (QDomElement e = t.firstChildElement(); !e.isNull(); e = e.nextSiblingElement()) {
             if (e.tagName() == "body" && e.namespaceURI() == "http://www.w3.org/1999/xhtml") {
                 QString lang = e.attributeNS(NS_XML, "lang", "");
                 if (lang.isEmpty() || !(lang = XMLHelper::sanitizedLang(lang)).isEmpty()) {
-                    d->htmlElements[lang] = e;
-                    d->htmlElements[lang].filterOutUnwanted(false); // just clear iframes and javascript event handlers
+                    htmlElements[lang] = e;
+                    htmlElements[lang].filterOutUnwanted(false); // just clear iframes and javascript event handlers
                 }
             }
         }
-    }
-
-    // timestamp
-    QDomElement t = childElementsByTagNameNS(root, "urn:xmpp:delay", "delay").item(0).toElement();
-    QDateTime   stamp;
-    if (!t.isNull()) {
-        stamp = QDateTime::fromString(t.attribute("stamp").left(19), Qt::ISODate);
-    } else {
-        t = childElementsByTagNameNS(root, "jabber:x:delay", "x").item(0).toElement();
-        if (!t.isNull()) {
-            stamp = stamp2TS(t.attribute("stamp"));
-        }
-    }
-    if (!stamp.isNull()) {
-        if (useTimeZoneOffset) {
-            d->timeStamp = stamp.addSecs(timeZoneOffset * 3600);
-        } else {
-#if QT_VERSION < QT_VERSION_CHECK(6, 9, 0)
-            stamp.setTimeSpec(Qt::UTC);
-#else
-            stamp.setTimeZone(QTimeZone::UTC);
-#endif
-            d->timeStamp = stamp.toLocalTime();
-        }
-        d->timeStampSend = true;
-        d->spooled       = true;
-    } else {
-        d->timeStamp     = QDateTime::currentDateTime();
-        d->timeStampSend = false;
-        d->spooled       = false;
-    }
+        break;
 
     // urls
-    d->urlList.clear();
-    nl = childElementsByTagNameNS(root, "jabber:x:oob", "x");
-    for (n = 0; n < nl.count(); ++n) {
-        QDomElement t = nl.item(n).toElement();
-        Url         u;
-        u.setUrl(t.elementsByTagName("url").item(0).toElement().text());
-        u.setDesc(t.elementsByTagName("desc").item(0).toElement().text());
-        d->urlList += u;
-    }
+    case ExtOob:
+        for (const auto &e : elements) {
+            if (e.localName() != QLatin1String("x"))
+                continue;
+            Url u;
+            u.setUrl(e.elementsByTagName("url").item(0).toElement().text());
+            u.setDesc(e.elementsByTagName("desc").item(0).toElement().text());
+            urlList += u;
+        }
+        break;
 
     // events
-    d->eventList.clear();
-    nl = childElementsByTagNameNS(root, "jabber:x:event", "x");
-    if (nl.count()) {
-        nl = nl.item(0).childNodes();
-        for (n = 0; n < nl.count(); ++n) {
-            QString evtag = nl.item(n).toElement().tagName();
+    case ExtEvent:
+        t = firstByName(elements, QStringLiteral("x"));
+        if (t.isNull())
+            break;
+        for (QDomElement e = t.firstChildElement(); !e.isNull(); e = e.nextSiblingElement()) {
+            QString evtag = e.tagName();
             if (evtag == "id") {
-                d->eventId = nl.item(n).toElement().text();
+                eventId = e.text();
             } else if (evtag == "displayed")
-                d->eventList += DisplayedEvent;
+                eventList += DisplayedEvent;
             else if (evtag == "composing")
-                d->eventList += ComposingEvent;
+                eventList += ComposingEvent;
             else if (evtag == "delivered")
-                d->eventList += DeliveredEvent;
+                eventList += DeliveredEvent;
         }
-        if (d->eventList.isEmpty())
-            d->eventList += CancelEvent;
-    }
+        if (eventList.isEmpty())
+            eventList += CancelEvent;
+        break;
 
-    // Chat states
-    QString chatStateNS = "http://jabber.org/protocol/chatstates";
-    t                   = childElementsByTagNameNS(root, chatStateNS, "active").item(0).toElement();
-    if (!t.isNull())
-        d->chatState = StateActive;
-    t = childElementsByTagNameNS(root, chatStateNS, "composing").item(0).toElement();
-    if (!t.isNull())
-        d->chatState = StateComposing;
-    t = childElementsByTagNameNS(root, chatStateNS, "paused").item(0).toElement();
-    if (!t.isNull())
-        d->chatState = StatePaused;
-    t = childElementsByTagNameNS(root, chatStateNS, "inactive").item(0).toElement();
-    if (!t.isNull())
-        d->chatState = StateInactive;
-    t = childElementsByTagNameNS(root, chatStateNS, "gone").item(0).toElement();
-    if (!t.isNull())
-        d->chatState = StateGone;
+    // Chat states. the last one in this order wins
+    case ExtChatState: {
+        static const QPair<QString, ChatState> states[]
+            = { { QStringLiteral("active"), StateActive },     { QStringLiteral("composing"), StateComposing },
+                { QStringLiteral("paused"), StatePaused },     { QStringLiteral("inactive"), StateInactive },
+                { QStringLiteral("gone"), StateGone } };
+        for (const auto &state : states)
+            if (!firstByName(elements, state.first).isNull())
+                chatState = state.second;
+        break;
+    }
 
     // message receipts
-    QString messageReceiptNS = "urn:xmpp:receipts";
-    t                        = childElementsByTagNameNS(root, messageReceiptNS, "request").item(0).toElement();
-    if (!t.isNull()) {
-        d->messageReceipt = ReceiptRequest;
-        d->messageReceiptId.clear();
-    }
-    t = childElementsByTagNameNS(root, messageReceiptNS, "received").item(0).toElement();
-    if (!t.isNull()) {
-        d->messageReceipt   = ReceiptReceived;
-        d->messageReceiptId = t.attribute("id");
-        if (d->messageReceiptId.isEmpty())
-            d->messageReceiptId = id();
-    }
+    case ExtReceipts:
+        if (!firstByName(elements, QStringLiteral("request")).isNull()) {
+            messageReceipt = ReceiptRequest;
+            messageReceiptId.clear();
+        }
+        t = firstByName(elements, QStringLiteral("received"));
+        if (!t.isNull()) {
+            messageReceipt   = ReceiptReceived;
+            messageReceiptId = t.attribute("id");
+            if (messageReceiptId.isEmpty())
+                messageReceiptId = id;
+        }
+        break;
 
-    // xsigned
-    t = childElementsByTagNameNS(root, "jabber:x:signed", "x").item(0).toElement();
-    if (!t.isNull())
-        d->xsigned = t.text();
-    else
-        d->xsigned = QString();
+    case ExtSigned:
+        t = firstByName(elements, QStringLiteral("x"));
+        if (!t.isNull())
+            xsigned = t.text();
+        break;
 
-    // xencrypted
-    t = childElementsByTagNameNS(root, "jabber:x:encrypted", "x").item(0).toElement();
-    if (!t.isNull())
-        d->xencrypted = t.text();
-    else
-        d->xencrypted = QString();
+    case ExtEncrypted:
+        t = firstByName(elements, QStringLiteral("x"));
+        if (!t.isNull())
+            xencrypted = t.text();
+        break;
 
-    // addresses
-    d->addressList.clear();
-    nl = childElementsByTagNameNS(root, "http://jabber.org/protocol/address", "addresses");
-    if (nl.count()) {
-        QDomElement t = nl.item(0).toElement();
-        nl            = t.elementsByTagName("address");
-        for (n = 0; n < nl.count(); ++n) {
-            d->addressList += Address(nl.item(n).toElement());
-        }
+    case ExtAddresses: {
+        t               = firstByName(elements, QStringLiteral("addresses"));
+        XDomNodeList nl = t.elementsByTagName("address");
+        for (int n = 0; n < nl.count(); ++n)
+            addressList += Address(nl.item(n).toElement());
+        break;
     }
 
     // roster item exchange
-    d->rosterExchangeItems.clear();
-    nl = childElementsByTagNameNS(root, "http://jabber.org/protocol/rosterx", "x");
-    if (nl.count()) {
-        QDomElement t = nl.item(0).toElement();
-        nl            = t.elementsByTagName("item");
-        for (n = 0; n < nl.count(); ++n) {
+    case ExtRosterX: {
+        t               = firstByName(elements, QStringLiteral("x"));
+        XDomNodeList nl = t.elementsByTagName("item");
+        for (int n = 0; n < nl.count(); ++n) {
             RosterExchangeItem it = RosterExchangeItem(nl.item(n).toElement());
             if (!it.isNull())
-                d->rosterExchangeItems += it;
+                rosterExchangeItems += it;
         }
+        break;
     }
 
-    // invite
-    t = childElementsByTagNameNS(root, "jabber:x:conference", "x").item(0).toElement();
-    if (!t.isNull())
-        d->invite = t.attribute("jid");
-    else
-        d->invite = QString();
+    case ExtConference:
+        t = firstByName(elements, QStringLiteral("x"));
+        if (!t.isNull())
+            invite = t.attribute("jid");
+        break;
 
-    // nick
-    t = childElementsByTagNameNS(root, "http://jabber.org/protocol/nick", "nick").item(0).toElement();
-    if (!t.isNull())
-        d->nick = t.text();
-    else
-        d->nick = QString();
+    case ExtNick:
+        t = firstByName(elements, QStringLiteral("nick"));
+        if (!t.isNull())
+            nick = t.text();
+        break;
 
-    // sxe
-    t = childElementsByTagNameNS(root, "http://jabber.org/protocol/sxe", "sxe").item(0).toElement();
-    if (!t.isNull())
-        d->sxe = t;
-    else
-        d->sxe = QDomElement();
-
-    t = childElementsByTagNameNS(root, "http://jabber.org/protocol/muc#user", "x").item(0).toElement();
-    if (!t.isNull()) {
-        d->hasMUCUser = true;
-        for (QDomNode muc_n = t.firstChild(); !muc_n.isNull(); muc_n = muc_n.nextSibling()) {
-            QDomElement muc_e = muc_n.toElement();
-            if (muc_e.isNull())
-                continue;
+    case ExtSxe:
+        sxe = firstByName(elements, QStringLiteral("sxe"));
+        break;
+
+    case ExtMUCUser:
+        t = firstByName(elements, QStringLiteral("x"));
+        if (t.isNull())
+            break;
+        hasMUCUser = true;
+        for (QDomElement muc_e = t.firstChildElement(); !muc_e.isNull(); muc_e = muc_e.nextSiblingElement()) {
             if (muc_e.tagName() == "status") {
-                addMUCStatus(muc_e.attribute("code").toInt());
+                mucStatuses += muc_e.attribute("code").toInt();
             } else if (muc_e.tagName() == "invite") {
                 MUCInvite inv(muc_e);
                 if (!inv.isNull())
-                    addMUCInvite(inv);
+                    mucInvites += inv;
             } else if (muc_e.tagName() == "decline") {
-                setMUCDecline(MUCDecline(muc_e));
+                mucDecline = MUCDecline(muc_e);
             } else if (muc_e.tagName() == "password") {
-                setMUCPassword(muc_e.text());
+                mucPassword = muc_e.text();
             }
         }
-    }
+        break;
 
-    // http auth
-    t = childElementsByTagNameNS(root, "http://jabber.org/protocol/http-auth", "confirm").item(0).toElement();
-    if (!t.isNull()) {
-        d->httpAuthRequest = HttpAuthRequest(t);
-    } else {
-        d->httpAuthRequest = HttpAuthRequest();
-    }
+    case ExtHttpAuth:
+        t = firstByName(elements, QStringLiteral("confirm"));
+        if (!t.isNull())
+            httpAuthRequest = HttpAuthRequest(t);
+        break;
 
-    QDomElement captcha   = childElementsByTagNameNS(root, "urn:xmpp:captcha", "captcha").item(0).toElement();
-    QDomElement xdataRoot = root;
-    if (!captcha.isNull()) {
-        xdataRoot = captcha;
+    // data form. a captcha form replaces a plain one
+    case ExtXData: {
+        QDomElement captcha = firstByName(elements, QStringLiteral("captcha"));
+        if (!captcha.isNull()) {
+            t = childElementsByTagNameNS(captcha, "jabber:x:data", "x").item(0).toElement();
+        } else {
+            for (const auto &e : elements)
+                if (e.namespaceURI() == QLatin1String("jabber:x:data") && e.localName() == QLatin1String("x")) {
+                    t = e;
+                    break;
+                }
+        }
+        if (!t.isNull())
+            xdata.fromXml(t);
+        break;
     }
 
-    // data form
-    t = childElementsByTagNameNS(xdataRoot, "jabber:x:data", "x").item(0).toElement();
-    if (!t.isNull()) {
-        d->xdata.fromXml(t);
-    }
+    case ExtIBB:
+        t = firstByName(elements, QStringLiteral("data"));
+        if (!t.isNull())
+            ibbData.fromXml(t);
+        break;
 
-    t = childElementsByTagNameNS(root, IBBManager::ns(), "data").item(0).toElement();
-    if (!t.isNull()) {
-        d->ibbData.fromXml(t);
-    }
-    t = childElementsByTagNameNS(root, "urn:xmpp:message-correct:0", "replace").item(0).toElement();
-    if (!t.isNull()) {
-        d->replaceId = t.attribute("id");
-    }
+    case ExtCorrection:
+        t = firstByName(elements, QStringLiteral("replace"));
+        if (!t.isNull())
+            replaceId = t.attribute("id");
+        break;
 
     // XEP-0385 SIMS and XEP-0372 Reference
-    auto references = childElementsByTagNameNS(root, REFERENCE_NS, QString::fromLatin1("reference"));
-    for (int i = 0; i < references.size(); i++) {
-        Reference r;
-        if (r.fromXml(references.at(i).toElement())) {
-            d->references.append(r);
+    case ExtReference:
+        for (const auto &e : elements) {
+            Reference r;
+            if (e.localName() == QLatin1String("reference") && r.fromXml(e))
+                references.append(r);
         }
-    }
+        break;
 
-    // XEP-0447 Stateless File Sharing
-    auto fileSharings = childElementsByTagNameNS(root, StatelessFileSharing::NS, QStringLiteral("file-sharing"));
-    for (int i = 0; i < fileSharings.size(); ++i) {
-        StatelessFileSharing::FileSharing sharing(fileSharings.at(i).toElement());
-        if (sharing.isValid())
-            d->fileSharings.append(sharing);
-    }
-
-    // XEP-0367 Message Attaching and XEP-0447 source attachments
-    auto attach
-        = childElementsByTagNameNS(root, StatelessFileSharing::MESSAGE_ATTACHING_NS, QStringLiteral("attach-to"))
-              .item(0)
-              .toElement();
-    if (!attach.isNull())
-        d->attachToId = attach.attribute(QStringLiteral("id"));
-    auto attachedSources = childElementsByTagNameNS(root, StatelessFileSharing::NS, QStringLiteral("sources"));
-    for (int i = 0; i < attachedSources.size(); ++i) {
-        StatelessFileSharing::Sources sources(attachedSources.at(i).toElement());
-        if (sources.isValid())
-            d->attachedFileSources.append(sources);
-    }
+    // XEP-0447 Stateless File Sharing and its sources attached to another message
+    case ExtFileSharing:
+        for (const auto &e : elements) {
+            if (e.localName() == QLatin1String("file-sharing")) {
+                StatelessFileSharing::FileSharing sharing(e);
+                if (sharing.isValid())
+                    fileSharings.append(sharing);
+            } else if (e.localName() == QLatin1String("sources")) {
+                StatelessFileSharing::Sources sources(e);
+                if (sources.isValid())
+                    attachedFileSources.append(sources);
+            }
+        }
+        break;
+
+    // XEP-0367 Message Attaching
+    case ExtAttachTo:
+        t = firstByName(elements, QStringLiteral("attach-to"));
+        if (!t.isNull())
+            attachToId = t.attribute(QStringLiteral("id"));
+        break;
 
     // XEP-0358 direct publication. If an old sender omitted the required from
     // attribute, use the stanza sender as the session owner.
-    auto publications = childElementsByTagNameNS(root, Jingle::JINGLEPUB_NS, QStringLiteral("jinglepub"));
-    for (int i = 0; i < publications.size(); ++i) {
-        auto element = publications.at(i).toElement();
-        if (!element.hasAttribute(QStringLiteral("from")) && d->from.isValid())
-            element.setAttribute(QStringLiteral("from"), d->from.full());
-        Jingle::JinglePub publication(element);
-        if (publication.isValid())
-            d->jinglePublications.append(publication);
-    }
+    case ExtJinglePub:
+        for (auto element : elements) {
+            if (element.localName() != QLatin1String("jinglepub"))
+                continue;
+            if (!element.hasAttribute(QStringLiteral("from")) && from.isValid())
+                element.setAttribute(QStringLiteral("from"), from.full());
+            Jingle::JinglePub publication(element);
+            if (publication.isValid())
+                jinglePublications.append(publication);
+        }
+        break;
 
     // XEP-0444 message reactions
-    auto reactions
-        = childElementsByTagNameNS(root, "urn:xmpp:reactions:0", QStringLiteral("reactions")).item(0).toElement();
-    if (!reactions.isNull()) {
-        d->reactions.targetId = reactions.attribute(QLatin1String("id"));
-        if (!d->reactions.targetId.isEmpty()) {
+    case ExtReactions:
+        t = firstByName(elements, QStringLiteral("reactions"));
+        if (t.isNull())
+            break;
+        reactions.targetId = t.attribute(QLatin1String("id"));
+        if (!reactions.targetId.isEmpty()) {
             auto reactionTag = QStringLiteral("reaction");
-            auto reaction    = reactions.firstChildElement(reactionTag);
+            auto reaction    = t.firstChildElement(reactionTag);
             while (!reaction.isNull()) {
-                d->reactions.reactions.insert(reaction.text().trimmed());
+                reactions.reactions.insert(reaction.text().trimmed());
                 reaction = reaction.nextSiblingElement(reactionTag);
             }
-            d->reactions.reactions.squeeze();
+            reactions.reactions.squeeze();
         }
-    }
+        break;
 
     // XEP-0424 message retraction
-    d->retraction = childElementsByTagNameNS(root, "urn:xmpp:message-retract:1", QStringLiteral("retract"))
-                        .item(0)
-                        .toElement()
-                        .attribute(QLatin1String("id"));
-    return true;
+    case ExtRetraction:
+        retraction = firstByName(elements, QStringLiteral("retract")).attribute(QLatin1String("id"));
+        break;
+
+    default:
+        break;
+    }
 }
 
 /*!
@@ -2798,6 +2928,7 @@ bool RosterItem::fromXml(const QDomElement &item)
 class Roster::Private {
 public:
     QString groupsDelimiter;
+    QString version;
 };
 
 Roster::Roster() : QList<RosterItem>(), d(new Roster::Private) { }
@@ -2807,12 +2938,14 @@ Roster::~Roster() { delete d; }
 Roster::Roster(const Roster &other) : QList<RosterItem>(other), d(new Roster::Private)
 {
     d->groupsDelimiter = other.d->groupsDelimiter;
+    d->version         = other.d->version;
 }
 
 Roster &Roster::operator=(const Roster &other)
 {
     QList<RosterItem>::operator=(other);
     d->groupsDelimiter = other.d->groupsDelimiter;
+    d->version         = other.d->version;
     return *this;
 }
 
@@ -2840,6 +2973,10 @@ void Roster::setGroupsDelimiter(const QString &groupsDelimiter) { d->groupsDelim
 
 QString Roster::groupsDelimiter() const { return d->groupsDelimiter; }
 
+void Roster::setVersion(const QString &version) { d->version = version; }
+
+QString Roster::version() const { return d->version; }
+
 //---------------------------------------------------------------------------
 // FormField
 //---------------------------------------------------------------------------
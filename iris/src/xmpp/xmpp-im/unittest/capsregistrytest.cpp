@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "qttestutil/qttestutil.h"
+#include "xmpp/xmpp-im/xmpp_caps.h"
+#include "xmpp/xmpp-im/xmpp_discoitem.h"
+
+#include <QDataStream>
+#include <QDomDocument>
+#include <QObject>
+#include <QtTest/QtTest>
+
+using namespace XMPP;
+
+static const QString NODE = QStringLiteral("https://psi-im.org");
+
+// keeps the journal in memory instead of caps.dat
+class TestRegistry : public CapsRegistry {
+public:
+    TestRegistry(QByteArray *storage) : storage(storage) { }
+
+    QByteArray *storage;
+    int         loads   = 0;
+    int         saves   = 0;
+    int         appends = 0;
+
+protected:
+    void saveData(const QByteArray &data) override
+    {
+        saves++;
+        *storage = data;
+    }
+
+    void appendData(const QByteArray &data) override
+    {
+        appends++;
+        *storage += data;
+    }
+
+    QByteArray loadData() override
+    {
+        loads++;
+        return *storage;
+    }
+};
+
+class CapsRegistryTest : public QObject {
+    Q_OBJECT
+
+    static CapsSpec spec(const QString &ver) { return CapsSpec(NODE, QCryptographicHash::Sha1, ver); }
+    static QString  node(const QString &ver) { return NODE + QLatin1Char('#') + ver; }
+
+    static DiscoItem clientInfo(const QStringList &features)
+    {
+        DiscoItem item;
+        item.setIdentities(DiscoItem::Identity("client", "pc", QString(), "Psi"));
+        item.setFeatures(Features(features));
+        return item;
+    }
+
+    static QStringList sorted(QStringList list)
+    {
+        list.sort();
+        return list;
+    }
+
+    // a journal written record by record, the way a few Psi instances could leave it
+    static void writeRecord(QDataStream &out, const QString &node, const QDateTime &lastSeen, const DiscoItem &item)
+    {
+        QDomDocument doc;
+        doc.appendChild(item.toDiscoInfoResult(&doc));
+        const QByteArray xml = doc.toByteArray(-1);
+        out << node << qint64(lastSeen.toMSecsSinceEpoch());
+        out.writeBytes(xml.constData(), uint(xml.size()));
+    }
+
+    static void writeHeader(QDataStream &out)
+    {
+        out.setVersion(QDataStream::Qt_5_9);
+        out << quint32(0x43415053) << quint32(1); // "CAPS", version
+    }
+
+private slots:
+    void testAppend()
+    {
+        QByteArray   storage;
+        TestRegistry registry(&storage);
+
+        // not loaded yet. it's done now, and an empty journal is started
+        registry.registerCaps(spec("v1"), clientInfo({ "urn:xmpp:ping", "jabber:iq:version" }));
+        QCOMPARE(registry.loads, 1);
+        QCOMPARE(registry.saves, 1);
+        QCOMPARE(registry.appends, 1);
+
+        // then one record per new node, nothing is rewritten
+        const auto size = storage.size();
+        registry.registerCaps(spec("v2"), clientInfo({ "urn:xmpp:ping", "urn:xmpp:time" }));
+        QCOMPARE(registry.loads, 1);
+        QCOMPARE(registry.saves, 1);
+        QCOMPARE(registry.appends, 2);
+        QVERIFY(storage.size() > size);
+
+        // a known node isn't written again
+        registry.registerCaps(spec("v2"), clientInfo({ "urn:xmpp:ping", "urn:xmpp:time" }));
+        QCOMPARE(registry.appends, 2);
+    }
+
+    void testReplay()
+    {
+        QByteArray storage;
+        {
+            TestRegistry registry(&storage);
+            registry.load();
+            registry.registerCaps(spec("v1"), clientInfo({ "urn:xmpp:ping", "jabber:iq:version" }));
+            registry.registerCaps(spec("v2"), clientInfo({ "urn:xmpp:ping", "urn:xmpp:time" }));
+        }
+
+        TestRegistry registry(&storage);
+        registry.load();
+        QCOMPARE(registry.saves, 0);
+        QVERIFY(registry.isRegistered(node("v1")));
+        QVERIFY(registry.isRegistered(node("v2")));
+        QVERIFY(!registry.isRegistered(node("v3")));
+        QCOMPARE(sorted(registry.disco(node("v1")).features().list()),
+                 QStringList({ "jabber:iq:version", "urn:xmpp:ping" }));
+        QCOMPARE(sorted(registry.disco(node("v2")).features().list()),
+                 QStringList({ "urn:xmpp:ping", "urn:xmpp:time" }));
+        QCOMPARE(registry.disco(node("v2")).identities().value(0).name, QStringLiteral("Psi"));
+    }
+
+    void testLazyLoadKeepsJournal()
+    {
+        QByteArray storage;
+        {
+            TestRegistry registry(&storage);
+            registry.load();
+            registry.registerCaps(spec("v1"), clientInfo({ "urn:xmpp:ping" }));
+        }
+
+        // registered before anybody called load()
+        {
+            TestRegistry registry(&storage);
+            registry.registerCaps(spec("v1"), clientInfo({ "urn:xmpp:ping" }));
+            QCOMPARE(registry.appends, 0); // it was in the journal
+            registry.registerCaps(spec("v2"), clientInfo({ "urn:xmpp:time" }));
+            QCOMPARE(registry.loads, 1);
+            QCOMPARE(registry.saves, 0);
+            QCOMPARE(registry.appends, 1);
+        }
+
+        TestRegistry registry(&storage);
+        registry.load();
+        QVERIFY(registry.isRegistered(node("v1")));
+        QVERIFY(registry.isRegistered(node("v2")));
+    }
+
+    void testCompaction()
+    {
+        const auto  now  = QDateTime::currentDateTime();
+        const auto  info = clientInfo({ "urn:xmpp:ping" });
+        QByteArray  storage;
+        QDataStream out(&storage, QIODevice::WriteOnly);
+        writeHeader(out);
+        writeRecord(out, node("old"), now.addMonths(-4), info); // expired
+        for (int i = 0; i < 100; i++)
+            writeRecord(out, node("v1"), now.addSecs(i - 100), info); // overridden by the next one
+        const auto size = storage.size();
+
+        TestRegistry registry(&storage);
+        registry.load();
+        QCOMPARE(registry.saves, 1);
+        QVERIFY(storage.size() * 50 < size);
+        QVERIFY(registry.isRegistered(node("v1")));
+        QVERIFY(!registry.isRegistered(node("old")));
+
+        TestRegistry reloaded(&storage);
+        reloaded.load();
+        QCOMPARE(reloaded.saves, 0);
+        QCOMPARE(reloaded.disco(node("v1")).features().list(), QStringList({ "urn:xmpp:ping" }));
+    }
+
+    void testTruncatedJournal()
+    {
+        QByteArray  storage;
+        QDataStream out(&storage, QIODevice::WriteOnly);
+        writeHeader(out);
+        writeRecord(out, node("v1"), QDateTime::currentDateTime(), clientInfo({ "urn:xmpp:ping" }));
+        writeRecord(out, node("v2"), QDateTime::currentDateTime(), clientInfo({ "urn:xmpp:time" }));
+        storage.chop(3); // killed while appending
+
+        TestRegistry registry(&storage);
+        registry.load();
+        QCOMPARE(registry.saves, 1);
+        QVERIFY(registry.isRegistered(node("v1")));
+        QVERIFY(!registry.isRegistered(node("v2")));
+
+        TestRegistry reloaded(&storage);
+        reloaded.load();
+        QCOMPARE(reloaded.saves, 0);
+        QVERIFY(reloaded.isRegistered(node("v1")));
+    }
+
+    void testFeaturesDedup()
+    {
+        QByteArray storage;
+        {
+            TestRegistry registry(&storage);
+            registry.load();
+            // versions of the same client usually have the same features
+            registry.registerCaps(spec("v1"), clientInfo({ "urn:xmpp:ping", "urn:xmpp:time" }));
+            registry.registerCaps(spec("v2"), clientInfo({ "urn:xmpp:time", "urn:xmpp:ping" }));
+            registry.registerCaps(spec("v3"), clientInfo({ "urn:xmpp:ping" }));
+            QCOMPARE(registry.featureListCount(), 2);
+        }
+
+        // the same when parsed on demand from the journal
+        TestRegistry registry(&storage);
+        registry.load();
+        QCOMPARE(registry.featureListCount(), 0);
+        for (const auto &ver : { "v1", "v2", "v3" })
+            QVERIFY(!registry.disco(node(ver)).features().isEmpty());
+        QCOMPARE(registry.featureListCount(), 2);
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(CapsRegistryTest);
+#include "capsregistrytest.moc"
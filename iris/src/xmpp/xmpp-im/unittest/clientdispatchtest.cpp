@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "qttestutil/qttestutil.h"
+#include "xmpp/xmpp-core/xmpp.h"
+#include "xmpp/xmpp-core/xmpp_clientstream.h"
+#include "xmpp/xmpp-im/xmpp_client.h"
+#include "xmpp/xmpp-im/xmpp_roster.h"
+#include "xmpp/xmpp-im/xmpp_task.h"
+#include "xmpp/xmpp-im/xmpp_tasks.h"
+#include "xmpp/xmpp-im/xmpp_xmlcommon.h"
+
+#include <QDomDocument>
+#include <QObject>
+#include <QtTest/QtTest>
+
+using namespace XMPP;
+
+static const QString DISCO_INFO_NS = QStringLiteral("http://jabber.org/protocol/disco#info");
+
+// never connects anywhere
+class NullConnector : public Connector {
+public:
+    void        setOptHostPort(const QString &, quint16) override { }
+    void        connectToServer(const QString &) override { }
+    ByteStream *stream() const override { return nullptr; }
+    void        done() override { }
+};
+
+// stanzas are fed by hand and reach the tasks the same way as from the network:
+// readyRead(), Client::distribute(), Client::dispatch()
+class TestStream : public ClientStream {
+public:
+    TestStream(Connector *conn) : ClientStream(conn) { }
+
+    bool   stanzaAvailable() const override { return !in.isEmpty(); }
+    Stanza read() override { return in.takeFirst(); }
+    void   write(const Stanza &s) override { out += s.element(); }
+
+    void receive(const QString &xml)
+    {
+        QDomDocument d;
+        d.setContent(xml, true);
+        in += createStanza(doc().importNode(d.documentElement(), true).toElement());
+        emit readyRead();
+    }
+
+    QList<Stanza>      in;
+    QList<QDomElement> out;
+};
+
+// takes disco#info of one node, like the ad-hoc commands server does
+class NodeTask : public Task {
+    Q_OBJECT
+public:
+    NodeTask(Task *parent, const QString &node, bool push) : Task(parent), node(node)
+    {
+        if (push)
+            registerPush(QStringLiteral("iq"), DISCO_INFO_NS);
+    }
+
+    bool take(const QDomElement &e) override
+    {
+        auto q = e.firstChildElement("query");
+        if (q.namespaceURI() != DISCO_INFO_NS || q.attribute("node") != node)
+            return false;
+        taken++;
+        return true;
+    }
+
+    QString node;
+    int     taken = 0;
+};
+
+// asks the server and waits for the result, like most of the client tasks
+class QueryTask : public Task {
+    Q_OBJECT
+public:
+    QueryTask(Task *parent) : Task(parent) { }
+
+    void onGo() override
+    {
+        QDomElement iq = createIQ(doc(), "get", "", id());
+        iq.appendChild(doc()->createElementNS(QStringLiteral("urn:test"), QStringLiteral("query")));
+        send(iq);
+    }
+
+    bool take(const QDomElement &e) override
+    {
+        if (!iqVerify(e, Jid(), id()))
+            return false;
+        taken++;
+        setSuccess();
+        return true;
+    }
+
+    int taken = 0;
+};
+
+// drops stanzas of one namespace, like a plugin behind PluginManager's stream watcher
+class FilterTask : public Task {
+    Q_OBJECT
+public:
+    FilterTask(Task *parent, const QString &ns) : Task(parent), ns(ns) { registerWatcher(); }
+
+    bool take(const QDomElement &e) override
+    {
+        seen++;
+        return e.firstChildElement().namespaceURI() == ns;
+    }
+
+    QString ns;
+    int     seen = 0;
+};
+
+class ClientDispatchTest : public QObject {
+    Q_OBJECT
+
+    static QString discoInfo(const QString &node)
+    {
+        return QString("<iq xmlns='jabber:client' type='get' id='d1' from='juliet@capulet.lit/balcony'>"
+                       "<query xmlns='%1'%2/></iq>")
+            .arg(DISCO_INFO_NS, node.isEmpty() ? QString() : QString(" node='%1'").arg(node));
+    }
+
+    static QString rosterPush()
+    {
+        return QStringLiteral("<iq xmlns='jabber:client' type='set' id='p1'><query xmlns='jabber:iq:roster'>"
+                              "<item jid='spammer@example.org' subscription='none'/></query></iq>");
+    }
+
+private slots:
+    void testEarlierTaskKeepsForeignNodes()
+    {
+        // ad-hoc commands server is created before the stream starts, disco server after it
+        NullConnector conn;
+        TestStream    stream(&conn);
+        Client        client;
+        client.connectToServer(&stream, Jid("romeo@montague.lit/orchard"));
+        auto commands = new NodeTask(client.rootTask(), "http://jabber.org/protocol/commands", false);
+        new JT_ServInfo(client.rootTask());
+
+        stream.receive(discoInfo("http://jabber.org/protocol/commands"));
+        QCOMPARE(commands->taken, 1);
+        QCOMPARE(client.dispatchStats().pushes, quint64(0));
+        QCOMPARE(client.dispatchStats().slowPath, quint64(1));
+
+        // our own info still goes the fast way
+        stream.receive(discoInfo(QString()));
+        QCOMPARE(commands->taken, 1);
+        QCOMPARE(client.dispatchStats().pushes, quint64(1));
+
+        // and an unknown node is still answered by the disco server on the slow path
+        stream.receive(discoInfo("unknown"));
+        QCOMPARE(client.dispatchStats().unhandled, quint64(0));
+    }
+
+    void testHandlersInRegistrationOrder()
+    {
+        NullConnector conn;
+        TestStream    stream(&conn);
+        Client        client;
+        client.connectToServer(&stream, Jid("romeo@montague.lit/orchard"));
+        auto first  = new NodeTask(client.rootTask(), "node", true);
+        auto second = new NodeTask(client.rootTask(), "node", true);
+
+        stream.receive(discoInfo("node"));
+        QCOMPARE(first->taken, 1);
+        QCOMPARE(second->taken, 0);
+        QCOMPARE(client.dispatchStats().pushes, quint64(1));
+
+        delete first;
+        stream.receive(discoInfo("node"));
+        QCOMPARE(second->taken, 1);
+    }
+
+    void testIqResultById()
+    {
+        NullConnector conn;
+        TestStream    stream(&conn);
+        Client        client;
+        client.connectToServer(&stream, Jid("romeo@montague.lit/orchard"));
+        auto query = new QueryTask(client.rootTask());
+        query->go();
+        QCOMPARE(stream.out.size(), 1);
+
+        // a result with another id is not for it
+        stream.receive(QStringLiteral("<iq xmlns='jabber:client' type='result' id='other'/>"));
+        QCOMPARE(query->taken, 0);
+        QCOMPARE(client.dispatchStats().unhandled, quint64(1));
+
+        stream.receive(QString("<iq xmlns='jabber:client' type='result' id='%1'/>").arg(query->id()));
+        QCOMPARE(query->taken, 1);
+        QVERIFY(query->success());
+        QCOMPARE(client.dispatchStats().iqResults, quint64(1));
+        QCOMPARE(client.dispatchStats().slowPath, quint64(1));
+    }
+
+    void testWatcherComesFirst()
+    {
+        NullConnector conn;
+        TestStream    stream(&conn);
+        Client        client;
+        client.connectToServer(&stream, Jid("romeo@montague.lit/orchard"));
+        auto pushRoster = new JT_PushRoster(client.rootTask());
+        auto query      = new QueryTask(client.rootTask());
+        int  pushes     = 0;
+        connect(pushRoster, &JT_PushRoster::roster, this, [&pushes](const Roster &) { pushes++; });
+        query->go();
+        // created last. only being a watcher puts it before the others
+        auto filter = new FilterTask(client.rootTask(), QStringLiteral("jabber:iq:roster"));
+
+        stream.receive(rosterPush());
+        QCOMPARE(filter->seen, 1);
+        QCOMPARE(pushes, 0);
+        QCOMPARE(client.dispatchStats().watched, quint64(1));
+
+        // seen but not taken. still goes to the sender by id
+        stream.receive(QString("<iq xmlns='jabber:client' type='result' id='%1'/>").arg(query->id()));
+        QCOMPARE(filter->seen, 2);
+        QCOMPARE(query->taken, 1);
+        QCOMPARE(client.dispatchStats().iqResults, quint64(1));
+
+        // the tree scan doesn't ask it again
+        stream.receive(QStringLiteral("<message xmlns='jabber:client' from='juliet@capulet.lit/balcony'>"
+                                      "<x xmlns='urn:test'/></message>"));
+        QCOMPARE(filter->seen, 3);
+        QCOMPARE(client.dispatchStats().slowPath, quint64(1));
+
+        delete filter;
+        stream.receive(rosterPush());
+        QCOMPARE(pushes, 1);
+        QCOMPARE(client.dispatchStats().pushes, quint64(1));
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(ClientDispatchTest);
+#include "clientdispatchtest.moc"
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "qttestutil/qttestutil.h"
+#include "xmpp/xmpp-im/xmpp_hashpool.h"
+
+#include <QObject>
+#include <QTemporaryFile>
+#include <QtTest/QtTest>
+
+using namespace XMPP;
+
+class HashPoolTest : public QObject {
+    Q_OBJECT
+
+    static QByteArray testData(int size)
+    {
+        QByteArray data(size, Qt::Uninitialized);
+        for (int i = 0; i < size; i++)
+            data[i] = char(i * 31 + (i >> 8));
+        return data;
+    }
+
+private slots:
+    void testStreamSeveralTypes()
+    {
+        auto data = testData(3 * 1024 * 1024 + 17);
+        auto job  = std::unique_ptr<HashJob>(HashPool::instance()->stream({ Hash::Sha1, Hash::Sha256 }));
+        for (int i = 0; i < data.size(); i += 65536)
+            job->addData(data.mid(i, 65536));
+
+        auto result = job->waitForFinished();
+        QCOMPARE(result.size(), 2);
+        QCOMPARE(result[0], Hash::from(Hash::Sha1, data));
+        QCOMPARE(result[1], Hash::from(Hash::Sha256, data));
+    }
+
+    void testFileAndSignals()
+    {
+        auto           data = testData(5 * 1024 * 1024);
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        QCOMPARE(file.write(data), qint64(data.size()));
+        file.close();
+
+        auto       job = std::unique_ptr<HashJob>(HashPool::instance()->file(file.fileName(), { Hash::Sha256 }));
+        QSignalSpy finishedSpy(job.get(), &HashJob::finished);
+        QSignalSpy progressSpy(job.get(), &HashJob::progress);
+        QVERIFY(finishedSpy.wait(10000));
+        QVERIFY(progressSpy.count() > 0);
+        QCOMPARE(job->result().value(0), Hash::from(Hash::Sha256, data));
+
+        // the prefix, as a resumed transfer does
+        job.reset(HashPool::instance()->stream({ Hash::Sha1 }));
+        job->addFile(file.fileName(), 0, 1000);
+        job->addData(data.mid(1000, 24));
+        QCOMPARE(job->waitForFinished().value(0), Hash::from(Hash::Sha1, data.left(1024)));
+    }
+
+    void testMissingFile()
+    {
+        auto job = std::unique_ptr<HashJob>(HashPool::instance()->file("/nonexistent/file", { Hash::Sha1 }));
+        QVERIFY(job->waitForFinished().isEmpty());
+    }
+
+    void testCancel()
+    {
+        auto       job = std::unique_ptr<HashJob>(HashPool::instance()->stream({ Hash::Sha1 }));
+        QSignalSpy finishedSpy(job.get(), &HashJob::finished);
+        job->addData(testData(1024));
+        job->cancel();
+        QVERIFY(finishedSpy.count() || finishedSpy.wait(10000));
+        QVERIFY(job->isFinished());
+        QVERIFY(job->result().isEmpty());
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(HashPoolTest);
+#include "hashpooltest.moc"
@@ -0,0 +1,426 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "irisnet/noncore/tcpportreserver.h"
+#include "qttestutil/qttestutil.h"
+#include "xmpp/xmpp-core/xmpp.h"
+#include "xmpp/xmpp-core/xmpp_clientstream.h"
+#include "xmpp/xmpp-im/jingle-s5b.h"
+#include "xmpp/xmpp-im/jingle-session.h"
+#include "xmpp/xmpp-im/jingle.h"
+#include "xmpp/xmpp-im/s5b.h"
+#include "xmpp/xmpp-im/xmpp_client.h"
+#include "xmpp/xmpp-im/xmpp_externalservicediscovery.h"
+#include "xmpp/xmpp-im/xmpp_serverinfomanager.h"
+
+#include <QDomDocument>
+#include <QObject>
+#include <QTimer>
+#include <QtTest/QtTest>
+
+#include <algorithm>
+
+using namespace XMPP;
+using namespace std::chrono_literals;
+
+static const QString DOMAIN         = QStringLiteral("example.org");
+static const QString PROXY          = QStringLiteral("proxy.example.org");
+static const QString DISCO_INFO_NS  = QStringLiteral("http://jabber.org/protocol/disco#info");
+static const QString DISCO_ITEMS_NS = QStringLiteral("http://jabber.org/protocol/disco#items");
+static const QString BYTESTREAMS_NS = QStringLiteral("http://jabber.org/protocol/bytestreams");
+static const QString EXTDISCO_NS    = QStringLiteral("urn:xmpp:extdisco:2");
+static const int     ROUNDTRIP      = 20; // msecs. for the benchmark
+static const int     TURN_PORT      = 3478;
+
+// never connects anywhere
+class NullConnector : public Connector {
+public:
+    void        setOptHostPort(const QString &, quint16) override { }
+    void        connectToServer(const QString &) override { }
+    ByteStream *stream() const override { return nullptr; }
+    void        done() override { }
+};
+
+// answers like a server with a SOCKS5 proxy and STUN/TURN services. each answer comes after `latency` msecs
+class ServerStream : public ClientStream {
+public:
+    ServerStream(Connector *conn) : ClientStream(conn) { }
+
+    bool   stanzaAvailable() const override { return !in.isEmpty(); }
+    Stanza read() override { return in.takeFirst(); }
+    void   write(const Stanza &s) override
+    {
+        auto e = s.element();
+        out += e;
+        pending++;
+        QTimer::singleShot(latency, this, [this, reply = answer(e)]() {
+            pending--;
+            QDomDocument d;
+            d.setContent(reply, true);
+            in += createStanza(doc().importNode(d.documentElement(), true).toElement());
+            emit readyRead();
+        });
+    }
+
+    // requests sent so far. by the namespace and optionally the name of the query
+    int asked(const QString &ns, const QString &name = QString()) const
+    {
+        return int(std::count_if(out.begin(), out.end(), [&](const QDomElement &e) {
+            auto q = e.firstChildElement();
+            return q.namespaceURI() == ns && (name.isEmpty() || q.tagName() == name);
+        }));
+    }
+
+    // in local time, the way ExternalService::parse() reads it
+    static QString expires(int secs) { return QDateTime::currentDateTime().addSecs(secs).toString(Qt::ISODate); }
+
+    int                latency   = 0;
+    int                pending   = 0;
+    bool               proxyDown = false;
+    QString            services; // <service/> elements of the extdisco answers
+    QString            credentials;
+    QList<Stanza>      in;
+    QList<QDomElement> out;
+
+private:
+    QString answer(const QDomElement &iq) const
+    {
+        const auto to    = iq.attribute("to");
+        const auto query = iq.firstChildElement();
+        const auto ns    = query.namespaceURI();
+        QString    body;
+        if (ns == DISCO_INFO_NS && to == DOMAIN)
+            body = QString("<query xmlns='%1'><identity category='server' type='im'/><feature var='%2'/></query>")
+                       .arg(DISCO_INFO_NS, EXTDISCO_NS);
+        else if (ns == DISCO_INFO_NS && to == PROXY)
+            body = QString("<query xmlns='%1'><identity category='proxy' type='bytestreams'/><feature var='%2'/>"
+                           "</query>")
+                       .arg(DISCO_INFO_NS, BYTESTREAMS_NS);
+        else if (ns == DISCO_INFO_NS)
+            body = QString("<query xmlns='%1'/>").arg(DISCO_INFO_NS);
+        else if (ns == DISCO_ITEMS_NS)
+            body = QString("<query xmlns='%1'><item jid='%2'/></query>").arg(DISCO_ITEMS_NS, PROXY);
+        else if (ns == BYTESTREAMS_NS && !proxyDown)
+            body = QString("<query xmlns='%1'><streamhost jid='%2' host='192.0.2.10' port='7777'/></query>")
+                       .arg(BYTESTREAMS_NS, PROXY);
+        else if (ns == BYTESTREAMS_NS)
+            return QString("<iq xmlns='jabber:client' type='error' id='%1' from='%2'><error type='cancel'>"
+                           "<remote-server-not-found xmlns='urn:ietf:params:xml:ns:xmpp-stanzas'/></error></iq>")
+                .arg(iq.attribute("id"), to);
+        else if (ns == EXTDISCO_NS)
+            body = QString("<%1 xmlns='%2'>%3</%1>")
+                       .arg(query.tagName(), EXTDISCO_NS, query.tagName() == "services" ? services : credentials);
+        else if (ns == QLatin1String("jabber:iq:roster"))
+            body = QStringLiteral("<query xmlns='jabber:iq:roster'/>");
+
+        return QString("<iq xmlns='jabber:client' type='result' id='%1'%2>%3</iq>")
+            .arg(iq.attribute("id"), to.isEmpty() ? QString() : QString(" from='%1'").arg(to), body);
+    }
+};
+
+// a logged in account. the roster and the server disco are done, as after any login
+struct Account {
+    NullConnector   conn;
+    ServerStream    stream { &conn };
+    TcpPortReserver reserver;
+    Client          client;
+
+    Account()
+    {
+        reserver.registerScope(QStringLiteral("s5b"), new S5BServersProducer);
+        client.setTcpPortReserver(&reserver);
+        client.connectToServer(&stream, Jid("romeo@example.org/orchard"));
+        client.start(DOMAIN, QStringLiteral("romeo"), QString(), QStringLiteral("orchard"));
+        client.rosterRequest();
+    }
+
+    bool loggedIn()
+    {
+        return QTest::qWaitFor([this]() { return client.externalServiceDiscovery()->isSupported() && !stream.pending; },
+                               1000);
+    }
+};
+
+class JingleCacheTest : public QObject {
+    Q_OBJECT
+
+    // prepares a new S5B transport of the session. true when it's ready to offer the proxy as a candidate
+    static bool offerProxy(Jingle::Session *session)
+    {
+        auto       pad       = session->transportPadFactory(Jingle::S5B::NS);
+        auto       transport = pad->manager()->newTransport(pad, Jingle::Origin::Initiator);
+        auto       t         = transport.data();
+        bool       offered   = false;
+        QEventLoop loop;
+        connect(t, &Jingle::Transport::updated, t, [t, &offered, &loop]() {
+            if (!t->hasUpdates())
+                return;
+            auto tel = std::get<0>(t->takeOutgoingUpdate(false));
+            for (auto c = tel.firstChildElement("candidate"); !c.isNull(); c = c.nextSiblingElement("candidate"))
+                offered = offered || c.attribute("type") == QLatin1String("proxy");
+            if (offered)
+                loop.quit();
+        });
+        QTimer::singleShot(1000, &loop, &QEventLoop::quit);
+        t->prepare();
+        if (!offered)
+            loop.exec();
+        return offered;
+    }
+
+    static QString stun(int expiresIn)
+    {
+        return QString("<service host='stun.example.org' type='stun' port='3478' transport='udp' expires='%1'/>")
+            .arg(ServerStream::expires(expiresIn));
+    }
+
+    static QString restrictedTurn()
+    {
+        return QString("<service host='turn.example.org' type='turn' port='%1' transport='udp' restricted='true'/>")
+            .arg(TURN_PORT);
+    }
+
+    static QString turnCreds(int expiresIn)
+    {
+        return QString("<service host='turn.example.org' type='turn' port='%1' username='romeo' password='secret'"
+                       " expires='%2'/>")
+            .arg(TURN_PORT)
+            .arg(ServerStream::expires(expiresIn));
+    }
+
+    // what Jingle ICE asks for on prepare(). true if answered from the cache
+    static bool iceServices(ExternalServiceDiscovery *esd, ExternalServiceList &result)
+    {
+        bool done = false;
+        esd->services(
+            esd,
+            [&](const ExternalServiceList &services) {
+                result = services;
+                done   = true;
+            },
+            1min, { "stun", "turn" });
+        const bool cached = done;
+        QTest::qWaitFor([&done]() { return done; }, 1000);
+        return cached;
+    }
+
+    static bool iceCredentials(ExternalServiceDiscovery *esd, std::chrono::minutes minTtl, ExternalServiceList &result)
+    {
+        bool done = false;
+        esd->credentials(
+            esd,
+            [&](const ExternalServiceList &creds) {
+                result = creds;
+                done   = true;
+            },
+            { ExternalServiceId { QStringLiteral("turn.example.org"), QStringLiteral("turn"), TURN_PORT } },
+            minTtl);
+        const bool cached = done;
+        QTest::qWaitFor([&done]() { return done; }, 1000);
+        return cached;
+    }
+
+private slots:
+    void testProxyQuery()
+    {
+        Account account;
+        QVERIFY(account.loggedIn());
+        auto manager = account.client.jingleS5BManager();
+        QVERIFY(manager->cachedProxy(PROXY).host().isEmpty());
+
+        // transports started together ask the proxy once
+        QList<StreamHost> got;
+        for (int i = 0; i < 2; i++)
+            manager->queryProxy(PROXY, this, [&got](const StreamHost &sh) { got += sh; });
+        QTRY_COMPARE(got.size(), 2);
+        QCOMPARE(account.stream.asked(BYTESTREAMS_NS), 1);
+        for (const auto &sh : std::as_const(got)) {
+            QCOMPARE(sh.host(), QStringLiteral("192.0.2.10"));
+            QCOMPARE(sh.port(), 7777);
+        }
+
+        // and later ones don't ask at all
+        QCOMPARE(manager->cachedProxy(PROXY).host(), QStringLiteral("192.0.2.10"));
+        QTest::qWait(10);
+        QCOMPARE(account.stream.asked(BYTESTREAMS_NS), 1);
+    }
+
+    void testProxyExpiry()
+    {
+        Account account;
+        QVERIFY(account.loggedIn());
+        auto manager = account.client.jingleS5BManager();
+        manager->setProxyCacheTtl(1000ms);
+
+        bool answered = false;
+        manager->queryProxy(PROXY, this, [&answered](const StreamHost &) { answered = true; });
+        QTRY_VERIFY(answered);
+
+        // past half of its life it's still used, and refreshed in the background
+        QTest::qWait(600);
+        QCOMPARE(manager->cachedProxy(PROXY).host(), QStringLiteral("192.0.2.10"));
+        QTRY_COMPARE(account.stream.asked(BYTESTREAMS_NS), 2);
+        QTRY_COMPARE(account.stream.pending, 0);
+
+        // the first answer would have expired by now
+        QTest::qWait(600);
+        QVERIFY(!manager->cachedProxy(PROXY).host().isEmpty());
+        QTRY_COMPARE(account.stream.asked(BYTESTREAMS_NS), 3);
+        QTRY_COMPARE(account.stream.pending, 0);
+
+        // not used for a while. it's gone
+        QTest::qWait(1100);
+        QVERIFY(manager->cachedProxy(PROXY).host().isEmpty());
+
+        // a failed query doesn't stay in the cache
+        account.stream.proxyDown = true;
+        StreamHost failed;
+        answered = false;
+        manager->queryProxy(PROXY, this, [&](const StreamHost &sh) {
+            failed   = sh;
+            answered = true;
+        });
+        QTRY_VERIFY(answered);
+        QVERIFY(failed.host().isEmpty());
+        QVERIFY(manager->cachedProxy(PROXY).host().isEmpty());
+
+        account.stream.proxyDown = false;
+        answered                 = false;
+        manager->queryProxy(PROXY, this, [&answered](const StreamHost &) { answered = true; });
+        QTRY_VERIFY(answered);
+        QCOMPARE(account.stream.asked(BYTESTREAMS_NS), 5);
+        QVERIFY(!manager->cachedProxy(PROXY).host().isEmpty());
+    }
+
+    void testServicesRefresh()
+    {
+        Account account;
+        account.stream.services = stun(90) + restrictedTurn();
+        QVERIFY(account.loggedIn());
+        auto                esd = account.client.externalServiceDiscovery();
+        ExternalServiceList services;
+        esd->setServicesTtl(1000ms);
+
+        QVERIFY(!iceServices(esd, services));
+        QCOMPARE(services.size(), 2);
+        QCOMPARE(account.stream.asked(EXTDISCO_NS, "services"), 1);
+
+        // the restricted service has no credentials yet, which doesn't make the list invalid.
+        // the stun server expires within 2 minutes. still good enough, but refreshed in the background
+        account.stream.services = stun(30) + restrictedTurn();
+        QVERIFY(iceServices(esd, services));
+        QCOMPARE(services.size(), 2);
+        QTRY_COMPARE(account.stream.asked(EXTDISCO_NS, "services"), 2);
+        QTRY_COMPARE(account.stream.pending, 0);
+
+        // now within a minute. it's waited for
+        account.stream.services = stun(30 * 60) + restrictedTurn();
+        QVERIFY(!iceServices(esd, services));
+        QCOMPARE(services.size(), 2);
+        QCOMPARE(account.stream.asked(EXTDISCO_NS, "services"), 3);
+        QVERIFY(iceServices(esd, services));
+        QCOMPARE(account.stream.asked(EXTDISCO_NS, "services"), 3);
+
+        // the list itself is getting old
+        QTest::qWait(600);
+        QVERIFY(iceServices(esd, services));
+        QTRY_COMPARE(account.stream.asked(EXTDISCO_NS, "services"), 4);
+    }
+
+    void testNoServices()
+    {
+        Account account;
+        QVERIFY(account.loggedIn());
+        auto                esd = account.client.externalServiceDiscovery();
+        ExternalServiceList services;
+        esd->setServicesTtl(1000ms);
+
+        // nothing there, and it's known
+        QVERIFY(!iceServices(esd, services));
+        QVERIFY(services.isEmpty());
+        QVERIFY(iceServices(esd, services));
+        QCOMPARE(account.stream.asked(EXTDISCO_NS, "services"), 1);
+
+        // until the list expires
+        QTest::qWait(1100);
+        QVERIFY(!iceServices(esd, services));
+        QCOMPARE(account.stream.asked(EXTDISCO_NS, "services"), 2);
+    }
+
+    void testCredentials()
+    {
+        Account account;
+        account.stream.services    = stun(30 * 60) + restrictedTurn();
+        account.stream.credentials = turnCreds(10 * 60);
+        QVERIFY(account.loggedIn());
+        auto                esd = account.client.externalServiceDiscovery();
+        ExternalServiceList services;
+        ExternalServiceList creds;
+        esd->setServicesTtl(1000ms);
+        QVERIFY(!iceServices(esd, services));
+
+        QVERIFY(!iceCredentials(esd, 5min, creds));
+        QCOMPARE(account.stream.asked(EXTDISCO_NS, "credentials"), 1);
+        QCOMPARE(creds.size(), 1);
+        QCOMPARE(creds[0]->username, QStringLiteral("romeo"));
+        QCOMPARE(creds[0]->password, QStringLiteral("secret"));
+
+        // cached with their own expiry
+        QVERIFY(iceCredentials(esd, 5min, creds));
+        QCOMPARE(creds.size(), 1);
+        QCOMPARE(creds[0]->password, QStringLiteral("secret"));
+        QVERIFY(!iceCredentials(esd, 15min, creds));
+        QCOMPARE(account.stream.asked(EXTDISCO_NS, "credentials"), 2);
+
+        // a refresh of the list keeps them
+        QTest::qWait(600);
+        QVERIFY(iceServices(esd, services));
+        QTRY_COMPARE(account.stream.asked(EXTDISCO_NS, "services"), 2);
+        QTRY_COMPARE(account.stream.pending, 0);
+        QVERIFY(iceCredentials(esd, 5min, creds));
+        QCOMPARE(account.stream.asked(EXTDISCO_NS, "credentials"), 2);
+    }
+
+    void benchmarkPrepare_data()
+    {
+        QTest::addColumn<bool>("warm");
+        QTest::newRow("first transport of the account") << false;
+        QTest::newRow("proxy cached") << true;
+    }
+
+    // from prepare() until the proxy can be offered, with every answer of the server taking ROUNDTRIP msecs.
+    // a cold start asks the proxy for its disco#info and host/port. a warm one asks nothing
+    void benchmarkPrepare()
+    {
+        QFETCH(bool, warm);
+        Account account;
+        account.stream.latency = ROUNDTRIP;
+        QVERIFY(account.loggedIn());
+        auto session = account.client.jingleManager()->newSession(Jid("juliet@example.org/balcony"));
+        if (warm)
+            QVERIFY(offerProxy(session));
+
+        const auto asked = account.stream.out.size();
+        QBENCHMARK_ONCE { QVERIFY(offerProxy(session)); }
+        QCOMPARE(account.stream.out.size() - asked, warm ? 0 : 2);
+        delete session;
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(JingleCacheTest);
+#include "jinglecachetest.moc"
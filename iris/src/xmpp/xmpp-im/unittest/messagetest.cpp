@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "qttestutil/qttestutil.h"
+#include "xmpp/xmpp-core/xmpp_stream.h"
+#include "xmpp/xmpp-im/xmpp_message.h"
+
+#include <QDomDocument>
+#include <QFile>
+#include <QObject>
+#include <QtTest/QtTest>
+
+using namespace XMPP;
+
+// just enough of a stream to wrap parsed elements into stanzas
+class TestStream : public Stream {
+public:
+    QDomDocument &doc() const override { return doc_; }
+    QString       baseNS() const override { return QStringLiteral("jabber:client"); }
+    bool          old() const override { return false; }
+
+    void   close() override { }
+    bool   stanzaAvailable() const override { return false; }
+    Stanza read() override { return Stanza(); }
+    void   write(const Stanza &) override { }
+
+    int                     errorCondition() const override { return 0; }
+    QString                 errorText() const override { return QString(); }
+    QHash<QString, QString> errorLangText() const override { return {}; }
+    QDomElement             errorAppSpec() const override { return QDomElement(); }
+
+    Stanza parse(const QString &xml)
+    {
+        QDomDocument d;
+        d.setContent(xml, true);
+        return parse(d.documentElement());
+    }
+
+    Stanza parse(const QDomElement &e) { return createStanza(doc_.importNode(e, true).toElement()); }
+
+private:
+    mutable QDomDocument doc_;
+};
+
+class MessageTest : public QObject {
+    Q_OBJECT
+
+    // a typical groupchat message of a modern client: hints, ids, delay and a handful of extensions
+    static QString groupchatMessage(int i)
+    {
+        return QString("<message xmlns='jabber:client' type='groupchat' id='m%1'"
+                       " from='room@conference.example.org/user%2' to='me@example.org/psi'>"
+                       "<body>message number %1</body>"
+                       "<origin-id xmlns='urn:xmpp:sid:0' id='o%1'/>"
+                       "<stanza-id xmlns='urn:xmpp:sid:0' id='s%1' by='room@conference.example.org'/>"
+                       "<delay xmlns='urn:xmpp:delay' stamp='2026-10-16T10:00:00Z'/>"
+                       "<active xmlns='http://jabber.org/protocol/chatstates'/>"
+                       "<markable xmlns='urn:xmpp:chat-markers:0'/>"
+                       "<occupant-id xmlns='urn:xmpp:occupant-id:0' id='occ%2'/>"
+                       "<nick xmlns='http://jabber.org/protocol/nick'>user%2</nick>"
+                       "<x xmlns='http://jabber.org/protocol/muc#user'><status code='100'/></x>"
+                       "<html xmlns='http://jabber.org/protocol/xhtml-im'>"
+                       "<body xmlns='http://www.w3.org/1999/xhtml'><p>message <b>number</b> %1</p></body></html>"
+                       "<reference xmlns='urn:xmpp:reference:0' type='mention' uri='xmpp:me@example.org' begin='0'"
+                       " end='7'/>"
+                       "<request xmlns='urn:xmpp:receipts'/>"
+                       "</message>")
+            .arg(i)
+            .arg(i % 37);
+    }
+
+    // data/muchistory.xml: a history page of a MUC with the stanzas of several clients
+    static QList<Stanza> mucHistory(TestStream &stream)
+    {
+        QList<Stanza> stanzas;
+        QFile         file(QFINDTESTDATA("data/muchistory.xml"));
+        QDomDocument  doc;
+        if (!file.open(QIODevice::ReadOnly) || !doc.setContent(&file, true))
+            return stanzas;
+        for (auto e = doc.documentElement().firstChildElement(); !e.isNull(); e = e.nextSiblingElement())
+            stanzas << stream.parse(e);
+        return stanzas;
+    }
+
+private slots:
+    void testExtensionsDecodedOnAccess()
+    {
+        TestStream stream;
+        Message    m;
+        QVERIFY(m.fromStanza(stream.parse(groupchatMessage(1))));
+
+        QCOMPARE(m.body(), QString("message number 1"));
+        QCOMPARE(m.originId(), QString("o1"));
+        QCOMPARE(m.stanzaId().id, QString("s1"));
+        QVERIFY(m.spooled());
+        QCOMPARE(m.chatState(), StateActive);
+        QCOMPARE(m.messageReceipt(), ReceiptRequest);
+        QCOMPARE(m.nick(), QString("user1"));
+        QCOMPARE(m.getMUCStatuses(), QList<int>() << 100);
+        QVERIFY(m.containsHTML());
+        QCOMPARE(m.references().size(), 1);
+    }
+
+    void testRoundTripDecodesPendingExtensions()
+    {
+        TestStream stream;
+        Message    m;
+        QVERIFY(m.fromStanza(stream.parse(groupchatMessage(2))));
+
+        // nothing but the body was touched, yet the extensions must survive serialization
+        Message copy;
+        QVERIFY(copy.fromStanza(m.toStanza(&stream)));
+        QCOMPARE(copy.chatState(), StateActive);
+        QCOMPARE(copy.nick(), QString("user2"));
+        QCOMPARE(copy.messageReceipt(), ReceiptRequest);
+        QVERIFY(copy.containsHTML());
+    }
+
+    void testSetterKeepsOtherExtensions()
+    {
+        TestStream stream;
+        Message    m;
+        QVERIFY(m.fromStanza(stream.parse(groupchatMessage(3))));
+
+        m.setNick(QStringLiteral("renamed"));
+        QCOMPARE(m.nick(), QString("renamed"));
+        QCOMPARE(m.chatState(), StateActive);
+    }
+
+    void testMucHistory()
+    {
+        TestStream stream;
+        auto       stanzas = mucHistory(stream);
+        QVERIFY(stanzas.size() > 0);
+        int withBody = 0;
+        for (const Stanza &s : std::as_const(stanzas)) {
+            Message m;
+            QVERIFY(m.fromStanza(s));
+            QVERIFY(m.spooled());
+            if (!m.body().isEmpty())
+                withBody++;
+        }
+        QVERIFY(withBody > stanzas.size() / 2);
+
+        Message subject;
+        QVERIFY(subject.fromStanza(stanzas.last()));
+        QVERIFY(!subject.subject().isEmpty());
+    }
+
+    void benchmarkGroupchatReplay_data()
+    {
+        QTest::addColumn<bool>("allExtensions");
+        QTest::newRow("body only") << false; // what a muc history replay mostly needs
+        QTest::newRow("all extensions") << true;
+    }
+
+    // a MUC history burst: decode the stanzas and look at what the chat view usually reads
+    void benchmarkGroupchatReplay()
+    {
+        QFETCH(bool, allExtensions);
+        TestStream    stream;
+        const auto    page = mucHistory(stream);
+        QList<Stanza> stanzas;
+        QVERIFY(page.size() > 0);
+        while (stanzas.size() < 1000) // as if the room were joined again and again
+            stanzas += page;
+
+        QBENCHMARK
+        {
+            for (const Stanza &s : std::as_const(stanzas)) {
+                Message m;
+                m.fromStanza(s);
+                Q_UNUSED(m.body())
+                if (allExtensions) {
+                    Q_UNUSED(m.chatState())
+                    Q_UNUSED(m.nick())
+                    Q_UNUSED(m.getMUCStatuses())
+                    Q_UNUSED(m.html())
+                    Q_UNUSED(m.references())
+                    Q_UNUSED(m.messageReceipt())
+                }
+            }
+        }
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(MessageTest);
+#include "messagetest.moc"
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "qttestutil/qttestutil.h"
+#include "xmpp/xmpp-core/xmpp.h"
+#include "xmpp/xmpp-core/xmpp_clientstream.h"
+#include "xmpp/xmpp-im/xmpp_client.h"
+#include "xmpp/xmpp-im/xmpp_liveroster.h"
+#include "xmpp/xmpp-im/xmpp_tasks.h"
+
+#include <QDomDocument>
+#include <QObject>
+#include <QtTest/QtTest>
+
+using namespace XMPP;
+
+// never connects anywhere
+class NullConnector : public Connector {
+public:
+    void        setOptHostPort(const QString &, quint16) override { }
+    void        connectToServer(const QString &) override { }
+    ByteStream *stream() const override { return nullptr; }
+    void        done() override { }
+};
+
+// the server's answers are fed by hand and reach the client the same way as from the network
+class TestStream : public ClientStream {
+public:
+    TestStream(Connector *conn) : ClientStream(conn) { }
+
+    bool   stanzaAvailable() const override { return !in.isEmpty(); }
+    Stanza read() override { return in.takeFirst(); }
+    void   write(const Stanza &s) override { out += s.element(); }
+
+    void receive(const QDomDocument &d)
+    {
+        in += createStanza(doc().importNode(d.documentElement(), true).toElement());
+        emit readyRead();
+    }
+
+    QList<Stanza>      in;
+    QList<QDomElement> out;
+};
+
+// What a reconnect costs with and without XEP-0237 when nothing changed in the roster
+class RosterVersionTest : public QObject {
+    Q_OBJECT
+
+    static const int CONTACTS = 500;
+
+    // typical item: a jid, a name and a group
+    static QString fullRoster(int count)
+    {
+        QString xml = QStringLiteral("<iq xmlns='jabber:client' type='result' id='roster_1'>"
+                                     "<query xmlns='jabber:iq:roster' ver='ver500'>");
+        for (int i = 0; i < count; i++)
+            xml += QString("<item jid='contact%1@example.com' name='Contact %1' subscription='both'>"
+                           "<group>Group %2</group></item>")
+                       .arg(i)
+                       .arg(i % 10);
+        return xml + QStringLiteral("</query></iq>");
+    }
+
+    static QString upToDate() { return QStringLiteral("<iq xmlns='jabber:client' type='result' id='roster_1'/>"); }
+
+    static qint64 takeResult(Client &client, QDomDocument &doc, bool *upToDate = nullptr)
+    {
+        JT_Roster roster(client.rootTask());
+        roster.get(QStringLiteral("ver500"));
+        doc.documentElement().setAttribute("id", roster.id());
+        roster.take(doc.documentElement());
+        if (upToDate)
+            *upToDate = roster.isUpToDate();
+        return roster.roster().count();
+    }
+
+private slots:
+    void testBytes()
+    {
+        auto full  = fullRoster(CONTACTS).toUtf8().size();
+        auto empty = upToDate().toUtf8().size();
+        qDebug("roster of %d contacts: %d bytes on every login without versioning, %d bytes with it", CONTACTS,
+               int(full), int(empty));
+        QVERIFY(empty * 100 < full);
+    }
+
+    void testResults()
+    {
+        Client       client;
+        QDomDocument doc;
+        bool         confirmed = false;
+
+        doc.setContent(fullRoster(CONTACTS), true);
+        QCOMPARE(takeResult(client, doc, &confirmed), qint64(CONTACTS));
+        QVERIFY(!confirmed);
+
+        doc.setContent(upToDate(), true);
+        QCOMPARE(takeResult(client, doc, &confirmed), qint64(0));
+        QVERIFY(confirmed);
+    }
+
+    // parsing the stanza is left out. it's the same for both and comes with the stream parser
+    void benchmarkFullRoster()
+    {
+        Client       client;
+        QDomDocument doc;
+        doc.setContent(fullRoster(CONTACTS), true);
+        QBENCHMARK { takeResult(client, doc); }
+    }
+
+    void benchmarkUpToDate()
+    {
+        Client       client;
+        QDomDocument doc;
+        doc.setContent(upToDate(), true);
+        QBENCHMARK { takeResult(client, doc); }
+    }
+
+    void benchmarkReconnect_data()
+    {
+        QTest::addColumn<bool>("versioned");
+        QTest::newRow("full roster") << false;
+        QTest::newRow("cached version confirmed") << true;
+    }
+
+    // the whole reconnect as Client sees it: the cached roster is restored, requested, the result goes
+    // through the stream, Client's dispatch and LiveRoster, and every contact the contact list has to
+    // update is reported. reading the cache file and Psi's contact list itself are not part of it.
+    // the stream doesn't announce XEP-0237, so the request has no version. the answers are the server's anyway
+    void benchmarkReconnect()
+    {
+        QFETCH(bool, versioned);
+        NullConnector conn;
+        TestStream    stream(&conn);
+        Client        client;
+        client.connectToServer(&stream, Jid("romeo@example.com/orchard"));
+        client.start(QStringLiteral("example.com"), QStringLiteral("romeo"), QString(), QStringLiteral("orchard"));
+
+        QDomDocument doc;
+        doc.setContent(fullRoster(CONTACTS), true);
+        JT_Roster parsed(client.rootTask());
+        parsed.get(QStringLiteral("ver500"));
+        doc.documentElement().setAttribute("id", parsed.id());
+        parsed.take(doc.documentElement());
+        const Roster cached = parsed.roster();
+        QCOMPARE(cached.count(), CONTACTS);
+
+        doc.setContent(versioned ? upToDate() : fullRoster(CONTACTS), true);
+        int  reported = 0;
+        bool finished = false;
+        connect(&client, &Client::rosterItemAdded, this, [&reported]() { reported++; });
+        connect(&client, &Client::rosterItemUpdated, this, [&reported]() { reported++; });
+        connect(&client, &Client::rosterRequestFinished, this, [&finished](bool success) { finished = success; });
+
+        QBENCHMARK {
+            reported = 0;
+            finished = false;
+            client.setCachedRoster(cached);
+            client.rosterRequest();
+            doc.documentElement().setAttribute("id", stream.out.last().attribute("id"));
+            stream.receive(doc);
+        }
+        QVERIFY(finished);
+        QCOMPARE(client.isRosterCached(), versioned);
+        QCOMPARE(reported, versioned ? 0 : CONTACTS);
+        QCOMPARE(client.roster().count(), CONTACTS);
+    }
+};
+
+QTTESTUTIL_REGISTER_TEST(RosterVersionTest);
+#include "rosterversiontest.moc"
@@ -32,6 +32,7 @@
 #include "xmpp_xmlcommon.h"
 
 #include <QCoreApplication>
+#include <QDataStream>
 #include <QDebug>
 #include <QDomElement>
 #include <QFile>
@@ -78,23 +79,61 @@ CapsRegistry *CapsRegistry::instance()
 
 void CapsRegistry::setInstance(CapsRegistry *instance) { instance_ = instance; }
 
+/*
+ * The registry is kept as an append-only journal, so a newly seen client version costs one
+ * record written at the end of the file instead of rewriting all the known nodes:
+ *
+ *   quint32 magic, quint32 version, then records of
+ *   QString node, qint64 last seen (msecs since epoch), QByteArray disco#info result xml
+ *
+ * A later record for the same node overrides the earlier one. On load only nodes and offsets
+ * are indexed, the xml is parsed on the first lookup of a node. Records which became
+ * useless (overridden or expired) are dropped by save() when there are too many of them.
+ */
+static const quint32 CapsJournalMagic   = 0x43415053; // "CAPS"
+static const quint32 CapsJournalVersion = 1;
+
+// keep unseen info for last 3 month. adjust if required
+static QDateTime capsValidTime() { return QDateTime::currentDateTime().addMonths(-3); }
+
+void CapsRegistry::writeRecord(QDataStream &out, const QString &node, const QDateTime &lastSeen, const QByteArray &xml)
+{
+    out << node << qint64(lastSeen.toMSecsSinceEpoch());
+    out.writeBytes(xml.constData(), uint(xml.size()));
+}
+
+QByteArray CapsRegistry::entryXml(const Entry &entry) const
+{
+    if (!entry.parsed)
+        return journal_.mid(entry.offset, entry.size);
+
+    QDomDocument doc;
+    doc.appendChild(entry.disco.toDiscoInfoResult(&doc));
+    return doc.toByteArray(-1);
+}
+
 /**
- * \brief Convert all capabilities info to XML.
+ * \brief Rewrites the whole journal leaving only the actual records.
  */
 void CapsRegistry::save()
 {
-    // Generate XML
-    QDomDocument doc;
-    QDomElement  capabilities = doc.createElement("capabilities");
-    doc.appendChild(capabilities);
-    QHash<QString, CapsInfo>::ConstIterator i = capsInfo_.constBegin();
-    for (; i != capsInfo_.constEnd(); i++) {
-        QDomElement info = i.value().toXml(&doc);
-        info.setAttribute("node", i.key());
-        capabilities.appendChild(info);
+    QByteArray  data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_5_9);
+    out << CapsJournalMagic << CapsJournalVersion;
+
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        QByteArray xml = entryXml(it.value());
+        writeRecord(out, it.key(), it->lastSeen, xml);
+        if (!it->parsed) {
+            it->offset = int(out.device()->pos()) - int(xml.size());
+            it->size   = int(xml.size());
+        }
     }
 
-    saveData(doc.toString().toUtf8());
+    journal_      = data; // unparsed entries now point into the new data
+    journalValid_ = true;
+    saveData(data);
 }
 
 void CapsRegistry::saveData(const QByteArray &data)
@@ -103,81 +142,184 @@ void CapsRegistry::saveData(const QByteArray &data)
     return;
 }
 
+void CapsRegistry::appendData(const QByteArray &data)
+{
+    Q_UNUSED(data)
+    return;
+}
+
 QByteArray CapsRegistry::loadData() { return QByteArray(); }
 
 /**
- * \brief Sets the file to save the capabilities info to
+ * \brief Reads caps.xml of older versions and converts it to the journal.
  */
-void CapsRegistry::load()
+void CapsRegistry::loadLegacy(const QByteArray &data)
 {
-    QByteArray data = loadData();
-    if (data.isEmpty()) {
-        return;
-    }
-
-    // Load settings
     QDomDocument doc;
 
     if (!doc.setContent(QString::fromUtf8(data))) {
         qWarning() << "CapsRegistry: Cannnot parse input";
+        save(); // start from scratch. appending to it would corrupt it further
         return;
     }
 
     QDomElement caps = doc.documentElement();
     if (caps.tagName() != "capabilities") {
         qWarning("caps.cpp: Invalid capabilities element");
+        save();
         return;
     }
 
-    // keep unseen info for last 3 month. adjust if required
-    QDateTime validTime = QDateTime::currentDateTime().addMonths(-3);
-    for (QDomNode n = caps.firstChild(); !n.isNull(); n = n.nextSibling()) {
-        QDomElement i = n.toElement();
-        if (i.isNull()) {
-            qWarning("capsregistry.cpp: Null element");
-            continue;
+    QDateTime validTime = capsValidTime();
+    for (QDomElement i = caps.firstChildElement("info"); !i.isNull(); i = i.nextSiblingElement("info")) {
+        QString node = i.attribute("node");
+        int     sep  = node.indexOf('#');
+        if (sep > 0 && sep + 1 < node.length()) {
+            CapsInfo info = CapsInfo::fromXml(i);
+            if (info.isValid() && info.lastSeen() > validTime) {
+                Entry &e   = entries_[node];
+                e.lastSeen = info.lastSeen();
+                e.disco    = info.disco();
+                e.disco.setFeatures(sharedFeatures(e.disco.features()));
+                e.parsed = true;
+            }
+        } else {
+            qWarning() << "capsregistry.cpp: Node" << node << "invalid";
         }
+    }
+    save();
+}
 
-        if (i.tagName() == "info") {
-            QString node = i.attribute("node");
-            int     sep  = node.indexOf('#');
-            if (sep > 0 && sep + 1 < node.length()) {
-                CapsInfo info = CapsInfo::fromXml(i);
-                if (info.isValid() && info.lastSeen() > validTime) {
-                    capsInfo_[node] = CapsInfo::fromXml(i);
-                }
-                // qDebug() << QString("Read %1 %2").arg(node).arg(ver);
-            } else {
-                qWarning() << "capsregistry.cpp: Node" << node << "invalid";
-            }
+/**
+ * \brief Indexes the journal. Disco info of the nodes is parsed on demand.
+ */
+void CapsRegistry::load()
+{
+    QByteArray data = loadData();
+    if (data.startsWith('<')) {
+        loadLegacy(data);
+        return;
+    }
+
+    QDataStream in(data);
+    in.setVersion(QDataStream::Qt_5_9);
+    quint32 magic = 0, version = 0;
+    in >> magic >> version;
+    if (in.status() != QDataStream::Ok || magic != CapsJournalMagic || version != CapsJournalVersion) {
+        if (!data.isEmpty())
+            qWarning("CapsRegistry: Invalid journal. Starting from scratch");
+        save();
+        return;
+    }
+
+    journal_            = data;
+    QDateTime validTime = capsValidTime();
+    int       records   = 0;
+    bool      truncated = false;
+    while (!in.atEnd()) {
+        QString node;
+        qint64  lastSeen;
+        quint32 size;
+        in >> node >> lastSeen >> size;
+        int offset = int(in.device()->pos());
+        if (in.status() != QDataStream::Ok || in.skipRawData(int(size)) != int(size)) {
+            qWarning("CapsRegistry: Truncated journal"); // likely we were killed while writing
+            truncated = true;
+            break;
+        }
+        records++;
+        auto ts = QDateTime::fromMSecsSinceEpoch(lastSeen);
+        if (ts > validTime) {
+            entries_.insert(node, Entry { ts, DiscoItem(), false, offset, int(size) });
         } else {
-            qWarning("capsregistry.cpp: Unknown element");
+            entries_.remove(node);
         }
     }
+
+    journalValid_ = true;
+    // compact when the most of the journal is useless records
+    if (truncated || records - int(entries_.size()) > qMax(64, int(entries_.size()))) {
+        save();
+    }
+}
+
+/**
+ * \brief Returns features equal to \a features sharing data with the ones already known.
+ * Plenty of nodes (e.g. different versions of the same client) have the same feature list.
+ */
+Features CapsRegistry::sharedFeatures(const Features &features) const
+{
+    auto it = featurePool_.constFind(features);
+    if (it != featurePool_.constEnd())
+        return *it;
+    featurePool_.insert(features);
+    return features;
+}
+
+bool CapsRegistry::parse(Entry &entry) const
+{
+    QDomDocument doc;
+    if (!doc.setContent(QByteArray::fromRawData(journal_.constData() + entry.offset, entry.size))) {
+        return false;
+    }
+    DiscoItem item = DiscoItem::fromDiscoInfoResult(doc.documentElement());
+    if (item.features().isEmpty()) { // it's hardly possible if client does not support anything.
+        return false;
+    }
+    item.setFeatures(sharedFeatures(item.features()));
+    entry.disco  = item;
+    entry.parsed = true;
+    return true;
 }
 
 /**
  * \brief Registers capabilities of a client.
+ *
+ * The record is appended to the journal. If the journal wasn't loaded yet, it's loaded first,
+ * so the known nodes aren't lost and the append doesn't turn into a rewrite.
  */
 void CapsRegistry::registerCaps(const CapsSpec &spec, const DiscoItem &item)
 {
+    if (!journalValid_)
+        load();
+
     QString dnode = spec.flatten();
-    if (!isRegistered(dnode)) {
-        CapsInfo info(item);
-        capsInfo_[dnode] = info;
-        emit registered(spec);
+    if (isRegistered(dnode)) {
+        return;
     }
+
+    Entry e;
+    e.lastSeen = QDateTime::currentDateTime();
+    e.disco    = item;
+    e.disco.setFeatures(sharedFeatures(item.features()));
+    e.parsed = true;
+    entries_.insert(dnode, e);
+
+    QByteArray  record;
+    QDataStream out(&record, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_5_9);
+    writeRecord(out, dnode, e.lastSeen, entryXml(e));
+    appendData(record);
+    emit registered(spec);
 }
 
 /**
  * \brief Checks if capabilities have been registered.
  */
-bool CapsRegistry::isRegistered(const QString &spec) const { return capsInfo_.contains(spec); }
+bool CapsRegistry::isRegistered(const QString &spec) const { return entries_.contains(spec); }
 
 DiscoItem CapsRegistry::disco(const QString &spec) const
 {
-    CapsInfo ci = capsInfo_.value(spec);
-    return ci.disco();
+    auto it = entries_.find(spec);
+    if (it == entries_.end()) {
+        return DiscoItem();
+    }
+    if (!it->parsed && !parse(*it)) {
+        qWarning() << "CapsRegistry: Invalid disco info for" << spec;
+        entries_.erase(it); // will be requested again
+        return DiscoItem();
+    }
+    return it->disco;
 }
 
 /*--------------------------------------------------------------
@@ -24,6 +24,9 @@
 #include <iris/xmpp-im/xmpp_status.h>
 
 #include <QPointer>
+#include <QSet>
+
+class QDataStream;
 
 namespace XMPP {
 class CapsInfo {
@@ -56,21 +59,42 @@ public:
     void      registerCaps(const CapsSpec &, const XMPP::DiscoItem &item);
     bool      isRegistered(const QString &) const;
     DiscoItem disco(const QString &) const;
+    int       featureListCount() const { return featurePool_.size(); } // distinct feature lists kept in memory
 
 signals:
     void registered(const XMPP::CapsSpec &);
 
 public slots:
     void load();
-    void save();
+    void save(); // compacts the journal
 
 protected:
-    virtual void       saveData(const QByteArray &data); // reimplmenet these two functions
-    virtual QByteArray loadData();                       // to have permanent cache
+    // reimplement these functions to have permanent cache.
+    // the data is an append-only journal. saveData replaces it, appendData adds a record to its end
+    virtual void       saveData(const QByteArray &data);
+    virtual void       appendData(const QByteArray &data);
+    virtual QByteArray loadData();
 
 private:
-    static CapsRegistry     *instance_;
-    QHash<QString, CapsInfo> capsInfo_;
+    struct Entry {
+        QDateTime lastSeen;
+        DiscoItem disco;
+        bool      parsed = false;
+        int       offset = 0; // of the unparsed disco#info xml in journal_
+        int       size   = 0;
+    };
+
+    void        loadLegacy(const QByteArray &data);
+    bool        parse(Entry &entry) const;
+    Features    sharedFeatures(const Features &features) const;
+    QByteArray  entryXml(const Entry &entry) const;
+    static void writeRecord(QDataStream &out, const QString &node, const QDateTime &lastSeen, const QByteArray &xml);
+
+    static CapsRegistry          *instance_;
+    mutable QHash<QString, Entry> entries_;
+    mutable QSet<Features>        featurePool_; // identical feature lists share the same data
+    QByteArray                    journal_;     // loaded data. unparsed entries point into it
+    bool                          journalValid_ = false;
 };
 
 class CapsManager : public QObject {
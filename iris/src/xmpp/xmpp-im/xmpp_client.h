@@ -57,6 +57,7 @@ class ServerInfoManager;
 class Stream;
 class Task;
 class TcpPortReserver;
+class TrafficStats;
 class ExternalServiceDiscovery;
 class StunDiscoManager;
 
@@ -77,6 +78,16 @@ class Client : public QObject {
     Q_OBJECT
 
 public:
+    // How incoming stanzas were delivered to tasks. See Client::dispatchStats()
+    struct DispatchStats {
+        quint64 stanzas   = 0; // all the stanzas passed to tasks
+        quint64 watched   = 0; // taken by a watcher, see Task::registerWatcher()
+        quint64 iqResults = 0; // iq result/error delivered by id to the task which sent the request
+        quint64 pushes    = 0; // delivered to a handler registered for (stanza kind, child namespace)
+        quint64 slowPath  = 0; // had to go through the linear scan of the task tree
+        quint64 unhandled = 0; // nobody took it even on the slow path
+    };
+
     Client(QObject *parent = nullptr);
     ~Client();
 
@@ -91,6 +102,7 @@ public:
     const LiveRoster   &roster() const;
     const ResourceList &resourceList() const;
     bool                isSessionRequired() const;
+    bool                isRosterVersioningSupported() const;
 
     void           send(const QDomElement &);
     void           send(const QString &);
@@ -109,6 +121,8 @@ public:
     QNetworkAccessManager *networkAccessManager() const;
 
     void           rosterRequest(bool withGroupsDelimiter = true);
+    void           setCachedRoster(const Roster &);
+    bool           isRosterCached() const;
     void           sendMessage(Message &);
     EncryptionJob *sendMessageEncrypted(Message &, const QString &methodId, const EncryptionContext &);
     EncryptionJob *sendMessageEncrypted(Message &, EncryptedSession *session);
@@ -120,6 +134,11 @@ public:
     Task         *rootTask();
     QDomDocument *doc() const;
 
+    const DispatchStats &dispatchStats() const;
+    void                 resetDispatchStats();
+    const TrafficStats  &trafficStats() const; // stanza traffic, parse/dispatch times and iq latencies
+    void                 resetTrafficStats();
+
     QString  OSName() const;
     QString  OSVersion() const;
     QString  timeZone() const;
@@ -238,8 +257,14 @@ private slots:
 public:
     class GroupChat;
 
+protected:
+    void connectNotify(const QMetaMethod &signal) override;
+    void disconnectNotify(const QMetaMethod &signal) override;
+
 private:
     void cleanup();
+    bool isXmlLogged() const;
+    void updateXmlRelay();
     void distribute(const QDomElement &);
     bool distributeEncryptedCarbon(const QDomElement &);
     void distributeDecrypted(const QDomElement &, const EncryptionMetadata *metadata);
@@ -251,6 +276,19 @@ private:
 
     void sendAckRequest();
 
+    bool dispatch(const QDomElement &); // passes an incoming stanza to tasks. false if none took it
+
+    // dispatch index maintained by Task
+    friend class Task;
+    void registerWatcher(Task *);
+    void unregisterWatcher(Task *);
+    void registerIqTask(Task *, const QString &id);
+    void unregisterIqTask(Task *, const QString &id);
+    void registerPushHandler(Task *, const QString &kind, const QString &ns);
+    void unregisterPushHandler(Task *, const QString &kind, const QString &ns);
+    void addIqRoundTrip(const QString &ns, qint64 nsecs, bool error);
+    void addIqTimeout(const QString &ns);
+
     class ClientPrivate;
     ClientPrivate *d;
 };
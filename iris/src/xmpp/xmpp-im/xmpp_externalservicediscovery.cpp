@@ -26,6 +26,15 @@
 
 namespace XMPP {
 
+// expiration of restricted services is the one of their credentials, which are
+// requested and checked by credentials(). the listing itself is as good as the list
+static bool expiresWithin(const ExternalService &s, std::chrono::minutes ttl)
+{
+    if (s.restricted)
+        return false;
+    return !(s.expires.isForever() || s.expires.remainingTimeAsDuration() > ttl);
+}
+
 JT_ExternalServiceDiscovery::JT_ExternalServiceDiscovery(Task *parent) : Task(parent) { }
 
 void JT_ExternalServiceDiscovery::getServices(const QString &type)
@@ -264,55 +273,81 @@ void ExternalServiceDiscovery::services(QObject *ctx, ServicesCallback &&callbac
     // check if cache is valid (no expired or ready to expire items)
     ExternalServiceList ret;
     bool                cacheValid = true;
+    bool                stale      = servicesExpires_.remainingTimeAsDuration() < servicesTtl_ / 2;
     for (auto const &s : std::as_const(services_)) {
         if (!(types.isEmpty() || types.contains(s->type)))
             continue; // not interesting for us
-        if (!(s->expires.isForever() || s->expires.remainingTimeAsDuration() > minTtl)) {
+        if (expiresWithin(*s, minTtl)) {
             cacheValid = false;
             break;
         }
+        stale = stale || expiresWithin(*s, minTtl * 2);
         ret += s;
     }
 
-    if (cacheValid && !ret.isEmpty()) {
+    // an empty result is good too if it comes from the full list
+    if (cacheValid && (!ret.isEmpty() || !servicesExpires_.hasExpired())) {
+        if (stale)
+            refresh();
         callback(ret);
         return;
     }
 
-    if (currentTask) {
-        connect(currentTask, &Task::finished, ctx,
+    if (currentTask || types.isEmpty() || types.size() > 1) {
+        connect(refresh(), &Task::finished, ctx,
                 [this, types, cb = std::move(callback)]() { cb(cachedServices(types)); });
     } else {
-        if (types.isEmpty() || types.size() > 1) {
-            currentTask = new JT_ExternalServiceDiscovery(client_->rootTask());
-            connect(currentTask, &Task::finished, ctx, [this, types, cb = std::move(callback)]() {
-                services_   = currentTask->services();
-                currentTask = nullptr; // it will self-delete anyway
-                cb(cachedServices(types));
-            });
-            currentTask->getServices();
-            currentTask->go(true);
-        } else {
-            auto task = new JT_ExternalServiceDiscovery(client_->rootTask());
-            auto type = types[0];
-            connect(task, &Task::finished, ctx, [task, type, cb = std::move(callback), this]() {
-                for (auto const &service : std::as_const(task->services())) {
-                    auto cachedServiceIt = findCachedService({ service->host, service->type, service->port });
-                    if (cachedServiceIt != services_.end()) {
-                        **cachedServiceIt = *service;
-                    } // else we can't add to the cache coz it can make the cache incomplete. see
-                      // comment below.
-                }
-                cb(task->services());
-            });
-            task->getServices(type);
-            task->go(true);
-            // in fact we can improve caching even more if start remembering specific pveviously
-            // requested types, even if the result was negative.
-        }
+        auto task = new JT_ExternalServiceDiscovery(client_->rootTask());
+        auto type = types[0];
+        connect(task, &Task::finished, ctx, [task, type, cb = std::move(callback), this]() {
+            for (auto const &service : std::as_const(task->services())) {
+                auto cachedServiceIt = findCachedService({ service->host, service->type, service->port });
+                if (cachedServiceIt != services_.end()) {
+                    **cachedServiceIt = *service;
+                } // else we can't add to the cache coz it can make the cache incomplete. see
+                  // comment below.
+            }
+            cb(task->services());
+        });
+        task->getServices(type);
+        task->go(true);
+        // in fact we can improve caching even more if start remembering specific pveviously
+        // requested types, even if the result was negative.
     }
 }
 
+JT_ExternalServiceDiscovery *ExternalServiceDiscovery::refresh()
+{
+    if (currentTask)
+        return currentTask;
+
+    currentTask = new JT_ExternalServiceDiscovery(client_->rootTask());
+    // connected before any caller so they see the updated cache
+    connect(currentTask, &Task::finished, this, [this, task = currentTask.data()]() {
+        currentTask = nullptr; // it will self-delete anyway
+        if (!task->success())
+            return; // keep what we have
+        auto services = task->services();
+        for (auto const &service : std::as_const(services)) {
+            // keep still valid credentials we got for the same service
+            auto cachedServiceIt = findCachedService({ service->host, service->type, service->port });
+            if (service->restricted && service->password.isEmpty() && cachedServiceIt != services_.end()
+                && !(*cachedServiceIt)->password.isEmpty() && !(*cachedServiceIt)->expires.hasExpired()) {
+                service->username = (*cachedServiceIt)->username;
+                service->password = (*cachedServiceIt)->password;
+                service->expires  = (*cachedServiceIt)->expires;
+            }
+        }
+        services_        = services;
+        servicesExpires_ = QDeadlineTimer(servicesTtl_);
+    });
+    currentTask->getServices();
+    currentTask->go(true);
+    return currentTask;
+}
+
+void ExternalServiceDiscovery::setServicesTtl(std::chrono::milliseconds ttl) { servicesTtl_ = ttl; }
+
 ExternalServiceList ExternalServiceDiscovery::cachedServices(const QStringList &types)
 {
     if (types.isEmpty())
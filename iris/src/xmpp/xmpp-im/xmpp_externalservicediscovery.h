@@ -116,11 +116,17 @@ public:
      * @param callback      - callback to call when ready
      * @param minTtl        - if service expires in less than minTtl it will be re-requested
      * @param serviceTypes  - types of services to request. e.g "stun", "turn"
+     *
+     * The list of services is cached for the account, even when it has no services of the requested types.
+     * A cached list which is getting old is still returned right away and gets refreshed in the background.
      */
     void services(QObject *ctx, ServicesCallback &&callback, std::chrono::minutes minTtl = std::chrono::minutes(1),
                   const QStringList &types = QStringList());
     ExternalServiceList cachedServices(const QStringList &type = QStringList());
 
+    // how long the full list of services is trusted. pushes keep it up to date meanwhile. an hour by default
+    void setServicesTtl(std::chrono::milliseconds ttl);
+
     /**
      * @brief credentials resolves credentials for specific services
      * @param ctx           - if ctx dies, the request will be aborted
@@ -144,10 +150,13 @@ signals:
 
 private:
     ExternalServiceList::iterator findCachedService(const ExternalServiceId &id = {});
+    JT_ExternalServiceDiscovery  *refresh();
 
     Client                               *client_;
     QPointer<JT_ExternalServiceDiscovery> currentTask = nullptr; // for all services (no type)
     ExternalServiceList                   services_;
+    QDeadlineTimer                        servicesExpires_; // when the full list has to be requested again
+    std::chrono::milliseconds             servicesTtl_ = std::chrono::minutes(60);
 };
 
 } // namespace XMPP
@@ -116,6 +116,15 @@ public:
 
     class FeatureName;
 
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+    friend inline uint qHash(const Features &key, uint seed = 0)
+#else
+    friend inline size_t qHash(const Features &key, size_t seed = 0)
+#endif
+    {
+        return ::qHash(key._list, seed);
+    }
+
 private:
     QSet<QString> _list;
 };
@@ -0,0 +1,289 @@
+/*
+ * xmpp_hashpool.cpp - hashing in a few threads shared by everything
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "xmpp_hashpool.h"
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QThread>
+#include <QThreadPool>
+#include <QWaitCondition>
+
+#include <atomic>
+#include <deque>
+#include <vector>
+
+namespace XMPP {
+
+static const qint64 READ_BLOCK_SIZE   = 1024 * 1024;
+static const qint64 RUN_BUDGET        = 64 * 1024 * 1024; // then others get the thread
+static const int    PROGRESS_INTERVAL = 100;              // msecs
+
+class HashJobPrivate {
+public:
+    struct Chunk {
+        QByteArray data;
+        QString    fileName;
+        qint64     offset = 0;
+        qint64     size   = -1; // of the file part. -1 - till the end
+        bool       last   = false;
+    };
+
+    HashPool         *pool = nullptr;
+    QMutex            mutex;
+    QWaitCondition    finishedCond;
+    HashJob          *job = nullptr; // null once it's deleted
+    std::deque<Chunk> queue;
+    bool              scheduled = false;
+    bool              ended     = false; // the last chunk is queued
+    bool              finished  = false;
+    QList<Hash>       result;
+    std::atomic_bool  canceled { false };
+
+    // touched only by the runner. there is one at a time
+    std::vector<std::unique_ptr<StreamHash>> hashers;
+    QList<Hash::Type>                        types;
+    bool                                     failed = false;
+    qint64                                   hashed = 0;
+    QElapsedTimer                            sinceProgress;
+
+    // with the mutex locked
+    void schedule(const std::shared_ptr<HashJobPrivate> &self)
+    {
+        if (scheduled)
+            return;
+        scheduled = true;
+        pool->pool->start([self]() { self->run(self); });
+    }
+
+    // with the mutex locked
+    void finish(const QList<Hash> &hashes)
+    {
+        result   = hashes;
+        finished = true;
+        finishedCond.wakeAll();
+        if (job)
+            QMetaObject::invokeMethod(
+                job, [job = job]() { emit job->finished(); }, Qt::QueuedConnection);
+    }
+
+    void addHashed(qint64 bytes)
+    {
+        hashed += bytes;
+        if (sinceProgress.isValid() && !sinceProgress.hasExpired(PROGRESS_INTERVAL))
+            return;
+        sinceProgress.start();
+        QMutexLocker lock(&mutex);
+        if (job)
+            QMetaObject::invokeMethod(
+                job, [job = job, bytes = hashed]() { emit job->progress(bytes); }, Qt::QueuedConnection);
+    }
+
+    void feed(const QByteArray &data)
+    {
+        for (auto &h : hashers)
+            h->addData(data);
+        addHashed(data.size());
+    }
+
+    // hashes the file part while budget lasts. returns false if it has to come back for the rest
+    bool feedFile(Chunk &c, qint64 &budget)
+    {
+        QFile f(c.fileName);
+        if (!f.open(QIODevice::ReadOnly) || !f.seek(c.offset)) {
+            qWarning("failed to hash %s: %s", qPrintable(c.fileName), qPrintable(f.errorString()));
+            failed = true;
+            return true;
+        }
+        QByteArray buf(int(READ_BLOCK_SIZE), Qt::Uninitialized);
+        while (c.size && !canceled) {
+            if (budget <= 0)
+                return false;
+            auto sz = f.read(buf.data(), c.size < 0 ? READ_BLOCK_SIZE : qMin(c.size, READ_BLOCK_SIZE));
+            if (sz < 0 || (sz == 0 && c.size > 0)) {
+                qWarning("failed to hash %s: %s", qPrintable(c.fileName),
+                         sz ? qPrintable(f.errorString()) : "unexpected end of file");
+                failed = true;
+                return true;
+            }
+            if (sz == 0)
+                break; // till the end and it's there
+            feed(QByteArray::fromRawData(buf.constData(), int(sz)));
+            c.offset += sz;
+            if (c.size > 0)
+                c.size -= sz;
+            budget -= sz;
+        }
+        return true;
+    }
+
+    void run(const std::shared_ptr<HashJobPrivate> &self)
+    {
+        if (hashers.empty()) {
+            for (auto t : std::as_const(types))
+                hashers.push_back(std::make_unique<StreamHash>(t));
+        }
+        qint64 budget = RUN_BUDGET;
+        forever {
+            Chunk c;
+            {
+                QMutexLocker lock(&mutex);
+                if (canceled) {
+                    queue.clear();
+                    scheduled = false;
+                    if (!finished)
+                        finish({});
+                    return;
+                }
+                if (queue.empty()) {
+                    scheduled = false;
+                    return;
+                }
+                if (budget <= 0) { // let others run
+                    scheduled = false;
+                    schedule(self);
+                    return;
+                }
+                c = std::move(queue.front());
+                queue.pop_front();
+            }
+            if (!failed && !c.fileName.isEmpty() && !feedFile(c, budget)) {
+                QMutexLocker lock(&mutex);
+                queue.push_front(std::move(c)); // the rest of it next time
+                continue;
+            }
+            if (!failed && !c.data.isEmpty()) {
+                feed(c.data);
+                budget -= c.data.size();
+            }
+            if (c.last) {
+                QList<Hash> hashes;
+                if (!failed && !canceled) {
+                    for (auto &h : hashers)
+                        hashes.append(h->final());
+                }
+                QMutexLocker lock(&mutex);
+                finish(hashes);
+            }
+        }
+    }
+
+    void enqueue(const std::shared_ptr<HashJobPrivate> &self, Chunk &&c)
+    {
+        QMutexLocker lock(&mutex);
+        if (ended || canceled)
+            return;
+        ended = c.last;
+        queue.push_back(std::move(c));
+        schedule(self);
+    }
+};
+
+HashJob::HashJob(HashPool *pool, const QList<Hash::Type> &types, QObject *parent) :
+    QObject(parent), d(std::make_shared<HashJobPrivate>())
+{
+    d->pool  = pool;
+    d->job   = this;
+    d->types = types;
+}
+
+HashJob::~HashJob()
+{
+    QMutexLocker lock(&d->mutex);
+    d->job      = nullptr;
+    d->canceled = true;
+}
+
+void HashJob::addData(const QByteArray &data)
+{
+    HashJobPrivate::Chunk c;
+    c.data = data;
+    c.last = data.isEmpty();
+    d->enqueue(d, std::move(c));
+}
+
+void HashJob::addFile(const QString &fileName, qint64 offset, qint64 size)
+{
+    HashJobPrivate::Chunk c;
+    c.fileName = fileName;
+    c.offset   = offset;
+    c.size     = size;
+    d->enqueue(d, std::move(c));
+}
+
+void HashJob::cancel()
+{
+    QMutexLocker lock(&d->mutex);
+    if (d->finished)
+        return;
+    d->canceled = true;
+    if (!d->scheduled)
+        d->finish({}); // nothing runs to notice it
+}
+
+bool HashJob::isFinished() const
+{
+    QMutexLocker lock(&d->mutex);
+    return d->finished;
+}
+
+QList<Hash> HashJob::result() const
+{
+    QMutexLocker lock(&d->mutex);
+    return d->result;
+}
+
+QList<Hash> HashJob::waitForFinished()
+{
+    addData();
+    QMutexLocker lock(&d->mutex);
+    while (!d->finished)
+        d->finishedCond.wait(&d->mutex);
+    return d->result;
+}
+
+HashPool::HashPool() : pool(new QThreadPool)
+{
+    pool->setMaxThreadCount(qBound(1, QThread::idealThreadCount() / 2, 4));
+}
+
+HashPool::~HashPool() { pool->waitForDone(); }
+
+HashPool *HashPool::instance()
+{
+    static HashPool instance;
+    return &instance;
+}
+
+HashJob *HashPool::stream(const QList<Hash::Type> &types, QObject *parent) { return new HashJob(this, types, parent); }
+
+HashJob *HashPool::file(const QString &fileName, const QList<Hash::Type> &types, QObject *parent)
+{
+    auto job = stream(types, parent);
+    job->addFile(fileName);
+    job->addData();
+    return job;
+}
+
+int HashPool::maxThreadCount() const { return pool->maxThreadCount(); }
+
+void HashPool::setMaxThreadCount(int count) { pool->setMaxThreadCount(count); }
+
+} // namespace XMPP
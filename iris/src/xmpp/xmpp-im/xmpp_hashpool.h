@@ -0,0 +1,94 @@
+/*
+ * xmpp_hashpool.h - hashing in a few threads shared by everything
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef XMPP_HASHPOOL_H
+#define XMPP_HASHPOOL_H
+
+#include <iris/xmpp-im/xmpp_hash.h>
+
+#include <QList>
+#include <QObject>
+
+#include <memory>
+
+class QThreadPool;
+
+namespace XMPP {
+
+class HashJobPrivate;
+class HashPool;
+
+// Data to hash and the result of it. Created by HashPool. Signals come in the thread of the job object.
+class HashJob : public QObject {
+    Q_OBJECT
+public:
+    ~HashJob(); // cancels it
+
+    // The data is shared with the pool, not copied. An empty array means the end of the data.
+    void addData(const QByteArray &data = QByteArray());
+
+    // Adds size bytes of the file from offset (all of it if size is -1). It's read in the pool.
+    void addFile(const QString &fileName, qint64 offset = 0, qint64 size = -1);
+
+    void cancel();
+
+    bool isFinished() const;
+    // a hash per requested type in the same order. empty if canceled or a file failed to read
+    QList<Hash> result() const;
+    // ends the data if not yet and blocks till it's hashed
+    QList<Hash> waitForFinished();
+
+signals:
+    void progress(qint64 hashedBytes);
+    void finished();
+
+private:
+    friend class HashPool;
+    friend class HashJobPrivate;
+    HashJob(HashPool *pool, const QList<Hash::Type> &types, QObject *parent);
+
+    std::shared_ptr<HashJobPrivate> d;
+};
+
+// A bounded set of threads for hashing. Neither big files block the GUI thread nor every transfer gets a thread of
+// its own. Several algorithms are computed in one pass over the data, and a long job lets others run from time to
+// time, so streams of active transfers don't wait for a big file to finish.
+class HashPool {
+public:
+    static HashPool *instance();
+    ~HashPool();
+
+    // data comes with HashJob::addData() and addFile()
+    HashJob *stream(const QList<Hash::Type> &types, QObject *parent = nullptr);
+    // the whole file. the job starts right away
+    HashJob *file(const QString &fileName, const QList<Hash::Type> &types, QObject *parent = nullptr);
+
+    int  maxThreadCount() const;
+    void setMaxThreadCount(int count);
+
+private:
+    friend class HashJobPrivate;
+    HashPool();
+
+    std::unique_ptr<QThreadPool> pool;
+};
+
+} // namespace XMPP
+
+#endif // XMPP_HASHPOOL_H
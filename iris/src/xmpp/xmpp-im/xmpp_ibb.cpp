@@ -185,7 +185,7 @@ qint64 IBBConnection::writeData(const char *data, qint64 maxSize)
         return 0;
     }
 
-    ByteStream::appendWrite(QByteArray::fromRawData(data, int(maxSize)));
+    ByteStream::appendWrite(data, maxSize);
     trySend();
     return maxSize;
 }
@@ -445,6 +445,8 @@ JT_IBB::JT_IBB(Task *parent, bool serve) : Task(parent)
 {
     d        = new Private;
     d->serve = serve;
+    if (serve)
+        registerPush(QStringLiteral("iq"), QLatin1String(IBB_NS));
 }
 
 JT_IBB::~JT_IBB() { delete d; }
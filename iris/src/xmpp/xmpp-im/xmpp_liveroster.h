@@ -41,6 +41,9 @@ public:
     void    setGroupsDelimiter(const QString &groupsDelimiter);
     QString groupsDelimiter() const;
 
+    void    setVersion(const QString &version);
+    QString version() const;
+
 private:
     class Private;
     Private *d;
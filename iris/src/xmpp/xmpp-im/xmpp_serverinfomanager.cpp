@@ -23,6 +23,8 @@
 #include "xmpp_client.h"
 #include "xmpp_tasks.h"
 
+#include <QTimer>
+
 namespace XMPP {
 ServerInfoManager::ServerInfoManager(Client *client) : QObject(client), _client(client), _canMessageCarbons(false)
 {
@@ -239,8 +241,8 @@ void ServerInfoManager::appendQuery(ServiceInfoQuery *q)
     }
     if (_servicesListState == ST_NotQueried || _servicesListState == ST_Failed) {
         queryServicesList();
-    } else { // ready
-        checkPendingServiceQueries();
+    } else { // ready. all may be cached, so finish after the caller connects to the query
+        QTimer::singleShot(0, this, [this]() { checkPendingServiceQueries(); });
     }
 }
 
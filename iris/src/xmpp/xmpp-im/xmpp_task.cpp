@@ -20,8 +20,13 @@
 
 #include "xmpp_client.h"
 #include "xmpp_stanza.h"
+#include "xmpp_trafficstats.h"
 #include "xmpp_xmlcommon.h"
 
+#include <QElapsedTimer>
+#include <QList>
+#include <QPair>
+#include <QStringList>
 #include <QTimer>
 
 #define DEFAULT_TIMEOUT 120
@@ -43,6 +48,16 @@ public:
     bool                autoDelete = false;
     bool                done       = false;
     int                 timeout    = 0;
+    bool                watcher    = false; // takes stanzas before the dispatch index. see registerWatcher()
+
+    QStringList                    iqIds; // sent requests registered in the client's dispatch index
+    QList<QPair<QString, QString>> pushKeys;
+
+    // iq round trip. see Client::trafficStats()
+    QElapsedTimer started; // by go()
+    QString       iqNs;    // payload namespace of the first sent iq get/set
+    bool          timedOut     = false;
+    bool          disconnected = false;
 };
 
 Task::Task(Task *parent) : QObject(parent)
@@ -62,7 +77,18 @@ Task::Task(Client *parent, bool) : QObject(nullptr)
     connect(d->client, SIGNAL(disconnected()), SLOT(clientDisconnected()));
 }
 
-Task::~Task() { delete d; }
+Task::~Task()
+{
+    if (d->client) {
+        if (d->watcher)
+            d->client->unregisterWatcher(this);
+        for (const auto &id : std::as_const(d->iqIds))
+            d->client->unregisterIqTask(this, id);
+        for (const auto &key : std::as_const(d->pushKeys))
+            d->client->unregisterPushHandler(this, key.first, key.second);
+    }
+    delete d;
+}
 
 void Task::init()
 {
@@ -109,6 +135,7 @@ void Task::go(bool autoDelete)
             deleteLater();
         }
     } else {
+        d->started.start();
         onGo();
         if (d->timeout) {
             QTimer::singleShot(d->timeout * 1000, this, SLOT(timeoutFinished()));
@@ -123,10 +150,10 @@ bool Task::take(const QDomElement &x)
     // pass along the xml
     Task *t;
     for (QObject *obj : p) {
-        if (!obj->inherits("XMPP::Task"))
+        t = qobject_cast<Task *>(obj);
+        if (!t || t->d->watcher) // watchers have seen it already in Client::dispatch()
             continue;
 
-        t = static_cast<Task *>(obj);
         if (t->take(x)) // don't check for done here. it will hurt server tasks
             return true;
     }
@@ -170,7 +197,56 @@ void Task::onTimeout()
     }
 }
 
-void Task::send(const QDomElement &x) { client()->send(x); }
+void Task::send(const QDomElement &x)
+{
+    // remember the request so the reply is delivered directly. see Client::dispatch()
+    if (x.tagName() == QLatin1String("iq")) {
+        const QString type = x.attribute(QStringLiteral("type"));
+        const QString id   = x.attribute(QStringLiteral("id"));
+        if (!id.isEmpty() && (type == QLatin1String("get") || type == QLatin1String("set"))) {
+            client()->registerIqTask(this, id);
+            d->iqIds.append(id);
+            if (d->iqNs.isNull())
+                d->iqNs = TrafficStats::keyOf(x).second;
+        }
+    }
+    client()->send(x);
+}
+
+/**
+ * \brief registers the task as a handler of incoming stanzas of \a kind ("iq", "message", "presence")
+ * with the first child element in the namespace \a ns
+ *
+ * Such stanzas are passed to take() before the linear scan of the task tree.
+ * Long living server tasks should call this for every namespace they handle.
+ */
+void Task::registerPush(const QString &kind, const QString &ns)
+{
+    d->pushKeys.append({ kind, ns });
+    client()->registerPushHandler(this, kind, ns);
+}
+
+/**
+ * \brief makes take() see every incoming stanza before the dispatch index and the other tasks
+ *
+ * For hooks which may consume any stanza, like plugin filters. Watchers are called in the order they
+ * were registered and are skipped by the scan of the task tree.
+ */
+void Task::registerWatcher()
+{
+    if (d->watcher)
+        return;
+    d->watcher = true;
+    client()->registerWatcher(this);
+}
+
+/**
+ * \brief takes a stanza matched by registerPush() before the task tree is scanned. It's take() by default
+ *
+ * A handler sharing the namespace with other tasks should return false here for stanzas it doesn't own and
+ * answer them in take(), which is called again in the tree scan. So tasks earlier in the tree still come first.
+ */
+bool Task::takePush(const QDomElement &x) { return take(x); }
 
 void Task::setSuccess(int code, const QString &str)
 {
@@ -216,6 +292,17 @@ void Task::done()
         return;
     d->done = true;
 
+    for (const auto &id : std::as_const(d->iqIds))
+        d->client->unregisterIqTask(this, id);
+    d->iqIds.clear();
+
+    if (!d->iqNs.isNull() && d->started.isValid()) {
+        if (d->timedOut)
+            d->client->addIqTimeout(d->iqNs);
+        else if (!d->disconnected)
+            d->client->addIqRoundTrip(d->iqNs, d->started.nsecsElapsed(), !d->success);
+    }
+
     if (d->autoDelete)
         d->deleteme = true;
 
@@ -227,12 +314,18 @@ void Task::done()
         deleteLater();
 }
 
-void Task::clientDisconnected() { onDisconnect(); }
+void Task::clientDisconnected()
+{
+    d->disconnected = true;
+    onDisconnect();
+}
 
 void Task::timeoutFinished()
 {
-    if (!d->done)
+    if (!d->done) {
+        d->timedOut = true;
         onTimeout();
+    }
 }
 
 void Task::debug(const char *fmt, ...)
@@ -58,6 +58,7 @@ public:
 
     void         go(bool autoDelete = false);
     virtual bool take(const QDomElement &);
+    virtual bool takePush(const QDomElement &);
     void         safeDelete();
 
 signals:
@@ -68,6 +69,8 @@ protected:
     virtual void onDisconnect();
     virtual void onTimeout();
     void         send(const QDomElement &);
+    void         registerPush(const QString &kind, const QString &ns);
+    void         registerWatcher();
     void         setSuccess(int code = 0, const QString &str = "");
     void         setError(const QDomElement &);
     void         setError(int code = 0, const QString &str = "");
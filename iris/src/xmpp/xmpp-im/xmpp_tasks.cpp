@@ -354,6 +354,7 @@ public:
     Roster             roster;
     QString            groupsDelimiter;
     QList<QDomElement> itemList;
+    bool               upToDate = false;
 };
 
 JT_Roster::JT_Roster(Task *parent) : Task(parent)
@@ -364,12 +365,14 @@ JT_Roster::JT_Roster(Task *parent) : Task(parent)
 
 JT_Roster::~JT_Roster() { delete d; }
 
-void JT_Roster::get()
+void JT_Roster::get(const QString &version)
 {
     type = Get;
     // to = client()->host();
     iq                = createIQ(doc(), "get", to.full(), id());
     QDomElement query = doc()->createElementNS("jabber:iq:roster", "query");
+    if (!version.isNull())
+        query.setAttribute("ver", version);
     iq.appendChild(query);
 }
 
@@ -454,6 +457,8 @@ const Roster &JT_Roster::roster() const { return d->roster; }
 
 QString JT_Roster::groupsDelimiter() const { return d->groupsDelimiter; }
 
+bool JT_Roster::isUpToDate() const { return d->upToDate; }
+
 QString JT_Roster::toString() const
 {
     if (type != Set)
@@ -497,7 +502,13 @@ bool JT_Roster::take(const QDomElement &x)
     if (type == Get) {
         if (x.attribute("type") == "result") {
             QDomElement q = queryTag(x);
-            d->roster     = xmlReadRoster(q, false);
+            if (q.isNull()) {
+                // XEP-0237: the cached version is current. changes (if any) come as pushes
+                d->upToDate = true;
+            } else {
+                d->roster = xmlReadRoster(q, false);
+                d->roster.setVersion(q.attribute("ver"));
+            }
             setSuccess();
         } else {
             setError(x);
@@ -535,7 +546,10 @@ bool JT_Roster::take(const QDomElement &x)
 //----------------------------------------------------------------------------
 // JT_PushRoster
 //----------------------------------------------------------------------------
-JT_PushRoster::JT_PushRoster(Task *parent) : Task(parent) { }
+JT_PushRoster::JT_PushRoster(Task *parent) : Task(parent)
+{
+    registerPush(QStringLiteral("iq"), QStringLiteral("jabber:iq:roster"));
+}
 
 JT_PushRoster::~JT_PushRoster() { }
 
@@ -548,7 +562,11 @@ bool JT_PushRoster::take(const QDomElement &e)
     if (!iqVerify(e, client()->host(), "", "jabber:iq:roster"))
         return false;
 
-    emit roster(xmlReadRoster(queryTag(e), true));
+    QDomElement q = queryTag(e);
+    Roster      r = xmlReadRoster(q, true);
+    if (q.hasAttribute("ver"))
+        r.setVersion(q.attribute("ver"));
+    emit roster(r);
     send(createIQ(doc(), "result", e.attribute("from"), e.attribute("id")));
 
     return true;
@@ -1338,10 +1356,26 @@ int JT_EntityTime::timezoneOffset() const { return tzo; }
 //----------------------------------------------------------------------------
 // JT_ServInfo
 //----------------------------------------------------------------------------
-JT_ServInfo::JT_ServInfo(Task *parent) : Task(parent) { }
+JT_ServInfo::JT_ServInfo(Task *parent) : Task(parent)
+{
+    registerPush(QStringLiteral("iq"), QStringLiteral("jabber:iq:version"));
+    registerPush(QStringLiteral("iq"), QStringLiteral("http://jabber.org/protocol/disco#info"));
+    registerPush(QStringLiteral("iq"), QStringLiteral("urn:xmpp:time"));
+}
 
 JT_ServInfo::~JT_ServInfo() { }
 
+bool JT_ServInfo::takePush(const QDomElement &e)
+{
+    // other disco nodes may belong to tasks earlier in the tree, like ad-hoc commands. let them have it first
+    if (e.tagName() == "iq" && e.attribute("type") == "get" && queryNS(e) == "http://jabber.org/protocol/disco#info") {
+        QString node = e.firstChildElement("query").attribute("node");
+        if (!node.isEmpty() && node != client()->caps().flatten())
+            return false;
+    }
+    return take(e);
+}
+
 bool JT_ServInfo::take(const QDomElement &e)
 {
     if (e.tagName() != "iq" || e.attribute("type") != "get")
@@ -1642,7 +1676,10 @@ bool JT_DiscoPublish::take(const QDomElement &x)
 // ---------------------------------------------------------
 // JT_BoBServer
 // ---------------------------------------------------------
-JT_BoBServer::JT_BoBServer(Task *parent) : Task(parent) { }
+JT_BoBServer::JT_BoBServer(Task *parent) : Task(parent)
+{
+    registerPush(QStringLiteral("iq"), QStringLiteral("urn:xmpp:bob"));
+}
 
 bool JT_BoBServer::take(const QDomElement &e)
 {
@@ -1739,7 +1776,10 @@ BoBData &JT_BitsOfBinary::data() { return d->data; }
  * \brief Answers XMPP Pings
  */
 
-JT_PongServer::JT_PongServer(Task *parent) : Task(parent) { }
+JT_PongServer::JT_PongServer(Task *parent) : Task(parent)
+{
+    registerPush(QStringLiteral("iq"), QStringLiteral("urn:xmpp:ping"));
+}
 
 bool JT_PongServer::take(const QDomElement &e)
 {
@@ -92,7 +92,7 @@ public:
     JT_Roster(Task *parent);
     ~JT_Roster();
 
-    void get();
+    void get(const QString &version = QString()); // XEP-0237. non-null version enables versioning
     void set(const Jid &, const QString &name, const QStringList &groups);
     void remove(const Jid &);
 
@@ -102,6 +102,7 @@ public:
 
     const Roster &roster() const;
     QString       groupsDelimiter() const;
+    bool          isUpToDate() const; // the server confirmed the version passed to get(). roster() is empty
 
     QString toString() const;
     bool    fromString(const QString &);
@@ -322,6 +323,7 @@ public:
     ~JT_ServInfo();
 
     bool take(const QDomElement &);
+    bool takePush(const QDomElement &);
 };
 
 class JT_Gateway : public Task {
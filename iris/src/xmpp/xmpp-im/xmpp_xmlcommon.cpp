@@ -274,6 +274,20 @@ QDomElement addCorrectNS(const QDomElement &e)
     return i;
 }
 
+// returns true if addCorrectNS() wouldn't change anything, i.e. every element has a namespace
+// and there are no hardcoded "xmlns" attributes. Allows to skip the deep copy for such elements.
+bool hasCorrectNS(const QDomElement &e)
+{
+    static QString xmlns = QStringLiteral("xmlns");
+    if (e.namespaceURI().isEmpty() || e.hasAttribute(xmlns))
+        return false;
+    for (QDomElement c = e.firstChildElement(); !c.isNull(); c = c.nextSiblingElement()) {
+        if (!hasCorrectNS(c))
+            return false;
+    }
+    return true;
+}
+
 //----------------------------------------------------------------------------
 // XMLHelper
 //----------------------------------------------------------------------------
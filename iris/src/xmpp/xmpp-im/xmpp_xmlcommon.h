@@ -65,6 +65,7 @@ QDomElement  queryTag(const QDomElement &e);
 QString      queryNS(const QDomElement &e);
 void         getErrorFromElement(const QDomElement &e, const QString &baseNS, int *code, QString *str);
 QDomElement  addCorrectNS(const QDomElement &e);
+bool         hasCorrectNS(const QDomElement &e);
 
 namespace XMLHelper {
 
@@ -1,7 +1,8 @@
 #ifndef ZLIB_COMMON_H
 #define ZLIB_COMMON_H
 
-#define CHUNK_SIZE 1024
+// extra output space when the first estimate wasn't enough
+#define CHUNK_SIZE 16384
 
 static void initZStream(z_stream *z)
 {
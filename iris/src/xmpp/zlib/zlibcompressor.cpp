@@ -3,86 +3,55 @@
 #include "common.h"
 #include "zlib.h"
 
-#include <QIODevice>
-#include <QObject>
 #include <QtDebug>
 
-ZLibCompressor::ZLibCompressor(QIODevice *device, int compression) : device_(device)
+ZLibCompressor::ZLibCompressor(int level)
 {
-    zlib_stream_ = (z_stream *)malloc(sizeof(z_stream));
-    initZStream(zlib_stream_);
-    int result = deflateInit(zlib_stream_, compression);
+    initZStream(&zlib_stream_);
+    int result = deflateInit(&zlib_stream_, level);
     Q_ASSERT(result == Z_OK);
     Q_UNUSED(result);
-    connect(device, SIGNAL(aboutToClose()), this, SLOT(flush()));
-    flushed_ = false;
 }
 
 ZLibCompressor::~ZLibCompressor()
 {
-    flush();
-    free(zlib_stream_);
+    int result = deflateEnd(&zlib_stream_);
+    // Z_DATA_ERROR just means the stream wasn't finished. it never is for xmpp
+    if (result != Z_OK && result != Z_DATA_ERROR)
+        qWarning() << QString("compressor.c: deflateEnd failed (%1)").arg(result);
 }
 
-void ZLibCompressor::flush()
+int ZLibCompressor::compress(const QByteArray &input, QByteArray &out, int flush)
 {
-    if (flushed_)
-        return;
-
-    // Flush
-    write(QByteArray(), true);
-    int result = deflateEnd(zlib_stream_);
-    if (result != Z_OK)
-        qWarning() << QString("compressor.c: deflateEnd failed (%1)").arg(result);
+    if (finished_)
+        return Z_STREAM_ERROR;
 
-    flushed_ = true;
-}
-
-int ZLibCompressor::write(const QByteArray &input) { return write(input, false); }
+    zlib_stream_.avail_in = uInt(input.size());
+    zlib_stream_.next_in  = (Bytef *)input.data();
 
-int ZLibCompressor::write(const QByteArray &input, bool flush)
-{
+    // the bound is for a complete stream, so it covers the sync flush marker too
+    int position = int(out.size());
+    int room     = int(deflateBound(&zlib_stream_, uLong(input.size())));
     int result;
-    zlib_stream_->avail_in = uInt(input.size());
-    zlib_stream_->next_in  = (Bytef *)input.data();
-    QByteArray output;
-
-    // Write the data
-    int output_position = 0;
     do {
-        output.resize(output_position + CHUNK_SIZE);
-        zlib_stream_->avail_out = CHUNK_SIZE;
-        zlib_stream_->next_out  = (Bytef *)(output.data() + output_position);
-        result                  = deflate(zlib_stream_, (flush ? Z_FINISH : Z_NO_FLUSH));
+        out.resize(position + room);
+        zlib_stream_.avail_out = uInt(room);
+        zlib_stream_.next_out  = (Bytef *)(out.data() + position);
+        result                 = deflate(&zlib_stream_, flush);
         if (result == Z_STREAM_ERROR) {
-            qWarning() << QString("compressor.cpp: Error ('%1')").arg(zlib_stream_->msg);
+            qWarning() << QString("compressor.cpp: Error ('%1')").arg(zlib_stream_.msg);
+            out.resize(position);
             return result;
         }
-        output_position += CHUNK_SIZE;
-    } while (zlib_stream_->avail_out == 0);
-    if (zlib_stream_->avail_in != 0) {
-        qWarning("ZLibCompressor: avail_in != 0");
-    }
-    output_position -= zlib_stream_->avail_out;
+        position += room - int(zlib_stream_.avail_out);
+        room = CHUNK_SIZE;
+    } while (zlib_stream_.avail_out == 0);
+    out.resize(position);
 
-    // Flush the data
-    if (!flush) {
-        do {
-            output.resize(output_position + CHUNK_SIZE);
-            zlib_stream_->avail_out = CHUNK_SIZE;
-            zlib_stream_->next_out  = (Bytef *)(output.data() + output_position);
-            result                  = deflate(zlib_stream_, Z_SYNC_FLUSH);
-            if (result == Z_STREAM_ERROR) {
-                qWarning() << QString("compressor.cpp: Error ('%1')").arg(zlib_stream_->msg);
-                return result;
-            }
-            output_position += CHUNK_SIZE;
-        } while (zlib_stream_->avail_out == 0);
-        output_position -= zlib_stream_->avail_out;
+    if (zlib_stream_.avail_in != 0) {
+        qWarning("ZLibCompressor: avail_in != 0");
     }
-    output.resize(output_position);
-
-    // Write the compressed data
-    device_->write(output);
-    return 0;
+    if (flush == Z_FINISH)
+        finished_ = true;
+    return Z_OK;
 }
@@ -3,29 +3,26 @@
 
 #include "zlib.h"
 
-#include <QObject>
-
-class QIODevice;
-
-class ZLibCompressor : public QObject {
-    Q_OBJECT
-
+#include <QByteArray>
+
+/*
+ * Streaming deflate stage of XEP-0138 compression.
+ *
+ * The output is appended right into the given buffer, which is sized with deflateBound() once
+ * per call, so a caller reusing the same buffer doesn't reallocate it in the common case.
+ */
+class ZLibCompressor {
 public:
-    ZLibCompressor(QIODevice *device, int compression = Z_DEFAULT_COMPRESSION);
+    explicit ZLibCompressor(int level = Z_DEFAULT_COMPRESSION);
     ~ZLibCompressor();
 
-    int write(const QByteArray &);
-
-protected slots:
-    void flush();
-
-protected:
-    int write(const QByteArray &, bool flush);
+    // compresses input and appends the result to out. Z_SYNC_FLUSH makes everything
+    // compressed so far decodable by the receiver. returns Z_OK or zlib error code
+    int compress(const QByteArray &input, QByteArray &out, int flush = Z_SYNC_FLUSH);
 
 private:
-    QIODevice *device_;
-    z_stream  *zlib_stream_;
-    bool       flushed_;
+    z_stream zlib_stream_;
+    bool     finished_ = false;
 };
 
 #endif // ZLIBCOMPRESSOR_H
@@ -3,89 +3,57 @@
 #include "xmpp/zlib/common.h"
 #include "zlib.h"
 
-#include <QIODevice>
-#include <QObject>
 #include <QtDebug>
 
-ZLibDecompressor::ZLibDecompressor(QIODevice *device) : device_(device)
+ZLibDecompressor::ZLibDecompressor()
 {
-    zlib_stream_ = (z_stream *)malloc(sizeof(z_stream));
-    initZStream(zlib_stream_);
-    int result = inflateInit2(zlib_stream_, 15 + 32);
+    initZStream(&zlib_stream_);
+    int result = inflateInit2(&zlib_stream_, 15 + 32);
     Q_ASSERT(result == Z_OK);
     Q_UNUSED(result);
-    connect(device, SIGNAL(aboutToClose()), this, SLOT(flush()));
-    flushed_ = false;
 }
 
 ZLibDecompressor::~ZLibDecompressor()
 {
-    flush();
-    free(zlib_stream_);
-}
-
-void ZLibDecompressor::flush()
-{
-    if (flushed_)
-        return;
-
-    // Flush
-    write(QByteArray(), true);
-    int result = inflateEnd(zlib_stream_);
+    int result = inflateEnd(&zlib_stream_);
     if (result != Z_OK)
         qWarning() << QString("compressor.c: inflateEnd failed (%1)").arg(result);
-
-    flushed_ = true;
 }
 
-qint64 ZLibDecompressor::write(const QByteArray &input) { return write(input, false); }
-
-qint64 ZLibDecompressor::write(const QByteArray &input, bool flush)
+int ZLibDecompressor::decompress(const QByteArray &input, QByteArray &out)
 {
-    int result;
-    zlib_stream_->avail_in = uInt(input.size());
-    zlib_stream_->next_in  = (Bytef *)input.data();
-    QByteArray output;
+    if (finished_)
+        return Z_STREAM_ERROR;
 
-    // Write the data
-    int output_position = 0;
+    zlib_stream_.avail_in = uInt(input.size());
+    zlib_stream_.next_in  = (Bytef *)input.data();
+
+    // xml compresses well. start with a few times the input size
+    int position = int(out.size());
+    int room     = qMax(CHUNK_SIZE, int(input.size()) * 4);
+    int result;
     do {
-        output.resize(output_position + CHUNK_SIZE);
-        zlib_stream_->avail_out = CHUNK_SIZE;
-        zlib_stream_->next_out  = (Bytef *)(output.data() + output_position);
-        result                  = inflate(zlib_stream_, (flush ? Z_FINISH : Z_NO_FLUSH));
-        if (result == Z_STREAM_ERROR) {
-            qWarning() << QString("compressor.cpp: Error ('%1')").arg(zlib_stream_->msg);
-            return result;
+        out.resize(position + room);
+        zlib_stream_.avail_out = uInt(room);
+        zlib_stream_.next_out  = (Bytef *)(out.data() + position);
+        result                 = inflate(&zlib_stream_, Z_SYNC_FLUSH);
+        if (result == Z_STREAM_ERROR || result == Z_DATA_ERROR || result == Z_MEM_ERROR || result == Z_NEED_DICT) {
+            qWarning() << QString("compressor.cpp: Error ('%1')").arg(zlib_stream_.msg);
+            out.resize(position);
+            return result == Z_NEED_DICT ? Z_DATA_ERROR : result;
+        }
+        position += room - int(zlib_stream_.avail_out);
+        room = CHUNK_SIZE;
+    } while (zlib_stream_.avail_out == 0 && result != Z_STREAM_END);
+    out.resize(position);
+
+    if (result == Z_STREAM_END) {
+        finished_ = true;
+        if (zlib_stream_.avail_in != 0) {
+            qWarning() << "ZLibDecompressor: Unexpected state: avail_in=" << zlib_stream_.avail_in
+                       << ",avail_out=" << zlib_stream_.avail_out << ",result=" << result;
+            return Z_STREAM_ERROR;
         }
-        output_position += CHUNK_SIZE;
-    } while (zlib_stream_->avail_out == 0);
-    // Q_ASSERT(zlib_stream_->avail_in == 0);
-    if (zlib_stream_->avail_in != 0) {
-        qWarning() << "ZLibDecompressor: Unexpected state: avail_in=" << zlib_stream_->avail_in
-                   << ",avail_out=" << zlib_stream_->avail_out << ",result=" << result;
-        return Z_STREAM_ERROR; // FIXME: Should probably return 'result'
-    }
-    output_position -= zlib_stream_->avail_out;
-
-    // Flush the data
-    if (!flush) {
-        do {
-            output.resize(output_position + CHUNK_SIZE);
-            zlib_stream_->avail_out = CHUNK_SIZE;
-            zlib_stream_->next_out  = (Bytef *)(output.data() + output_position);
-            result                  = inflate(zlib_stream_, Z_SYNC_FLUSH);
-            if (result == Z_STREAM_ERROR) {
-                qWarning() << QString("compressor.cpp: Error ('%1')").arg(zlib_stream_->msg);
-                return result;
-            }
-            output_position += CHUNK_SIZE;
-        } while (zlib_stream_->avail_out == 0);
-        output_position -= zlib_stream_->avail_out;
     }
-    output.resize(output_position);
-
-    // Write the compressed data
-    device_->write(output);
-    return 0;
+    return Z_OK;
 }
@@ -3,29 +3,22 @@
 
 #include "zlib.h"
 
-#include <QObject>
-
-class QIODevice;
-
-class ZLibDecompressor : public QObject {
-    Q_OBJECT
+#include <QByteArray>
 
+/*
+ * Streaming inflate stage of XEP-0138 compression. See ZLibCompressor
+ */
+class ZLibDecompressor {
 public:
-    ZLibDecompressor(QIODevice *device);
+    ZLibDecompressor();
     ~ZLibDecompressor();
 
-    qint64 write(const QByteArray &);
-
-protected slots:
-    void flush();
-
-protected:
-    qint64 write(const QByteArray &, bool flush);
+    // decompresses input and appends the result to out. returns Z_OK or zlib error code
+    int decompress(const QByteArray &input, QByteArray &out);
 
 private:
-    QIODevice *device_;
-    z_stream  *zlib_stream_;
-    bool       flushed_;
+    z_stream zlib_stream_;
+    bool     finished_ = false;
 };
 
 #endif // ZLIBDECOMPRESSOR_H
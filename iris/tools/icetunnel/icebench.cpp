@@ -0,0 +1,665 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "icebench.h"
+
+#include <QCryptographicHash>
+#include <QHash>
+#include <QNetworkDatagram>
+#include <QRandomGenerator>
+#include <QSet>
+#include <QTimer>
+#include <QUdpSocket>
+
+#include <QtCrypto>
+
+#include <iris/ice176.h>
+#include <irisnet/noncore/stunmessage.h>
+#include <irisnet/noncore/stuntypes.h>
+#include <irisnet/noncore/stunutil.h>
+#include <irisnet/noncore/transportaddress.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdio.h>
+#include <string.h>
+
+using XMPP::Ice176;
+using XMPP::StunMessage;
+using XMPP::TransportAddress;
+namespace StunTypes = XMPP::StunTypes;
+
+// all of it lives in 127.0.0.0/8
+#define HOST_NET    1 // 127.1.<agent>.<n>: host addresses of the agents
+#define INSIDE_NET  2 // 127.2.<agent>.1: the world beyond the NAT as its agent sees it
+#define OUTSIDE_NET 3 // 127.3.<agent>.1: public mappings of the NAT
+#define SERVER_NET  4 // 127.4.0.1: STUN/TURN server, 127.4.0.2: relayed addresses
+
+static const char *natNames[] = { "none", "cone", "restricted", "symmetric" };
+
+#define TURN_REALM    "icebench"
+#define TURN_USER     "bench"
+#define TURN_PASS     "bench"
+#define TURN_LIFETIME 600
+
+static QHostAddress loopback(int net, int agent, int n)
+{
+    return QHostAddress(quint32(127 << 24 | net << 16 | agent << 8 | n));
+}
+
+static QUdpSocket *bindSocket(QObject *parent, const QHostAddress &addr)
+{
+    auto sock = new QUdpSocket(parent);
+    if (!sock->bind(addr, 0))
+        qWarning("icebench: failed to bind to %s: %s", qPrintable(addr.toString()), qPrintable(sock->errorString()));
+    return sock;
+}
+
+static TransportAddress localAddress(const QUdpSocket *sock) { return { sock->localAddress(), sock->localPort() }; }
+
+static TransportAddress senderAddress(const QNetworkDatagram &dg)
+{
+    return { dg.senderAddress(), quint16(dg.senderPort()) };
+}
+
+// NAT and access link of an agent. The agent only ever learns addresses of the inside aliases, each
+// standing for an address out there, so all of its traffic goes through here.
+class NatBox : public QObject {
+public:
+    int dropped  = 0; // by the emulated loss
+    int filtered = 0; // by the NAT
+
+    NatBox(QObject *parent, int agent, IceBench::NatType type, int loss, int delay) :
+        QObject(parent), agent(agent), type(type), loss(loss), delay(delay)
+    {
+    }
+
+    bool isMapping(const TransportAddress &addr) const { return mappingAddrs.contains(addr); }
+
+    // what the peer and the servers see of an address the agent knows. null for an unreachable host address
+    TransportAddress toPublic(const TransportAddress &addr)
+    {
+        auto it = aliasTargets.constFind(addr);
+        if (it != aliasTargets.cend())
+            return *it;
+        if ((addr.addr.toIPv4Address() >> 8) == quint32(127 << 16 | HOST_NET << 8 | agent))
+            return type == IceBench::NoNat ? mapping(addr, {})->external : TransportAddress();
+        return addr; // server reflexive and relayed addresses are public already
+    }
+
+    // the inside alias of an address out there. a private address of the peer gets a dead end
+    TransportAddress toInside(const TransportAddress &target, bool reachable = true)
+    {
+        return localAddress(alias(target, reachable));
+    }
+
+private:
+    struct Mapping {
+        QUdpSocket            *sock;
+        TransportAddress       internal;
+        TransportAddress       external;
+        QSet<TransportAddress> sentTo;
+    };
+    using MappingKey = QPair<TransportAddress, TransportAddress>;
+
+    int                                         agent;
+    IceBench::NatType                           type;
+    int                                         loss;
+    int                                         delay;
+    QHash<TransportAddress, QUdpSocket *>       aliases;      // by the address they stand for
+    QHash<TransportAddress, TransportAddress>   aliasTargets; // by the alias address
+    QHash<MappingKey, std::shared_ptr<Mapping>> mappings;
+    QSet<TransportAddress>                      mappingAddrs;
+
+    QUdpSocket *alias(const TransportAddress &target, bool reachable = true)
+    {
+        QUdpSocket *sock = aliases.value(target);
+        if (!sock) {
+            sock = bindSocket(this, loopback(INSIDE_NET, agent, 1));
+            aliases.insert(target, sock);
+            aliasTargets.insert(localAddress(sock), reachable ? target : TransportAddress());
+            connect(sock, &QUdpSocket::readyRead, this, [this, sock, target, reachable]() {
+                while (sock->hasPendingDatagrams()) {
+                    auto dg = sock->receiveDatagram();
+                    if (reachable)
+                        pass([this, from = senderAddress(dg), target, data = dg.data()]() {
+                            auto m = mapping(from, target);
+                            m->sentTo.insert(target);
+                            m->sock->writeDatagram(data, target.addr, target.port);
+                        });
+                }
+            });
+        }
+        return sock;
+    }
+
+    void pass(std::function<void()> &&deliver)
+    {
+        if (loss && QRandomGenerator::global()->bounded(100) < loss) {
+            ++dropped;
+            return;
+        }
+        if (delay)
+            QTimer::singleShot(delay, this, std::move(deliver));
+        else
+            deliver();
+    }
+
+    Mapping *mapping(const TransportAddress &internal, const TransportAddress &dest)
+    {
+        MappingKey key { internal, type == IceBench::Symmetric ? dest : TransportAddress() };
+        auto      &m = mappings[key];
+        if (m)
+            return m.get();
+
+        m.reset(new Mapping);
+        m->sock     = bindSocket(this, loopback(OUTSIDE_NET, agent, 1));
+        m->internal = internal;
+        m->external = localAddress(m->sock);
+        mappingAddrs.insert(m->external);
+        connect(m->sock, &QUdpSocket::readyRead, this, [this, m = m.get()]() {
+            while (m->sock->hasPendingDatagrams()) {
+                auto dg   = m->sock->receiveDatagram();
+                auto from = senderAddress(dg);
+                if (type >= IceBench::PortRestricted && !m->sentTo.contains(from)) {
+                    ++filtered;
+                    continue;
+                }
+                pass([this, m, from, data = dg.data()]() {
+                    alias(from)->writeDatagram(data, m->internal.addr, m->internal.port);
+                });
+            }
+        });
+        return m.get();
+    }
+};
+
+// Just enough of a STUN server and a UDP TURN server (RFC 8656) for Ice176 to gather srflx and relay
+// candidates. No nonce expiry and no allocation timeouts: a run is way shorter than a lifetime.
+class BenchServer : public QObject {
+public:
+    BenchServer(QObject *parent, const QList<NatBox *> &boxes, bool turn) : QObject(parent), boxes(boxes), turn(turn)
+    {
+        sock = bindSocket(this, loopback(SERVER_NET, 0, 1));
+        connect(sock, &QUdpSocket::readyRead, this, [this]() {
+            while (sock->hasPendingDatagrams()) {
+                auto dg = sock->receiveDatagram();
+                process(dg.data(), senderAddress(dg));
+            }
+        });
+        key = QCryptographicHash::hash(TURN_USER ":" TURN_REALM ":" TURN_PASS, QCryptographicHash::Md5);
+    }
+
+    TransportAddress address() const { return localAddress(sock); }
+
+private:
+    struct Allocation {
+        QUdpSocket                       *relay;
+        TransportAddress                  client;
+        NatBox                           *box; // to translate peer addresses from and to the client's view
+        QSet<QHostAddress>                permissions;
+        QHash<quint16, TransportAddress> channels;
+    };
+
+    QList<NatBox *>                                      boxes;
+    bool                                                 turn;
+    QUdpSocket                                          *sock;
+    QByteArray                                           key;
+    QHash<TransportAddress, std::shared_ptr<Allocation>> allocations;
+
+    void send(const QByteArray &packet, const TransportAddress &to) { sock->writeDatagram(packet, to.addr, to.port); }
+
+    void respond(const StunMessage &request, const TransportAddress &to, const QList<StunMessage::Attribute> &attrs,
+                 bool authenticated)
+    {
+        StunMessage response;
+        response.setClass(StunMessage::SuccessResponse);
+        response.setMethod(request.method());
+        response.setId(request.id());
+        response.setAttributes(attrs);
+        send(authenticated ? response.toBinary(StunMessage::MessageIntegrity | StunMessage::Fingerprint, key)
+                           : response.toBinary(StunMessage::Fingerprint),
+             to);
+    }
+
+    void respondError(const StunMessage &request, const TransportAddress &to, int code, const QString &reason)
+    {
+        StunMessage response;
+        response.setClass(StunMessage::ErrorResponse);
+        response.setMethod(request.method());
+        response.setId(request.id());
+
+        QList<StunMessage::Attribute> list;
+        list += { StunTypes::ERROR_CODE, StunTypes::createErrorCode(code, reason) };
+        if (code == StunTypes::Unauthorized) {
+            list += { StunTypes::REALM, StunTypes::createRealm(TURN_REALM) };
+            list += { StunTypes::NONCE, StunTypes::createNonce("0123456789abcdef") };
+        }
+        response.setAttributes(list);
+        if (code == StunTypes::Unauthorized)
+            send(response.toBinary(StunMessage::Fingerprint), to);
+        else
+            send(response.toBinary(StunMessage::MessageIntegrity | StunMessage::Fingerprint, key), to);
+    }
+
+    void process(const QByteArray &buf, const TransportAddress &from)
+    {
+        if (buf.size() >= 4 && (quint8(buf[0]) & 0xc0) == 0x40) { // ChannelData
+            auto a = allocations.value(from);
+            if (!a)
+                return;
+            quint16 num  = XMPP::StunUtil::read16(reinterpret_cast<const quint8 *>(buf.constData()));
+            quint16 len  = XMPP::StunUtil::read16(reinterpret_cast<const quint8 *>(buf.constData()) + 2);
+            auto    peer = a->channels.value(num);
+            if (peer.isValid() && buf.size() - 4 >= len)
+                a->relay->writeDatagram(buf.mid(4, len), peer.addr, peer.port);
+            return;
+        }
+
+        StunMessage msg = StunMessage::fromBinary(buf);
+        if (msg.isNull())
+            return;
+
+        if (msg.mclass() == StunMessage::Indication && msg.method() == StunTypes::Send) {
+            auto             a = allocations.value(from);
+            TransportAddress peer;
+            if (a
+                && StunTypes::parseXorPeerAddress(msg.attribute(StunTypes::XOR_PEER_ADDRESS), msg.magic(), msg.id(),
+                                                  peer)) {
+                peer = a->box->toPublic(peer);
+                if (a->permissions.contains(peer.addr))
+                    a->relay->writeDatagram(msg.attribute(StunTypes::DATA), peer.addr, peer.port);
+            }
+            return;
+        }
+
+        if (msg.mclass() != StunMessage::Request)
+            return;
+
+        if (msg.method() == StunTypes::Binding) {
+            auto mapped = StunTypes::createXorMappedAddress(from, msg.magic(), msg.id());
+            respond(msg, from, { { StunTypes::XOR_MAPPED_ADDRESS, mapped } }, false);
+            return;
+        }
+
+        if (!turn)
+            return;
+
+        // long-term credentials
+        if (!msg.hasAttribute(StunTypes::MESSAGE_INTEGRITY)) {
+            respondError(msg, from, StunTypes::Unauthorized, "Unauthorized");
+            return;
+        }
+        StunMessage::ConvertResult result;
+        if (StunMessage::fromBinary(buf, &result, StunMessage::MessageIntegrity | StunMessage::Fingerprint, key)
+                .isNull()) {
+            respondError(msg, from, StunTypes::Unauthorized, "Unauthorized");
+            return;
+        }
+
+        auto a = allocations.value(from);
+        if (msg.method() == StunTypes::Allocate) {
+            if (!a) { // else a retransmission
+                auto box = std::find_if(boxes.cbegin(), boxes.cend(), [&](NatBox *b) { return b->isMapping(from); });
+                if (box == boxes.cend()) {
+                    respondError(msg, from, StunTypes::Forbidden, "Not from an agent");
+                    return;
+                }
+                a.reset(new Allocation);
+                a->relay  = bindSocket(this, loopback(SERVER_NET, 0, 2));
+                a->client = from;
+                a->box    = *box;
+                allocations.insert(from, a);
+                connect(a->relay, &QUdpSocket::readyRead, this, [this, a = a.get()]() { relay_readyRead(a); });
+            }
+            respond(msg, from,
+                    { { StunTypes::XOR_RELAYED_ADDRESS,
+                        StunTypes::createXorRelayedAddress(localAddress(a->relay), msg.magic(), msg.id()) },
+                      { StunTypes::XOR_MAPPED_ADDRESS, StunTypes::createXorMappedAddress(from, msg.magic(), msg.id()) },
+                      { StunTypes::LIFETIME, StunTypes::createLifetime(TURN_LIFETIME) } },
+                    true);
+            return;
+        }
+
+        if (!a) {
+            respondError(msg, from, StunTypes::AllocationMismatch, "Allocation Mismatch");
+            return;
+        }
+
+        switch (msg.method()) {
+        case StunTypes::Refresh: {
+            quint32 lifetime = TURN_LIFETIME;
+            StunTypes::parseLifetime(msg.attribute(StunTypes::LIFETIME), &lifetime);
+            lifetime = qMin(lifetime, quint32(TURN_LIFETIME));
+            respond(msg, from, { { StunTypes::LIFETIME, StunTypes::createLifetime(lifetime) } }, true);
+            if (!lifetime) {
+                a->relay->deleteLater();
+                allocations.remove(from);
+            }
+            return;
+        }
+        case StunTypes::CreatePermission: {
+            const auto attrs = msg.attributes();
+            for (const auto &attr : attrs) {
+                TransportAddress peer;
+                if (attr.type == StunTypes::XOR_PEER_ADDRESS
+                    && StunTypes::parseXorPeerAddress(attr.value, msg.magic(), msg.id(), peer))
+                    a->permissions.insert(a->box->toPublic(peer).addr);
+            }
+            break;
+        }
+        case StunTypes::ChannelBind: {
+            quint16          num;
+            TransportAddress peer;
+            if (!StunTypes::parseChannelNumber(msg.attribute(StunTypes::CHANNEL_NUMBER), &num)
+                || !StunTypes::parseXorPeerAddress(msg.attribute(StunTypes::XOR_PEER_ADDRESS), msg.magic(), msg.id(),
+                                                   peer)) {
+                respondError(msg, from, StunTypes::BadRequest, "Bad Request");
+                return;
+            }
+            peer = a->box->toPublic(peer);
+            a->channels.insert(num, peer);
+            a->permissions.insert(peer.addr);
+            break;
+        }
+        default:
+            respondError(msg, from, StunTypes::BadRequest, "Bad Request");
+            return;
+        }
+        respond(msg, from, {}, true);
+    }
+
+    void relay_readyRead(Allocation *a)
+    {
+        while (a->relay->hasPendingDatagrams()) {
+            auto dg   = a->relay->receiveDatagram();
+            auto from = senderAddress(dg);
+            if (!a->permissions.contains(from.addr))
+                continue;
+
+            const QByteArray data = dg.data();
+            const quint16    num  = a->channels.key(from, 0);
+            if (num) {
+                QByteArray packet(4 + ((data.size() + 3) & ~3), '\0'); // padded like over a stream, TurnClient wants it
+                XMPP::StunUtil::write16(reinterpret_cast<quint8 *>(packet.data()), num);
+                XMPP::StunUtil::write16(reinterpret_cast<quint8 *>(packet.data()) + 2, quint16(data.size()));
+                memcpy(packet.data() + 4, data.constData(), size_t(data.size()));
+                send(packet, a->client);
+                continue;
+            }
+
+            StunMessage message;
+            message.setClass(StunMessage::Indication);
+            message.setMethod(StunTypes::Data);
+            QByteArray id(12, Qt::Uninitialized);
+            QRandomGenerator::global()->fillRange(reinterpret_cast<quint32 *>(id.data()), 3);
+            message.setId(reinterpret_cast<const quint8 *>(id.constData()));
+            message.setAttributes({ { StunTypes::XOR_PEER_ADDRESS,
+                                      StunTypes::createXorPeerAddress(a->box->toInside(from), message.magic(),
+                                                                      message.id()) },
+                                    { StunTypes::DATA, data } });
+            send(message.toBinary(), a->client);
+        }
+    }
+};
+
+// One connectivity establishment between two fresh agents
+class BenchRun : public QObject {
+public:
+    std::function<void(const IceBench::Result &)> resultReady;
+
+    BenchRun(QObject *parent, const IceBench &opts) : QObject(parent), opts(opts)
+    {
+        timeout.setSingleShot(true);
+        timeout.setInterval(opts.opt_pacTimeout + 2000);
+        connect(&timeout, &QTimer::timeout, this, [this]() { finish(false); });
+    }
+
+    void start()
+    {
+        for (int i = 0; i < 2; ++i)
+            agents[i].box = new NatBox(this, i, opts.opt_nat[i], opts.opt_loss, opts.opt_delay);
+        if (opts.opt_servers != IceBench::NoServers)
+            server = new BenchServer(this, { agents[0].box, agents[1].box }, opts.opt_servers == IceBench::Turn);
+
+        Ice176::Features features = Ice176::Trickle | Ice176::NotNominatedData | Ice176::GatheringComplete;
+        if (opts.opt_aggressive)
+            features |= Ice176::AggressiveNomination;
+
+        for (int i = 0; i < 2; ++i) {
+            Agent &a = agents[i];
+            a.ice    = new Ice176(this);
+
+            QList<Ice176::LocalAddress> addrs;
+            for (int n = 0; n < opts.opt_hosts; ++n) {
+                Ice176::LocalAddress la;
+                la.addr    = loopback(HOST_NET, i, n + 1);
+                la.network = n;
+                addrs += la;
+            }
+            a.ice->setLocalAddresses(addrs);
+            a.ice->setComponentCount(opts.opt_channels);
+            a.ice->setLocalFeatures(features);
+            a.ice->setRemoteFeatures(features);
+            a.ice->setCheckInterval(opts.opt_checkInterval);
+            a.ice->setPacTimeout(opts.opt_pacTimeout);
+            a.ice->setNominationTimeout(opts.opt_nominationTimeout);
+            a.ice->setUseStunRelayTcp(false);
+            if (server) {
+                auto addr = a.box->toInside(server->address());
+                a.ice->setStunBindService(addr.addr, addr.port);
+                if (opts.opt_servers == IceBench::Turn)
+                    a.ice->setStunRelayUdpService(addr.addr, addr.port, TURN_USER, QByteArray(TURN_PASS));
+            }
+
+            connect(a.ice, &Ice176::started, this, [this, i]() {
+                agents[i].started = true;
+                if (agents[1 - i].started)
+                    accept();
+            });
+            connect(a.ice, &Ice176::localCandidatesReady, this, [this, i](const QList<Ice176::Candidate> &list) {
+                agents[i].candidates += list.count();
+                toPeer(1 - i, [this, i, list = translate(i, list)]() { agents[1 - i].ice->addRemoteCandidates(list); });
+            });
+            connect(a.ice, &Ice176::localGatheringComplete, this,
+                    [this, i]() { toPeer(1 - i, [this, i]() { agents[1 - i].ice->setRemoteGatheringComplete(); }); });
+            connect(a.ice, &Ice176::iceFinished, this, [this, i]() {
+                agents[i].finished = true;
+                if (agents[1 - i].finished)
+                    finish(true);
+            });
+            connect(a.ice, &Ice176::error, this, [this]() { finish(false); });
+        }
+
+        timeout.start();
+        agents[0].ice->start(Ice176::Initiator);
+        agents[1].ice->start(Ice176::Responder);
+    }
+
+private:
+    struct Agent {
+        Ice176                      *ice        = nullptr;
+        NatBox                      *box        = nullptr;
+        bool                         started    = false;
+        bool                         finished   = false;
+        int                          candidates = 0;
+        QList<std::function<void()>> pending; // signalling before the session is accepted
+    };
+
+    const IceBench &opts;
+    Agent           agents[2];
+    BenchServer    *server   = nullptr;
+    bool            accepted = false;
+    QTimer          timeout;
+
+    // the addresses of a candidate as the peer sees them
+    QList<Ice176::Candidate> translate(int from, QList<Ice176::Candidate> list)
+    {
+        for (auto &c : list) {
+            TransportAddress addr { c.ip, quint16(c.port) };
+            auto             pub    = agents[from].box->toPublic(addr);
+            auto             inside = agents[1 - from].box->toInside(pub.isValid() ? pub : addr, pub.isValid());
+            c.ip                    = inside.addr;
+            c.port                  = inside.port;
+        }
+        return list;
+    }
+
+    // like over the signalling server
+    void toPeer(int to, std::function<void()> &&deliver)
+    {
+        QTimer::singleShot(opts.opt_signalDelay, this, [this, to, deliver = std::move(deliver)]() {
+            if (accepted)
+                deliver();
+            else
+                agents[to].pending += deliver;
+        });
+    }
+
+    // both sides are started, so exchange the credentials and go
+    void accept()
+    {
+        accepted = true;
+        for (int i = 0; i < 2; ++i) {
+            auto peer = agents[1 - i].ice;
+            agents[i].ice->setRemoteCredentials(peer->localUfrag(), peer->localPassword());
+        }
+        for (int i = 0; i < 2; ++i) {
+            for (const auto &deliver : std::as_const(agents[i].pending))
+                deliver();
+            agents[i].pending.clear();
+            agents[i].ice->startChecks();
+        }
+    }
+
+    void finish(bool connected)
+    {
+        if (!resultReady)
+            return; // the other agent failed too
+        timeout.stop();
+
+        const auto s0 = agents[0].ice->stats();
+        const auto s1 = agents[1].ice->stats();
+
+        IceBench::Result r;
+        r.connected  = connected;
+        r.firstCheck = s0.firstCheck == -1 || s1.firstCheck == -1 ? qMax(s0.firstCheck, s1.firstCheck)
+                                                                  : qMin(s0.firstCheck, s1.firstCheck);
+        if (connected) {
+            r.ready     = qMax(s0.readyToSendMedia, s1.readyToSendMedia);
+            r.nominated = qMax(s0.finished, s1.finished);
+        }
+        r.checksSent   = s0.checksSent + s1.checksSent;
+        r.pairsChecked = s0.pairsChecked + s1.pairsChecked;
+
+        if (connected)
+            printf("nominated in %lld ms, ready in %lld ms", r.nominated, r.ready);
+        else
+            printf("FAILED");
+        printf(", first check %lld ms, candidates %d+%d, pairs %d+%d, checks %d+%d, dropped %d, filtered %d\n",
+               r.firstCheck, agents[0].candidates, agents[1].candidates, s0.pairsChecked, s1.pairsChecked,
+               s0.checksSent, s1.checksSent, agents[0].box->dropped + agents[1].box->dropped,
+               agents[0].box->filtered + agents[1].box->filtered);
+
+        for (auto &a : agents)
+            a.ice->disconnect(this);
+        auto done   = std::move(resultReady);
+        resultReady = nullptr;
+        done(r);
+    }
+};
+
+IceBench::IceBench() { }
+
+IceBench::~IceBench() { delete run; }
+
+IceBench::NatType IceBench::natFromString(const QString &s, bool *ok)
+{
+    for (int n = 0; n < int(sizeof(natNames) / sizeof(natNames[0])); ++n) {
+        if (s == QLatin1String(natNames[n])) {
+            *ok = true;
+            return NatType(n);
+        }
+    }
+    *ok = false;
+    return NoNat;
+}
+
+void IceBench::start()
+{
+    // macOS only has 127.0.0.1 on lo0
+    QUdpSocket probe;
+    if (!probe.bind(loopback(HOST_NET, 0, 1), 0)) {
+        printf("Unable to bind to %s. The bench needs all of 127.0.0.0/8 on the loopback interface.\n",
+               qPrintable(loopback(HOST_NET, 0, 1).toString()));
+        emit quit();
+        return;
+    }
+
+    printf("NAT %s/%s, %s, %d host address(es), %d channel(s), loss %d%%, delay %d ms, Ta %d ms\n",
+           natNames[opt_nat[0]], natNames[opt_nat[1]],
+           opt_servers == NoServers ? "no servers" : (opt_servers == Stun ? "STUN" : "STUN and TURN"), opt_hosts,
+           opt_channels, opt_loss, opt_delay, opt_checkInterval);
+    nextRun();
+}
+
+void IceBench::nextRun()
+{
+    if (run) {
+        run->deleteLater();
+        run = nullptr;
+    }
+    if (results.count() == opt_runs) {
+        report();
+        emit quit();
+        return;
+    }
+
+    printf("run %d: ", int(results.count()) + 1);
+    fflush(stdout);
+    run              = new BenchRun(nullptr, *this);
+    run->resultReady = [this](const Result &r) {
+        results += r;
+        QTimer::singleShot(0, this, &IceBench::nextRun);
+    };
+    run->start();
+}
+
+void IceBench::report()
+{
+    auto show = [this](const char *name, std::function<qint64(const Result &)> value) {
+        QList<qint64> values;
+        for (const auto &r : std::as_const(results))
+            if (r.connected)
+                values += value(r);
+        if (values.isEmpty())
+            return;
+        std::sort(values.begin(), values.end());
+        printf("%-12s %8lld %8lld %8lld\n", name, values.first(), values.at(values.count() / 2), values.last());
+    };
+
+    int connected = int(std::count_if(results.cbegin(), results.cend(), [](const Result &r) { return r.connected; }));
+    printf("\nconnected in %d of %d runs\n", connected, int(results.count()));
+    printf("%-12s %8s %8s %8s\n", "", "min", "median", "max");
+    show("first check", [](const Result &r) { return r.firstCheck; });
+    show("ready", [](const Result &r) { return r.ready; });
+    show("nominated", [](const Result &r) { return r.nominated; });
+    show("pairs", [](const Result &r) { return qint64(r.pairsChecked); });
+    show("checks sent", [](const Result &r) { return qint64(r.checksSent); });
+}
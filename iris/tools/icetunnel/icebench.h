@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026  Psi Team
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ICEBENCH_H
+#define ICEBENCH_H
+
+#include <QList>
+#include <QObject>
+
+class BenchRun;
+
+// Runs an initiator and a responder Ice176 in one process and measures how long it takes them to
+// get to nominated pairs. Each agent sits behind an emulated NAT box, which also adds loss and delay
+// to its access link, and may use a local STUN/TURN stand-in. Everything goes over 127.0.0.0/8, so
+// agents, NAT sides and the server get addresses of their own. Needs Linux for that.
+class IceBench : public QObject {
+    Q_OBJECT
+
+public:
+    enum NatType {
+        NoNat,          // host candidates are public
+        FullCone,       // endpoint independent mapping and filtering
+        PortRestricted, // endpoint independent mapping, address and port dependent filtering
+        Symmetric       // a mapping per destination
+    };
+
+    enum Servers { NoServers, Stun, Turn };
+
+    NatType opt_nat[2]            = { NoNat, NoNat }; // initiator, responder
+    Servers opt_servers           = Stun;
+    int     opt_runs              = 10;
+    int     opt_hosts             = 1; // host addresses per agent
+    int     opt_channels          = 1;
+    int     opt_loss              = 0;  // percent, each way on each access link
+    int     opt_delay             = 0;  // msecs, each way on each access link
+    int     opt_signalDelay       = 50; // msecs for candidates to get to the peer
+    int     opt_checkInterval     = 20;
+    int     opt_pacTimeout        = 30000;
+    int     opt_nominationTimeout = 3000;
+    bool    opt_aggressive        = false;
+
+    IceBench();
+    ~IceBench();
+
+    static NatType natFromString(const QString &s, bool *ok);
+
+public slots:
+    void start();
+
+signals:
+    void quit();
+
+private:
+    friend class BenchRun;
+
+    struct Result {
+        bool   connected    = false;
+        qint64 firstCheck   = -1;
+        qint64 ready        = -1;
+        qint64 nominated    = -1;
+        int    checksSent   = 0;
+        int    pairsChecked = 0;
+    };
+
+    BenchRun     *run = nullptr;
+    QList<Result> results;
+
+    void nextRun();
+    void report();
+};
+
+#endif // ICEBENCH_H
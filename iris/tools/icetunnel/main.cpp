@@ -17,11 +17,14 @@
  */
 
 #include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QNetworkAddressEntry>
 #include <QNetworkInterface>
 #include <QTimer>
 #include <QUdpSocket>
 
+#include "icebench.h"
+
 #include <QtCrypto>
 #ifdef QCA_STATIC
 #include <QtPlugin>
@@ -34,6 +37,8 @@ Q_IMPORT_PLUGIN(qca_ossl)
 #include <iris/netnames.h>
 #include <iris/processquit.h>
 #include <iris/udpportreserver.h>
+#include <irisnet/noncore/icelocaltransport.h>
+#include <memory>
 #include <stdio.h>
 
 // scope values: 0 = local, 1 = link-local, 2 = private, 3 = public
@@ -827,8 +832,7 @@ private Q_SLOTS:
         delete prompt;
         prompt = 0;
 
-        ice->setPeerUfrag(inOffer.user);
-        ice->setPeerPassword(inOffer.pass);
+        ice->setRemoteCredentials(inOffer.user, inOffer.pass);
         ice->addRemoteCandidates(inOffer.candidates);
         ice->startChecks();
     }
@@ -891,11 +895,96 @@ private Q_SLOTS:
     }
 };
 
+// Blasts datagrams over loopback at a local transport and reports how fast its receive path takes
+// them. Sending goes in bursts from the same thread, so each readyRead finds a burst to drain,
+// like a busy media stream does. Compare with IRIS_NO_RECVMMSG=1 for the datagram by datagram path.
+class PacketRateBench : public QObject {
+    Q_OBJECT
+
+public:
+    int opt_packets = 200000;
+    int opt_size    = 1200; // typical RTP/SCTP payload
+    int opt_burst   = 64;
+
+    void start()
+    {
+        transport.reset(new XMPP::IceLocalTransport);
+        connect(transport.get(), &XMPP::IceTransport::started, this, &PacketRateBench::transport_started);
+        connect(transport.get(), &XMPP::IceTransport::readyRead, this, &PacketRateBench::transport_readyRead);
+        transport->start(QHostAddress(QHostAddress::LocalHost));
+    }
+
+signals:
+    void quit();
+
+private:
+    std::unique_ptr<XMPP::IceLocalTransport> transport;
+    QUdpSocket                               sender;
+    QByteArray                               payload;
+    QElapsedTimer                            clock;
+    QTimer                                   idle;
+    int                                      sent          = 0;
+    int                                      received      = 0;
+    int                                      notifications = 0;
+
+    void sendBurst()
+    {
+        const auto &to = transport->localAddress();
+        for (int n = 0; n < opt_burst && sent < opt_packets; ++n, ++sent)
+            sender.writeDatagram(payload, to.addr, to.port);
+        if (sent < opt_packets)
+            QTimer::singleShot(0, this, &PacketRateBench::sendBurst);
+    }
+
+    void transport_started()
+    {
+        payload = QByteArray(opt_size, 'x');
+        sender.bind(QHostAddress(QHostAddress::LocalHost), 0);
+        // the rest is lost if nothing comes for a while
+        idle.setSingleShot(true);
+        idle.setInterval(500);
+        connect(&idle, &QTimer::timeout, this, &PacketRateBench::finish);
+        idle.start();
+        clock.start();
+        sendBurst();
+    }
+
+    void transport_readyRead(int path)
+    {
+        ++notifications;
+        XMPP::TransportAddress from;
+        while (transport->hasPendingDatagrams(path)) {
+            transport->readDatagram(path, from);
+            ++received;
+        }
+        if (received == opt_packets)
+            finish();
+        else
+            idle.start();
+    }
+
+    void finish()
+    {
+        qint64 usecs = clock.nsecsElapsed() / 1000;
+        if (received < opt_packets) // waited for the lost ones in vain
+            usecs -= idle.interval() * 1000;
+        idle.stop();
+        printf("%d/%d datagrams of %d bytes in %.3f ms (%d lost)\n", received, opt_packets, opt_size,
+               usecs / 1000.0, opt_packets - received);
+        printf("%.0f datagrams/s, %.1f MB/s, %.1f datagrams per readyRead\n", received * 1e6 / usecs,
+               double(received) * opt_size / usecs, notifications ? double(received) / notifications : 0.0);
+        transport->disconnect(this);
+        emit quit();
+    }
+};
+
 void usage()
 {
     printf("icetunnel: create a peer-to-peer UDP tunnel based on ICE\n");
     printf("usage: icetunnel initiator (options)\n");
     printf("       icetunnel responder (options)\n");
+    printf("       icetunnel pktrate (--packets=[n]) (--size=[n]) (--burst=[n])\n");
+    printf("       icetunnel bench (options)\n");
     printf("\n");
     printf(" --localbase=[n]     local base port (default=60000)\n");
     printf(" --icebase=[n]       ICE base port (default=0 (None))\n");
@@ -909,6 +998,27 @@ void usage()
     printf(" --relay-udp-only    only offer UDP relay candidate\n");
     printf(" --relay-tcp-only    only offer TCP relay candidate\n");
     printf("\n");
+    printf("pktrate measures the local transport receive path over loopback:\n");
+    printf(" --packets=[n]       datagrams to send (default=200000)\n");
+    printf(" --size=[n]          datagram size (default=1200)\n");
+    printf(" --burst=[n]         datagrams sent per event loop iteration (default=64)\n");
+    printf("Set IRIS_NO_RECVMMSG=1 to compare with reading datagram by datagram.\n");
+    printf("\n");
+    printf("bench connects two agents in this process over emulated NATs on 127.0.0.0/8 (Linux)\n");
+    printf("and reports times to the first check and to nomination. --channels applies too.\n");
+    printf(" --runs=[n]          connectivity establishments to measure (default=10)\n");
+    printf(" --nat=[type(,type)] none, cone, restricted or symmetric. a second type is for\n");
+    printf("                     the responder (default=none)\n");
+    printf(" --servers=[type]    none, stun or turn, for the local stand-in (default=stun)\n");
+    printf(" --hosts=[n]         host addresses per agent (default=1)\n");
+    printf(" --loss=[n]          percent of datagrams lost on each access link (default=0)\n");
+    printf(" --delay=[n]         msecs each way on each access link (default=0)\n");
+    printf(" --signal-delay=[n]  msecs for candidates to get to the peer (default=50)\n");
+    printf(" --ta=[n]            msecs between connectivity checks (default=20)\n");
+    printf(" --pac=[n]           Patiently Awaiting Connectivity timeout in msecs (default=30000)\n");
+    printf(" --nomination=[n]    msecs to wait for better pairs before nomination (default=3000)\n");
+    printf(" --aggressive        use aggressive nomination\n");
+    printf("\n");
 }
 
 int main(int argc, char **argv)
@@ -931,6 +1041,10 @@ int main(int argc, char **argv)
     bool                 relay_udp_only = false;
     bool                 relay_tcp_only = false;
     bool                 enable_dtls    = true;
+    int                  packets        = 200000;
+    int                  size           = 1200;
+    int                  burst          = 64;
+    IceBench             bench;
 
     for (int n = 0; n < args.count(); ++n) {
         QString s = args[n];
@@ -985,6 +1099,50 @@ int main(int argc, char **argv)
             relay_tcp_only = true;
         else if (var == "dtls")
             enable_dtls = true;
+        else if (var == "packets")
+            packets = val.toInt();
+        else if (var == "size")
+            size = qBound(1, val.toInt(), 65507);
+        else if (var == "burst")
+            burst = qMax(1, val.toInt());
+        else if (var == "runs")
+            bench.opt_runs = qMax(1, val.toInt());
+        else if (var == "nat") {
+            const auto types = val.split(',');
+            bool       ok    = types.count() <= 2;
+            for (int i = 0; i < 2 && ok; ++i)
+                bench.opt_nat[i] = IceBench::natFromString(types.value(i, types.first()), &ok);
+            if (!ok) {
+                usage();
+                return 1;
+            }
+        } else if (var == "servers") {
+            if (val == "none")
+                bench.opt_servers = IceBench::NoServers;
+            else if (val == "stun")
+                bench.opt_servers = IceBench::Stun;
+            else if (val == "turn")
+                bench.opt_servers = IceBench::Turn;
+            else {
+                usage();
+                return 1;
+            }
+        } else if (var == "hosts")
+            bench.opt_hosts = qBound(1, val.toInt(), 254);
+        else if (var == "loss")
+            bench.opt_loss = qBound(0, val.toInt(), 100);
+        else if (var == "delay")
+            bench.opt_delay = qMax(0, val.toInt());
+        else if (var == "signal-delay")
+            bench.opt_signalDelay = qMax(0, val.toInt());
+        else if (var == "ta")
+            bench.opt_checkInterval = qMax(1, val.toInt());
+        else if (var == "pac")
+            bench.opt_pacTimeout = qMax(1, val.toInt());
+        else if (var == "nomination")
+            bench.opt_nominationTimeout = qMax(0, val.toInt());
+        else if (var == "aggressive")
+            bench.opt_aggressive = true;
         else
             known = false;
 
@@ -1012,17 +1170,40 @@ int main(int argc, char **argv)
         mode = 0;
     else if (args[0] == "responder")
         mode = 1;
+    else if (args[0] == "pktrate")
+        mode = 2;
+    else if (args[0] == "bench")
+        mode = 3;
 
     if (mode == -1) {
         usage();
         return 1;
     }
 
+    if (mode == 2) {
+        PacketRateBench bench;
+        bench.opt_packets = packets;
+        bench.opt_size    = size;
+        bench.opt_burst   = burst;
+        QObject::connect(&bench, &PacketRateBench::quit, &qapp, &QCoreApplication::quit);
+        QTimer::singleShot(0, &bench, &PacketRateBench::start);
+        qapp.exec();
+        return 0;
+    }
+
     if (!QCA::isSupported("hmac(sha1)")) {
         printf("Error: Need hmac(sha1) support.\n");
         return 1;
     }
 
+    if (mode == 3) {
+        bench.opt_channels = channels;
+        QObject::connect(&bench, &IceBench::quit, &qapp, &QCoreApplication::quit);
+        QTimer::singleShot(0, &bench, &IceBench::start);
+        qapp.exec();
+        return 0;
+    }
+
     App app;
     app.opt_mode           = mode;
     app.opt_localBase      = localBase;
@@ -54,6 +54,7 @@ class ContactListAccountMenu::Private : public QObject {
     QAction           *serviceDiscoveryAction_;
     QAction           *newMessageAction_;
     QAction           *xmlConsoleAction_;
+    QAction           *trafficStatsAction_;
     QAction           *privacyListsAction_;
     QAction           *modifyAccountAction_;
     QMenu             *adminMenu_;
@@ -125,6 +126,9 @@ public:
         xmlConsoleAction_ = new IconAction(tr("&XMPP Console"), this, "psi/xml");
         connect(xmlConsoleAction_, SIGNAL(triggered()), SLOT(xmlConsole()));
 
+        trafficStatsAction_ = new IconAction(tr("&Traffic Statistics"), this, "psi/xml");
+        connect(trafficStatsAction_, SIGNAL(triggered()), SLOT(trafficStats()));
+
         modifyAccountAction_ = new IconAction(tr("&Modify Account..."), this, "psi/account");
         connect(modifyAccountAction_, SIGNAL(triggered()), SLOT(modifyAccount()));
 
@@ -162,6 +166,7 @@ public:
         menu->addAction(privacyListsAction_);
         menu->addSeparator();
         menu->addAction(xmlConsoleAction_);
+        menu->addAction(trafficStatsAction_);
         menu->addSeparator();
         menu->addAction(modifyAccountAction_);
 
@@ -377,6 +382,14 @@ private slots:
         account->showXmlConsole();
     }
 
+    void trafficStats()
+    {
+        if (!account)
+            return;
+
+        account->showTrafficStats();
+    }
+
     void modifyAccount()
     {
         if (!account)
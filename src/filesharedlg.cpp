@@ -63,12 +63,19 @@ FileShareDlg::FileShareDlg(PsiAccount *acc, const XMPP::Jid &myJid, const QList<
         QFileInfo fi(pi->fileName());
         auto      tr = filesModel->addTransfer(MultiFileTransferModel::Outgoing, fi.fileName(), quint64(fi.size()));
         tr->setThumbnail(pi->thumbnail(QSize(64, 64)));
-        if (pi->isPublished()) {
+        if (pi->isHashing()) {
+            tr->setState(MultiFileTransferModel::Pending, FileShareDlg::tr("Calculating checksum..."));
+            connect(pi, &FileSharingItem::hashProgress, this,
+                    [tr](qint64 hashedBytes) { tr->setCurrentSize(quint64(hashedBytes)); });
+            connect(pi, &FileSharingItem::hashed, this, [this, pi, tr]() { itemHashed(pi, tr); });
+            hashingCount++;
+        } else if (pi->isPublished()) {
             tr->setCurrentSize(quint64(fi.size()));
             tr->setState(MultiFileTransferModel::Done);
         }
         tr->setProperty("publisher", QVariant::fromValue<FileSharingItem *>(pi));
     }
+    shareBtn->setDisabled(hashingCount > 0); // nothing to refer to without checksums
 
     QImage preview;
     if (items.count() > 1 || (preview = items[0]->preview(this->screen()->geometry().size() / 2)).isNull()) {
@@ -95,12 +102,31 @@ void FileShareDlg::showImage(const QImage &img)
     ui->pixmapRatioLabel->show();
 }
 
+void FileShareDlg::itemHashed(FileSharingItem *publisher, MultiFileTransferItem *item)
+{
+    item->setCurrentSize(0);
+    if (publisher->sums().isEmpty()) {
+        item->setState(MultiFileTransferModel::Failed, tr("Failed to calculate checksum"));
+        item->setProperty("publisher", QVariant()); // nothing to publish
+    } else if (publisher->isPublished()) {
+        item->setState(MultiFileTransferModel::Done);
+        if (item->fullSize())
+            item->setCurrentSize(*item->fullSize());
+    } else {
+        item->setState(MultiFileTransferModel::Pending);
+    }
+    if (!--hashingCount)
+        ui->buttonBox->button(QDialogButtonBox::Apply)->setEnabled(true);
+}
+
 void FileShareDlg::publish()
 {
     ui->buttonBox->button(QDialogButtonBox::Apply)->setDisabled(true);
     QList<FileSharingItem *> toPublish;
     filesModel->forEachTransfer([this, &toPublish](MultiFileTransferItem *item) {
         auto publisher = item->property("publisher").value<FileSharingItem *>();
+        if (!publisher)
+            return; // failed to hash
         if (publisher->isPublished()) {
             item->setState(MultiFileTransferModel::Done);
             if (item->fullSize()) {
@@ -26,6 +26,7 @@
 #include <QDialog>
 
 class FileSharingItem;
+class MultiFileTransferItem;
 class MultiFileTransferModel;
 class PsiAccount;
 class QMimeData;
@@ -56,6 +57,7 @@ private slots:
 
 private:
     void showImage(const QImage &img);
+    void itemHashed(FileSharingItem *publisher, MultiFileTransferItem *item);
     void finish();
 
     Ui::FileShareDlg        *ui;
@@ -66,6 +68,7 @@ private:
     QList<FileSharingItem *> readyPublishers;
     Callback                 publishedCallback;
     int                      inProgressCount = 0;
+    int                      hashingCount    = 0;
     bool                     hasFailures     = false;
 };
 
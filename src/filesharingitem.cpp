@@ -23,6 +23,7 @@
 #include "fileutil.h"
 #include "iris/httpfileupload.h"
 #include "iris/xmpp_client.h"
+#include "iris/xmpp_hashpool.h"
 #include "iris/xmpp_reference.h"
 #include "iris/xmpp_thumbs.h"
 #include "psiaccount.h"
@@ -112,17 +113,22 @@ FileSharingItem::FileSharingItem(const QString &fileName, PsiAccount *acc, FileS
     if (!file.open(QIODevice::ReadOnly))
         return;
 
-    auto h = Hash::from(Hash::Sha1, &file);
-    if (!h.isValid())
-        return;
-
-    _sums.append(h);
-
-    if (!initFromCache()) {
-        file.seek(0);
-        _fileSize = quint64(file.size());
-        _mimeType = QMimeDatabase().mimeTypeForFileNameAndData(fileName, &file).name();
-    }
+    _fileSize = quint64(file.size());
+    _mimeType = QMimeDatabase().mimeTypeForFileNameAndData(fileName, &file).name();
+
+    // big files take a while. hash in the pool and let the user look at the progress meanwhile
+    _hashJob = HashPool::instance()->file(fileName, { Hash::Sha1 }, this);
+    connect(_hashJob, &HashJob::progress, this, &FileSharingItem::hashProgress);
+    connect(_hashJob, &HashJob::finished, this, [this]() {
+        _sums = _hashJob->result();
+        _hashJob->deleteLater();
+        _hashJob = nullptr;
+        if (_sums.isEmpty())
+            qWarning("failed to hash %s", qPrintable(_fileName));
+        else
+            initFromCache();
+        emit hashed();
+    });
 }
 
 FileSharingItem::FileSharingItem(const QString &mime, const QByteArray &data, const QVariantMap &metaData,
@@ -31,6 +31,7 @@ class FileSharingManager;
 class PsiAccount;
 
 namespace XMPP {
+class HashJob;
 class Jid;
 class MediaSharing;
 class Reference;
@@ -96,6 +97,8 @@ public:
     XMPP::Reference toReference(const XMPP::Jid &selfJid) const;
     void            publish(const XMPP::Jid &myJid);
     inline bool     isPublished() const { return _flags & HttpFinished && _flags & JingleFinished; }
+    // a local file is hashed in background. hashed() is emitted when done, with empty sums() on failure
+    inline bool     isHashing() const { return _hashJob != nullptr; }
 
     /**
      * @brief FileSharingItem::download starts downloading SIMS
@@ -118,6 +121,8 @@ private:
     bool initFromCache(FileCacheItem *cache = nullptr);
 
 signals:
+    void hashProgress(qint64 hashedBytes);
+    void hashed();
     void publishFinished();
     void publishProgress(size_t transferredBytes);
     void downloadFinished();
@@ -139,6 +144,7 @@ private:
     QVariantMap                  _metaData;
     QStringList                  _log;
     QList<XMPP::Jid>             _jids;
+    XMPP::HashJob               *_hashJob = nullptr;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(FileSharingItem::Flags)
@@ -56,6 +56,19 @@ public:
         for (auto const &v : item->sums())
             items.insert(v, item); // TODO ensure we don't overwrite
     }
+
+    // local files are hashed in background and can be found by their sums only after that
+    void rememberWhenHashed(FileSharingItem *item)
+    {
+        if (!item->isHashing()) {
+            rememberItem(item);
+            return;
+        }
+        QObject::connect(item, &FileSharingItem::hashed, item, [this, item]() {
+            if (item->sums().size())
+                rememberItem(item);
+        });
+    }
 };
 
 FileSharingManager::FileSharingManager(QObject *parent) : QObject(parent), d(new Private)
@@ -173,9 +186,11 @@ QList<FileSharingItem *> FileSharingManager::createFromMimeData(const QMimeData
     } else {
         for (auto const &f : files) {
             auto item = new FileSharingItem(f, acc, this);
-            if (!item->sums().count())
-                continue; // failed to calculate checksum. permissions problem?
-            d->rememberItem(item);
+            if (!item->isHashing() && !item->sums().count()) {
+                delete item;
+                continue; // failed to open. permissions problem?
+            }
+            d->rememberWhenHashed(item);
             ret.append(item);
         }
     }
@@ -192,7 +207,11 @@ QList<FileSharingItem *> FileSharingManager::fromFilesList(const QStringList &fi
         QFileInfo fi(file);
         if (fi.isFile() && fi.isReadable()) {
             auto item = new FileSharingItem(file, acc, this);
-            d->rememberItem(item);
+            if (!item->isHashing() && !item->sums().count()) {
+                delete item;
+                continue;
+            }
+            d->rememberWhenHashed(item);
             ret << item;
         }
     }
@@ -31,6 +31,7 @@
 #include "eventnotifier.h"
 #include "geolocationdlg.h"
 #include "globalstatusmenu.h"
+#include "iris/netnames.h"
 #include "iris/xmpp_serverinfomanager.h"
 #include "mainwin_p.h"
 #include "mooddlg.h"
@@ -283,6 +284,7 @@ void MainWin::Private::updateMenu(const QStringList &actions, QMenu *menu)
             QMenu *diagMenu = new QMenu(tr("Diagnostics"), menu);
             getAction("help_diag_qcaplugin")->addTo(diagMenu);
             getAction("help_diag_qcakeystore")->addTo(diagMenu);
+            getAction("help_diag_dnscache")->addTo(diagMenu);
             menu->addMenu(diagMenu);
             continue;
         }
@@ -501,6 +503,7 @@ MainWin::MainWin(bool _onTop, bool _asTool, PsiCon *psi) :
     helpMenu->addMenu(diagMenu);
     d->getAction("help_diag_qcaplugin")->addTo(diagMenu);
     d->getAction("help_diag_qcakeystore")->addTo(diagMenu);
+    d->getAction("help_diag_dnscache")->addTo(diagMenu);
     if (AvCallManager::isSupported()) {
         helpMenu->addSeparator();
         d->getAction("help_about_psimedia")->addTo(helpMenu);
@@ -683,6 +686,7 @@ void MainWin::registerAction(IconAction *action)
     cd(QStringLiteral("help_about_qt"), &IconAction::triggered, this, &MainWin::actAboutQtActivated);
     cd(QStringLiteral("help_diag_qcaplugin"), &IconAction::triggered, this, &MainWin::actDiagQCAPluginActivated);
     cd(QStringLiteral("help_diag_qcakeystore"), &IconAction::triggered, this, &MainWin::actDiagQCAKeyStoreActivated);
+    cd(QStringLiteral("help_diag_dnscache"), &IconAction::triggered, this, &MainWin::actDiagDnsCacheActivated);
     // clang-format on
 
     auto connectReverse = [action](const QString &actionName, auto src, auto signal, auto slot, bool checked) {
@@ -1039,6 +1043,15 @@ void MainWin::actDiagQCAKeyStoreActivated()
     w->show();
 }
 
+void MainWin::actDiagDnsCacheActivated()
+{
+    QString      dtext = XMPP::NetNames::cacheDiagnosticText();
+    ShowTextDlg *w     = new ShowTextDlg(dtext, true, false, this);
+    w->setWindowTitle(CAP(tr("DNS Cache")));
+    w->resize(560, 240);
+    w->show();
+}
+
 void MainWin::actChooseStatusActivated()
 {
     PsiOptions        *o = PsiOptions::instance();
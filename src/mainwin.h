@@ -137,6 +137,7 @@ private slots:
     void actEnableGroupsActivated(bool);
     void actDiagQCAPluginActivated();
     void actDiagQCAKeyStoreActivated();
+    void actDiagDnsCacheActivated();
     void actChooseStatusActivated();
     void actReconnectActivated();
     void actSetMoodActivated();
@@ -31,6 +31,7 @@
 #include "multifiletransferitem.h"
 #include "multifiletransfermodel.h"
 #include "networkaccessmanager.h"
+#include "partialdownload.h"
 #include "psiaccount.h"
 #include "psicon.h"
 #include "psicontact.h"
@@ -42,6 +43,7 @@
 #include <QDragLeaveEvent>
 #include <QDragMoveEvent>
 #include <QDropEvent>
+#include <QElapsedTimer>
 #include <QFileDialog>
 #include <QFileIconProvider>
 #include <QFileInfo>
@@ -50,8 +52,17 @@
 #include <QNetworkReply>
 #include <QPainter>
 
+#include <algorithm>
+#include <memory>
+
 using namespace XMPP;
 
+// files this large go in parallel ranges to peers which can put them together
+static const qint64 PARALLEL_MIN_SIZE = 64 * 1024 * 1024;
+static const int    PARALLEL_STREAMS  = 4;
+
+static const int PARTIAL_SAVE_INTERVAL = 2000; // msecs
+
 class MultiFileTransferDlg::Private {
 public:
     PsiAccount                     *account;
@@ -157,6 +168,22 @@ static void setMFTItemStateFromJingleState(MultiFileTransferItem *item, Jingle::
     item->setState(state, comment);
 }
 
+// parallel and resumed ranges write to the same file, each at its offset
+static void setIncomingDevice(Jingle::FileTransfer::Application *app, const QString &fn, quint64 offset, bool inPlace)
+{
+    auto f = new QFile(fn, app);
+    // WriteOnly truncates what other ranges have written
+    if (f->open(inPlace ? QIODevice::ReadWrite : QIODevice::WriteOnly)) {
+        auto size = app->file().size();
+        if (inPlace && size && quint64(f->size()) != *size)
+            f->resize(qint64(*size)); // the first one allocates it all
+        f->seek(qint64(offset));
+        app->setDevice(f);
+    } else {
+        qWarning("failed to open %s", qPrintable(f->errorString()));
+    }
+}
+
 void MultiFileTransferDlg::initOutgoing(const XMPP::Jid &jid, const QStringList &fileList)
 {
     d->peer       = jid;
@@ -212,34 +239,52 @@ void MultiFileTransferDlg::initOutgoing(const XMPP::Jid &jid, const QStringList
     });
 }
 
-void MultiFileTransferDlg::setupCommonSignals(Jingle::FileTransfer::Application *app, MultiFileTransferItem *item)
+void MultiFileTransferDlg::setupCommonSignals(const QList<Jingle::FileTransfer::Application *> &parts,
+                                              MultiFileTransferItem *item)
 {
-    item->setProperty("jingle", QVariant::fromValue<Jingle::FileTransfer::Application *>(app));
-    app->setProperty("mftitem", QVariant::fromValue<MultiFileTransferItem *>(item));
-    connect(app, &Jingle::FileTransfer::Application::stateChanged, item, [this, app, item](Jingle::State state) {
-        if (state == Jingle::State::Accepted) {
-            item->setOffset(quint64(app->acceptFile().range().offset));
-        }
-        setMFTItemStateFromJingleState(item, app);
-        if (state == Jingle::State::Finished && app->senders() == Jingle::negateOrigin(d->session->role())) {
-            // transfer has just finished and we were the receiving side.
-            // if it was the last finished transfer xep recommends us to send session.terminate
-            connect(item, &MultiFileTransferItem::openDirRequested, this,
-                    [item]() { FileUtil::openFolder(item->filePath()); });
-            bool hasUnfinished = false;
-            for (auto &c : d->session->contentList()) {
-                if (c->state() != Jingle::State::Finished) {
-                    hasUnfinished = true;
-                    break;
-                }
+    item->setProperty("jingle", QVariant::fromValue<Jingle::FileTransfer::Application *>(parts.first()));
+    // with parallel ranges the item follows the one behind the others and shows the sum of their progress
+    auto done = std::make_shared<QHash<Jingle::FileTransfer::Application *, quint64>>();
+    for (auto part : parts) {
+        part->setProperty("mftitem", QVariant::fromValue<MultiFileTransferItem *>(item));
+        connect(part, &Jingle::FileTransfer::Application::stateChanged, item, [this, parts, item](Jingle::State state) {
+            auto app = *std::min_element(parts.begin(), parts.end(),
+                                         [](auto a, auto b) { return a->state() < b->state(); });
+            if (state == Jingle::State::Accepted && parts.size() == 1) {
+                item->setOffset(quint64(app->acceptFile().range().offset));
             }
-            if (!hasUnfinished) {
-                // ready to terminate
-                d->session->terminate(Jingle::Reason::Condition::Success);
+            setMFTItemStateFromJingleState(item, app);
+            if (state == Jingle::State::Finished && app->state() == Jingle::State::Finished
+                && app->senders() == Jingle::negateOrigin(d->session->role())) {
+                // transfer has just finished and we were the receiving side.
+                // if it was the last finished transfer xep recommends us to send session.terminate
+                connect(item, &MultiFileTransferItem::openDirRequested, this,
+                        [item]() { FileUtil::openFolder(item->filePath()); });
+                bool hasUnfinished = false;
+                for (auto &c : d->session->contentList()) {
+                    if (c->state() != Jingle::State::Finished) {
+                        hasUnfinished = true;
+                        break;
+                    }
+                }
+                if (!hasUnfinished) {
+                    // ready to terminate
+                    d->session->terminate(Jingle::Reason::Condition::Success);
+                }
             }
+        });
+        if (parts.size() == 1) {
+            connect(part, &Jingle::FileTransfer::Application::progress, item, &MultiFileTransferItem::setCurrentSize);
+            continue;
         }
-    });
-    connect(app, &Jingle::FileTransfer::Application::progress, item, &MultiFileTransferItem::setCurrentSize);
+        connect(part, &Jingle::FileTransfer::Application::progress, item, [part, item, done](quint64 offset) {
+            (*done)[part] = offset - part->file().range().offset; // a resumed one got something before
+            quint64 sum   = 0;
+            for (auto bytes : std::as_const(*done))
+                sum += bytes;
+            item->setCurrentSize(sum);
+        });
+    }
 }
 
 void MultiFileTransferDlg::initIncoming(XMPP::Jingle::Session *session)
@@ -249,25 +294,27 @@ void MultiFileTransferDlg::initIncoming(XMPP::Jingle::Session *session)
     d->peer = session->peer();
     updatePeerVisuals();
     ui->buttonBox->button(QDialogButtonBox::Apply)->setText(tr("Receive"));
+    QList<Jingle::FileTransfer::Application *> apps;
     for (const auto &c : session->contentList()) {
         if (c->creator() == Jingle::Origin::Initiator && c->pad()->ns() == Jingle::FileTransfer::NS) {
-            auto app  = static_cast<Jingle::FileTransfer::Application *>(c);
-            auto file = app->file();
-            auto item = d->model->addTransfer(MultiFileTransferModel::Incoming, file.name(),
-                                              file.size()); // FIXME ranges?
-            setupCommonSignals(app, item);
-
-            auto thumb = file.thumbnail();
-            if (!thumb.uri.isEmpty()) {
-                auto loader = new BinaryUriLoader(d->account, d->peer, thumb.uri);
-                connect(loader, &BinaryUriLoader::ready, item, [item](const QByteArray &ba) {
-                    if (ba.isEmpty())
-                        return;
-                    QPixmap p;
-                    p.loadFromData(ba);
-                    item->setThumbnail(QIcon(p));
-                });
-            }
+            apps.append(static_cast<Jingle::FileTransfer::Application *>(c));
+        }
+    }
+    for (const auto &parts : Jingle::FileTransfer::groupRanges(apps)) {
+        auto file = parts.first()->file();
+        auto item = d->model->addTransfer(MultiFileTransferModel::Incoming, file.name(), file.size());
+        setupCommonSignals(parts, item);
+
+        auto thumb = file.thumbnail();
+        if (!thumb.uri.isEmpty()) {
+            auto loader = new BinaryUriLoader(d->account, d->peer, thumb.uri);
+            connect(loader, &BinaryUriLoader::ready, item, [item](const QByteArray &ba) {
+                if (ba.isEmpty())
+                    return;
+                QPixmap p;
+                p.loadFromData(ba);
+                item->setThumbnail(QIcon(p));
+            });
         }
     }
     connect(ui->buttonBox->button(QDialogButtonBox::Apply), &QPushButton::pressed, this, [this]() {
@@ -279,12 +326,80 @@ void MultiFileTransferDlg::initIncoming(XMPP::Jingle::Session *session)
                 appToAccept.append(static_cast<Jingle::FileTransfer::Application *>(it.value()));
             }
         }
-        if (appToAccept.size() > 1) {
+        auto setDestination = [this](const QList<Jingle::FileTransfer::Application *> &parts, const QString &fn) {
+            auto item = parts.first()->property("mftitem").value<MultiFileTransferItem *>();
+            if (item)
+                item->setFileName(fn);
+
+            // what an interrupted attempt left there is asked only for the rest
+            auto file    = parts.first()->file();
+            auto partial = std::make_shared<PartialDownload>(PartialDownload::load(fn));
+            bool resume  = file.isRangeSupported() && partial->matches(d->peer, file);
+            if (!resume)
+                *partial = PartialDownload(fn, d->peer, d->session->sid(), file);
+            // progress is the position of buffered devices. what's recorded has to be in the file already
+            auto save = [parts, partial]() {
+                for (auto part : parts) {
+                    if (auto f = qobject_cast<QFile *>(part->device()))
+                        f->flush();
+                }
+                partial->save();
+            };
+            auto saved = std::make_shared<QElapsedTimer>();
+            for (auto app : parts) {
+                auto    range  = app->file().range();
+                quint64 length = range.length ? range.length : file.size().value_or(0) - range.offset;
+                // at least a byte is left, as an empty range would mean everything
+                quint64 have = resume && length ? qMin(partial->received(range.offset, length), length - 1) : 0;
+                if (have) {
+                    auto f = app->file();
+                    f.setRange(Jingle::FileTransfer::Range(range.offset + have, length - have));
+                    app->setAcceptFile(f);
+                    if (item)
+                        item->setInfo(tr("Continues an interrupted download"));
+                }
+                connect(app, &Jingle::FileTransfer::Application::deviceRequested, this,
+                        [fn, app, inPlace = parts.size() > 1 || have](quint64 offset, std::optional<quint64> size) {
+                            Q_UNUSED(size)
+                            setIncomingDevice(app, fn, offset, inPlace);
+                        });
+                connect(app, &Jingle::FileTransfer::Application::progress, this,
+                        [app, partial, saved, save](quint64 offset) {
+                            auto start = app->file().range().offset;
+                            partial->setReceived(start, offset - start);
+                            if (!saved->isValid() || saved->hasExpired(PARTIAL_SAVE_INTERVAL)) {
+                                save();
+                                saved->start();
+                            }
+                        });
+                connect(app, &Jingle::FileTransfer::Application::stateChanged, this,
+                        [parts, partial, save](Jingle::State state) {
+                            if (state != Jingle::State::Finished)
+                                return;
+                            bool succeeded = true, corrupted = false;
+                            for (auto part : parts) {
+                                if (part->state() != Jingle::State::Finished) {
+                                    save(); // the others may still fail
+                                    return;
+                                }
+                                auto cond = part->lastReason().condition();
+                                succeeded = succeeded && cond == Jingle::Reason::Condition::Success;
+                                corrupted = corrupted || cond == Jingle::Reason::Condition::MediaError;
+                            }
+                            if (succeeded || corrupted) // checksum mismatch. no point to continue it
+                                partial->remove();
+                            else
+                                save();
+                        });
+            }
+        };
+        auto files = Jingle::FileTransfer::groupRanges(appToAccept);
+        if (files.size() > 1) {
             auto dirName = FileUtil::getSaveDirName(this, tr("Directory to save files"));
             if (!dirName.isEmpty()) {
                 QDir d(dirName);
-                for (auto app : appToAccept) {
-                    auto      fn = d.absoluteFilePath(FileUtil::cleanFileName(app->file().name()));
+                for (const auto &parts : std::as_const(files)) {
+                    auto      fn = d.absoluteFilePath(FileUtil::cleanFileName(parts.first()->file().name()));
                     QFileInfo fi(fn);
                     if (fi.dir() != d) { // in case it has .. or something like this
                         fn = d.absoluteFilePath(fi.fileName());
@@ -293,45 +408,19 @@ void MultiFileTransferDlg::initIncoming(XMPP::Jingle::Session *session)
                     if (fi.exists()) {
                         // TODO suggest overwrite
                     }
-                    auto item = app->property("mftitem").value<MultiFileTransferItem *>();
-                    if (item)
-                        item->setFileName(fn);
-                    connect(app, &Jingle::FileTransfer::Application::deviceRequested, this,
-                            [fn, app](quint64 offset, std::optional<quint64> size) {
-                                auto f = new QFile(fn, app);
-                                if (f->open(QIODevice::WriteOnly)) {
-                                    f->seek(qint64(offset));
-                                    Q_UNUSED(size)
-                                    app->setDevice(f);
-                                } else {
-                                    qWarning("failed to open %s", qPrintable(f->errorString()));
-                                }
-                            });
+                    setDestination(parts, fn);
                 }
             }
-        } else if (appToAccept.size()) {
-            auto app = appToAccept.first();
-            auto fn  = FileUtil::getSaveFileName(this, tr("Save As"), FileUtil::cleanFileName(app->file().name()),
-                                                 tr("All files (*)"));
+        } else if (files.size()) {
+            auto fn = FileUtil::getSaveFileName(this, tr("Save As"),
+                                                FileUtil::cleanFileName(files.first().first()->file().name()),
+                                                tr("All files (*)"));
             if (!fn.isEmpty()) {
                 QFileInfo fi(fn);
                 if (fi.exists()) {
                     // TODO suggest overwrite
                 }
-                auto item = app->property("mftitem").value<MultiFileTransferItem *>();
-                if (item)
-                    item->setFileName(fn);
-                connect(app, &Jingle::FileTransfer::Application::deviceRequested, this,
-                        [fn, app](quint64 offset, std::optional<quint64> size) {
-                            auto f = new QFile(fn, app);
-                            if (f->open(QIODevice::WriteOnly)) {
-                                f->seek(qint64(offset));
-                                Q_UNUSED(size);
-                                app->setDevice(f);
-                            } else {
-                                qWarning("failed to open %s", qPrintable(f->errorString()));
-                            }
-                        });
+                setDestination(files.first(), fn);
             }
         }
         d->session->accept();
@@ -366,19 +455,6 @@ void MultiFileTransferDlg::addTransferContent(MultiFileTransferItem *item)
         return;
     }
 
-    connect(app, &Jingle::FileTransfer::Application::deviceRequested, item,
-            [app, item](quint64 offset, std::optional<quint64> size) {
-                auto f = new QFile(item->filePath(), app);
-                if (f->open(QIODevice::ReadOnly)) {
-                    f->seek(qint64(offset));
-                    app->setDevice(f);
-                    Q_UNUSED(size);
-                } else {
-                    qWarning("failed to open %s", qPrintable(f->errorString()));
-                }
-            });
-    setupCommonSignals(app, item);
-
     // take thumbnail
     XMPP::Thumbnail thumb;
     auto            icon = item->thumbnail();
@@ -391,9 +467,28 @@ void MultiFileTransferDlg::addTransferContent(MultiFileTransferItem *item)
         p.save(&buffer, "PNG");
         thumb = XMPP::Thumbnail(ba, "image/png", quint32(p.width()), quint32(p.height()));
     }
-    app->setFile(QFileInfo { item->filePath() }, item->description(), thumb);
-
-    d->session->addContent(app);
+    QFileInfo fi(item->filePath());
+    app->setFile(fi, item->description(), thumb);
+
+    QList<Jingle::FileTransfer::Application *> parts { app };
+    if (fi.size() >= PARALLEL_MIN_SIZE && d->session->peerFeatures().test(Jingle::FileTransfer::PARALLEL_NS))
+        parts = app->splitToRanges(PARALLEL_STREAMS);
+    for (auto part : parts) {
+        connect(part, &Jingle::FileTransfer::Application::deviceRequested, item,
+                [part, item](quint64 offset, std::optional<quint64> size) {
+                    auto f = new QFile(item->filePath(), part);
+                    if (f->open(QIODevice::ReadOnly)) {
+                        f->seek(qint64(offset));
+                        part->setDevice(f);
+                        Q_UNUSED(size);
+                    } else {
+                        qWarning("failed to open %s", qPrintable(f->errorString()));
+                    }
+                });
+    }
+    setupCommonSignals(parts, item);
+    for (auto part : parts)
+        d->session->addContent(part);
 }
 
 void MultiFileTransferDlg::appendOutgoing(const QStringList &fileList)
@@ -77,7 +77,8 @@ private:
     void addTransferContent(MultiFileTransferItem *item);
     void appendOutgoing(const QStringList &fileList);
     void setupSessionSignals();
-    void setupCommonSignals(XMPP::Jingle::FileTransfer::Application *app, MultiFileTransferItem *item);
+    void setupCommonSignals(const QList<XMPP::Jingle::FileTransfer::Application *> &parts,
+                            MultiFileTransferItem *item);
 
 private:
     Ui::MultiFileTransferDlg *ui;
@@ -0,0 +1,134 @@
+/*
+ * partialdownload.cpp - what is already received of an interrupted incoming file
+ * Copyright (C) 2026  Psi Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "partialdownload.h"
+
+#include "applicationinfo.h"
+#include "iris/xmpp_jid.h"
+#include "profiles.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+
+using namespace XMPP::Jingle::FileTransfer;
+
+PartialDownload::PartialDownload(const QString &fileName, const XMPP::Jid &peer, const QString &sid,
+                                 const File &file) :
+    _fileName(fileName), _peer(peer.bare()), _sid(sid), _name(file.name()), _size(file.size().value_or(0)),
+    _hash(file.hash().toString()), _date(file.date().toString(Qt::ISODate))
+{
+}
+
+QString PartialDownload::path(const QString &fileName)
+{
+    auto key = QCryptographicHash::hash(QFileInfo(fileName).absoluteFilePath().toUtf8(), QCryptographicHash::Sha1);
+    return pathToProfile(activeProfile, ApplicationInfo::DataLocation) + QLatin1String("/partial/")
+        + QString::fromLatin1(key.toHex()) + QLatin1String(".json");
+}
+
+PartialDownload PartialDownload::load(const QString &fileName)
+{
+    QFile f(path(fileName));
+    if (!f.open(QIODevice::ReadOnly))
+        return {};
+    auto o = QJsonDocument::fromJson(f.readAll()).object();
+    if (o.value(QLatin1String("file")).toString() != QFileInfo(fileName).absoluteFilePath())
+        return {};
+
+    PartialDownload pd;
+    pd._fileName = fileName;
+    pd._peer     = o.value(QLatin1String("peer")).toString();
+    pd._sid      = o.value(QLatin1String("sid")).toString();
+    pd._name     = o.value(QLatin1String("name")).toString();
+    pd._size     = o.value(QLatin1String("size")).toString().toULongLong();
+    pd._hash     = o.value(QLatin1String("hash")).toString();
+    pd._date     = o.value(QLatin1String("date")).toString();
+
+    // Nothing beyond the end of the file is there, whatever we thought before. That only catches a truncated
+    // file though, as parallel and resumed ones are allocated in full. The ranges themselves are trusted since
+    // they are saved only after the data is flushed to the file.
+    quint64 onDisk = quint64(QFileInfo(fileName).size());
+    for (const auto &v : o.value(QLatin1String("ranges")).toArray()) {
+        auto    r      = v.toObject();
+        quint64 offset = r.value(QLatin1String("offset")).toString().toULongLong();
+        quint64 length = r.value(QLatin1String("length")).toString().toULongLong();
+        if (offset < onDisk)
+            pd._ranges.insert(offset, qMin(length, onDisk - offset));
+    }
+    return pd;
+}
+
+bool PartialDownload::matches(const XMPP::Jid &peer, const File &file) const
+{
+    return isValid() && !_ranges.isEmpty() && _peer == peer.bare() && _name == file.name()
+        && _size == file.size().value_or(0) && _hash == file.hash().toString()
+        && _date == file.date().toString(Qt::ISODate);
+}
+
+quint64 PartialDownload::received(quint64 offset, quint64 length) const
+{
+    for (auto it = _ranges.cbegin(); it != _ranges.cend(); ++it) {
+        if (it.key() <= offset && offset < it.key() + it.value())
+            return qMin(it.key() + it.value() - offset, length);
+    }
+    return 0;
+}
+
+void PartialDownload::setReceived(quint64 offset, quint64 length)
+{
+    auto &r = _ranges[offset];
+    r       = qMax(r, length);
+}
+
+bool PartialDownload::save() const
+{
+    QDir(pathToProfile(activeProfile, ApplicationInfo::DataLocation)).mkpath(QLatin1String("partial"));
+
+    QJsonArray ranges;
+    for (auto it = _ranges.cbegin(); it != _ranges.cend(); ++it) {
+        // as strings. doubles aren't precise enough for big files
+        ranges.append(QJsonObject { { QLatin1String("offset"), QString::number(it.key()) },
+                                    { QLatin1String("length"), QString::number(it.value()) } });
+    }
+    QJsonObject o { { QLatin1String("file"), QFileInfo(_fileName).absoluteFilePath() },
+                    { QLatin1String("peer"), _peer },
+                    { QLatin1String("sid"), _sid },
+                    { QLatin1String("name"), _name },
+                    { QLatin1String("size"), QString::number(_size) },
+                    { QLatin1String("hash"), _hash },
+                    { QLatin1String("date"), _date },
+                    { QLatin1String("ranges"), ranges } };
+
+    QSaveFile f(path(_fileName));
+    if (!f.open(QIODevice::WriteOnly) || f.write(QJsonDocument(o).toJson(QJsonDocument::Compact)) < 0
+        || !f.commit()) {
+        qWarning("failed to save partial download state of %s: %s", qPrintable(_fileName),
+                 qPrintable(f.errorString()));
+        return false;
+    }
+    return true;
+}
+
+void PartialDownload::remove() const { QFile::remove(path(_fileName)); }
@@ -0,0 +1,66 @@
+/*
+ * partialdownload.h - what is already received of an interrupted incoming file
+ * Copyright (C) 2026  Psi Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PARTIALDOWNLOAD_H
+#define PARTIALDOWNLOAD_H
+
+#include "iris/xmpp-im/jingle-file.h"
+
+#include <QMap>
+#include <QString>
+
+namespace XMPP {
+class Jid;
+}
+
+// Remembers which ranges of a file got to the disk, so when the peer offers the same file again only the rest
+// is requested. Kept in the profile as one JSON file per destination until the transfer succeeds.
+// Flush the file before save(), so nothing is recorded which is not in it.
+class PartialDownload {
+public:
+    PartialDownload() = default;
+    PartialDownload(const QString &fileName, const XMPP::Jid &peer, const QString &sid,
+                    const XMPP::Jingle::FileTransfer::File &file);
+
+    static PartialDownload load(const QString &fileName);
+
+    inline bool isValid() const { return !_fileName.isEmpty(); }
+    bool        matches(const XMPP::Jid &peer, const XMPP::Jingle::FileTransfer::File &file) const;
+
+    // how much of [offset, offset + length) is there from its start
+    quint64 received(quint64 offset, quint64 length) const;
+    void    setReceived(quint64 offset, quint64 length);
+
+    bool save() const;
+    void remove() const;
+
+private:
+    QString                _fileName; // destination
+    QString                _peer;     // bare jid
+    QString                _sid;      // of the last attempt. informational
+    QString                _name;
+    quint64                _size = 0;
+    QString                _hash; // as offered. may be just a type
+    QString                _date;
+    QMap<quint64, quint64> _ranges; // offset -> length
+
+    static QString path(const QString &fileName);
+};
+
+#endif // PARTIALDOWNLOAD_H
@@ -55,7 +55,10 @@
  */
 class PluginManager::StreamWatcher : public XMPP::Task {
 public:
-    StreamWatcher(Task *t, PluginManager *m, int a) : Task(t), manager(m), account(a) { }
+    StreamWatcher(Task *t, PluginManager *m, int a) : Task(t), manager(m), account(a)
+    {
+        registerWatcher(); // plugins may filter any stanza before the tasks handling it
+    }
     bool take(const QDomElement &e) { return manager->incomingXml(account, e); }
     void onDisconnect()
     {
@@ -376,15 +376,7 @@ void UserAccount::toOptions(OptionsTree *o, QString base)
         qFatal("unknown allow_plain enum value in UserAccount::toOptions");
     }
 
-    int idx = 0;
-    for (const RosterItem &ri : std::as_const(roster)) {
-        QString rbase = base + ".roster-cache.a" + QString::number(idx++);
-        o->setOption(rbase + ".jid", ri.jid().full());
-        o->setOption(rbase + ".name", ri.name());
-        o->setOption(rbase + ".subscription", ri.subscription().toString());
-        o->setOption(rbase + ".ask", ri.ask());
-        o->setOption(rbase + ".groups", ri.groups());
-    }
+    // the roster itself is saved by PsiAccount to a separate file. see RosterCache
 
     // now we check for redundant entries
     QStringList   groupList;
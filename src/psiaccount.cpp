@@ -100,10 +100,13 @@
 #include "iris/xmpp_encryption.h"
 #include "iris/xmpp_forwarding.h"
 #include "iris/xmpp_serverinfomanager.h"
+#include "iris/xmpp_streamcapture.h"
 #include "iris/xmpp_tasks.h"
+#include "iris/xmpp_trafficstats.h"
 #include "iris/xmpp_xmlcommon.h"
 #include "rc.h"
 #include "registrationdlg.h"
+#include "rostercache.h"
 #include "rosteritemexchangetask.h"
 #include "searchdlg.h"
 #include "statusdlg.h"
@@ -111,6 +114,7 @@
 #include "tabdlg.h"
 #include "tabmanager.h"
 #include "textutil.h"
+#include "trafficstatsdlg.h"
 #include "translationmanager.h"
 #include "tune.h"
 #include "userlist.h"
@@ -139,6 +143,7 @@
 #endif
 
 #include <QApplication>
+#include <QFile>
 #include <QFileDialog>
 #include <QFileInfo>
 #include <QFrame>
@@ -365,7 +370,7 @@ static QList<ReconnectData> reconnectData()
 class PsiAccount::Private : public Alertable {
     Q_OBJECT
 public:
-    Private(PsiAccount *parent) : Alertable(parent), account(parent), xmlRingbuf(1000)
+    Private(PsiAccount *parent) : Alertable(parent), account(parent)
     {
         reconnectTimeoutTimer_ = new QTimer(this);
         reconnectTimeoutTimer_->setSingleShot(true);
@@ -376,6 +381,11 @@ public:
         updateOnlineContactsCountTimer_->setSingleShot(true);
         connect(updateOnlineContactsCountTimer_, &QTimer::timeout, this, &Private::updateOnlineContactsCountTimeout);
 
+        rosterCacheTimer = new QTimer(this);
+        rosterCacheTimer->setInterval(10000); // pushes usually come in bunches
+        rosterCacheTimer->setSingleShot(true);
+        connect(rosterCacheTimer, &QTimer::timeout, this, &Private::saveRosterCache);
+
         logoutTimer = new QTimer(this);
         logoutTimer->setInterval(1000);
         logoutTimer->setSingleShot(true);
@@ -416,6 +426,8 @@ public:
     int                      currentConnectionErrorCondition = -1;
     QTimer                  *updateOnlineContactsCountTimer_ = nullptr;
     QTimer                  *logoutTimer                     = nullptr;
+    QTimer                  *rosterCacheTimer                = nullptr;
+    bool                     rosterCacheDeleted              = false; // the account is being removed
 
     // Tune
     Tune lastTune;
@@ -469,8 +481,7 @@ public:
     QPointer<QCATLSHandler>     tlsHandler;
     bool                        usingSSL = false;
 
-    QVector<xmlRingElem> xmlRingbuf;
-    int                  xmlRingbufWrite = 0;
+    StreamCapture xmlCapture;
 
     QHostAddress localAddress;
 
@@ -588,6 +599,24 @@ public:
             + JIDUtil::encode(acc.id).toLower() + ".xml";
     }
 
+    static QString pathToRosterCache(const QString &accountId)
+    {
+        return pathToProfile(activeProfile, ApplicationInfo::CacheLocation) + "/roster-"
+            + JIDUtil::encode(accountId).toLower() + ".dat";
+    }
+
+    void saveRosterCache()
+    {
+        rosterCacheTimer->stop();
+        if (rosterCacheDeleted)
+            return;
+        Roster r;
+        r.setVersion(client->roster().version());
+        for (const auto &item : client->roster())
+            r += item;
+        RosterCache::save(pathToRosterCache(acc.id), r);
+    }
+
 private slots:
     void updateOnlineContactsCountTimeout()
     {
@@ -706,19 +735,16 @@ public slots:
         emit account->disconnected();
     }
 
-    void client_xmlIncoming(const QString &s)
+    void updateXmlCapture()
     {
-        xmlRingbuf[xmlRingbufWrite].type = RingXmlIn;
-        xmlRingbuf[xmlRingbufWrite].xml  = s;
-        xmlRingbuf[xmlRingbufWrite].time = QDateTime::currentDateTime();
-        xmlRingbufWrite                  = (xmlRingbufWrite + 1) % xmlRingbuf.count();
-    }
-    void client_xmlOutgoing(const QString &s)
-    {
-        xmlRingbuf[xmlRingbufWrite].type = RingXmlOut;
-        xmlRingbuf[xmlRingbufWrite].xml  = s;
-        xmlRingbuf[xmlRingbufWrite].time = QDateTime::currentDateTime();
-        xmlRingbufWrite                  = (xmlRingbufWrite + 1) % xmlRingbuf.count();
+        auto o        = PsiOptions::instance();
+        int  capacity = o->getOption("options.xml-console.capture-size").toInt();
+        auto layer    = o->getOption("options.xml-console.capture-layer").toString() == QLatin1String("wire")
+               ? StreamCapture::Wire
+               : StreamCapture::Xml;
+        if (xmlCapture.capacity() != capacity)
+            xmlCapture.setCapacity(capacity);
+        xmlCapture.setLayer(layer);
     }
 
     void client_stanzaElementOutgoing(QDomElement &s)
@@ -774,15 +800,23 @@ private:
 
 public:
     // implementation for QList<PsiAccount::xmlRingElem> PsiAccount::dumpRingbuf()
+    // captured bytes are converted to text only here, when somebody wants to see them
     QList<xmlRingElem> dumpRingbuf()
     {
-        xmlRingElem        el;
         QList<xmlRingElem> ret;
-        for (int i = 0; i < xmlRingbuf.count(); i++) {
-            el = xmlRingbuf[(xmlRingbufWrite + i) % xmlRingbuf.count()];
-            if (!el.xml.isEmpty()) {
-                ret += el;
-            }
+        const auto         records = xmlCapture.records();
+        const bool         isXml   = xmlCapture.layer() == StreamCapture::Xml;
+        for (auto const &r : records) {
+            xmlRingElem el;
+            el.type = r.direction == StreamCapture::Incoming ? RingXmlIn : RingXmlOut;
+            el.time = QDateTime::fromMSecsSinceEpoch(r.timestamp);
+            if (isXml)
+                el.xml = QString::fromUtf8(r.data);
+            else
+                el.xml = QString("<!-- %1 bytes -->\n%2\n")
+                             .arg(r.data.size())
+                             .arg(QString::fromLatin1(r.data.toHex(' ')));
+            ret += el;
         }
         return ret;
     }
@@ -1049,6 +1083,7 @@ PsiAccount::PsiAccount(const UserAccount &acc, PsiContactList *parent, TabManage
     isDisconnecting = false;
     notifyOnlineOk  = false;
     doReconnect     = false;
+    rosterDone      = false;
     presenceSent    = false;
 
     d->loginStatus = Status(Status::Offline);
@@ -1133,8 +1168,6 @@ PsiAccount::PsiAccount(const UserAccount &acc, PsiContactList *parent, TabManage
     connect(d->client, &Client::groupChatError, this, &PsiAccount::client_groupChatError);
     connect(d->client, &Client::beginImportRoster, this, &PsiAccount::beginBulkContactUpdate);
     connect(d->client, &Client::endImportRoster, this, &PsiAccount::endBulkContactUpdate);
-    connect(d->client, &Client::xmlIncoming, d, &Private::client_xmlIncoming);
-    connect(d->client, &Client::xmlOutgoing, d, &Private::client_xmlOutgoing);
     connect(d->client, &Client::stanzaElementOutgoing, d, &Private::client_stanzaElementOutgoing);
 
     // Privacy manager
@@ -1209,8 +1242,15 @@ PsiAccount::PsiAccount(const UserAccount &acc, PsiContactList *parent, TabManage
 
     d->selfContact = new PsiContact(d->self, this, true);
 
-    // restore cached roster
-    for (const auto &it : std::as_const(acc.roster))
+    // restore cached roster. profiles saved by older versions have it in accounts.xml only
+    Roster cachedRoster;
+    if (!RosterCache::load(Private::pathToRosterCache(acc.id), cachedRoster)) {
+        cachedRoster = acc.roster;
+        if (!cachedRoster.isEmpty())
+            d->rosterCacheTimer->start(); // migrate it
+    }
+    d->client->setCachedRoster(cachedRoster);
+    for (const auto &it : std::as_const(cachedRoster))
         client_rosterItemUpdated(it);
 
     // restore pgp key bindings
@@ -1275,6 +1315,9 @@ PsiAccount::~PsiAccount()
 {
     logout(true, loggedOutStatus());
 
+    if (d->rosterCacheTimer->isActive())
+        d->saveRosterCache();
+
     setRCEnabled(false);
 
     emit accountDestroyed();
@@ -1571,6 +1614,13 @@ void PsiAccount::deleteQueueFile()
     }
 }
 
+void PsiAccount::deleteRosterCacheFile()
+{
+    d->rosterCacheTimer->stop();
+    d->rosterCacheDeleted = true; // and not saved again on logout
+    QFile::remove(Private::pathToRosterCache(d->acc.id));
+}
+
 const Jid &PsiAccount::jid() const { return d->jid; }
 
 QString PsiAccount::nameWithJid() const { return (name() + " (" + JIDUtil::toString(jid(), true) + ')'); }
@@ -1739,10 +1789,13 @@ void PsiAccount::login()
     }
 
     d->stream = new ClientStream(d->conn, d->tlsHandler);
+    d->updateXmlCapture();
+    d->stream->setCapture(&d->xmlCapture);
     d->stream->setRequireMutualAuth(d->acc.req_mutual_auth);
     d->stream->setSSFRange(d->acc.security_level, 256);
     d->stream->setAllowPlain(d->acc.allow_plain);
     d->stream->setCompress(d->acc.opt_compress);
+    d->stream->setCompressionLevel(PsiOptions::instance()->getOption("options.account.compression-level").toInt());
     d->stream->setLang(TranslationManager::instance()->currentXMLLanguage());
     if (d->acc.opt_keepAlive) {
         d->stream->setNoopTime(55000); // prevent NAT timeouts every minute
@@ -1760,6 +1813,8 @@ void PsiAccount::login()
 
     Jid j = d->jid.withResource((d->acc.opt_automatic_resource ? localHostName() : d->acc.resource));
     d->stream->setSMEnabled(d->acc.opt_sm);
+    d->stream->setSMUnackedLimits(PsiOptions::instance()->getOption("options.account.sm-max-unacked-stanzas").toInt(),
+                                  PsiOptions::instance()->getOption("options.account.sm-max-unacked-bytes").toInt());
     d->client->connectToServer(d->stream, j);
 }
 
@@ -2358,11 +2413,14 @@ void PsiAccount::client_rosterRequestFinished(bool success, int, const QString &
     if (success) {
         // printf("PsiAccount: [%s] roster retrieved ok.  %d entries.\n", name().latin1(), d->client->roster().count());
 
-        // delete flagged items
+        // delete flagged items. nothing to delete if the server confirmed our cached roster
+        bool                                 cached = d->client->isRosterCached();
         QMutableListIterator<UserListItem *> it(d->userList);
         while (it.hasNext()) {
             auto u = it.next();
-            if (u->flagForDelete()) {
+            if (cached) {
+                u->setFlagForDelete(false);
+            } else if (u->flagForDelete()) {
                 // QMessageBox::information(0, "blah", QString("deleting: [%1]").arg(u->jid().full()));
 
                 d->eventQueue->clear(u->jid());
@@ -2375,6 +2433,7 @@ void PsiAccount::client_rosterRequestFinished(bool success, int, const QString &
         }
 
         d->stopReconnect();
+        d->rosterCacheTimer->start();
     } else {
         // printf("PsiAccount: [%s] error retrieving roster: [%d, %s]\n", name().latin1(), code, str.latin1());
     }
@@ -2550,10 +2609,14 @@ void PsiAccount::client_rosterItemUpdated(const RosterItem &r)
     u->setInList(true);
 
     profileUpdateEntry(*u);
+    if (rosterDone)
+        d->rosterCacheTimer->start();
 }
 
 void PsiAccount::client_rosterItemRemoved(const RosterItem &r)
 {
+    if (rosterDone)
+        d->rosterCacheTimer->start();
     UserListItem *u = d->userList.find(r.jid());
     if (!u)
         return;
@@ -3647,6 +3710,17 @@ void PsiAccount::showXmlConsole()
     bringToFront(d->xmlConsole);
 }
 
+void PsiAccount::showTrafficStats()
+{
+    TrafficStatsDlg *w = findDialog<TrafficStatsDlg *>();
+    if (w)
+        bringToFront(w);
+    else {
+        w = new TrafficStatsDlg(this);
+        w->show();
+    }
+}
+
 void PsiAccount::openAddUserDlg() { openAddUserDlg(QString(), QString(), QString()); }
 
 void PsiAccount::openAddUserDlg(const Jid &jid, const QString &nick, const QString &group)
@@ -6607,14 +6681,19 @@ AvCallManager *PsiAccount::avCallManager() { return d->avCallManager; }
  */
 QList<PsiAccount::xmlRingElem> PsiAccount::dumpRingbuf() { return d->dumpRingbuf(); }
 
+const TrafficStats &PsiAccount::trafficStats() const { return d->client->trafficStats(); }
+
+void PsiAccount::resetTrafficStats() { d->client->resetTrafficStats(); }
+
+const ClientStream *PsiAccount::clientStream() const { return d->stream; }
+
 /**
  * Frees ringbuffer memory and makes it compact.
  */
 void PsiAccount::clearRingbuf()
 {
-    d->xmlRingbuf.clear();
-    d->xmlRingbufWrite = 0;
-    d->xmlRingbuf.resize(10);
+    // drops captured data together with the ring memory. it's allocated again on first use
+    d->xmlCapture.setCapacity(d->xmlCapture.capacity());
 }
 
 /**
@@ -84,6 +84,7 @@ class WbManager;
 namespace XMPP {
 class AdvancedConnector;
 class Client;
+class ClientStream;
 class EncryptedSession;
 class Jid;
 class Message;
@@ -95,6 +96,7 @@ class RosterItem;
 class ServerInfoManager;
 class Stream;
 // class StreamError;
+class TrafficStats;
 class XData;
 };
 using namespace XMPP;
@@ -206,6 +208,7 @@ public:
     void doWakeup();
 
     void        showXmlConsole();
+    void        showTrafficStats();
     void        openAddUserDlg();
     void        openAddUserDlg(const XMPP::Jid &jid, const QString &nick, const QString &group);
     bool        groupChatJoin(const QString &host, const QString &room, const QString &nick, const QString &pass,
@@ -278,6 +281,7 @@ public:
                              bool *_needAlert);
 
     void deleteQueueFile();
+    void deleteRosterCacheFile();
 
     PEPManager        *pepManager();
     ServerInfoManager *serverInfoManager();
@@ -288,6 +292,10 @@ public:
     QString currentConnectionError() const;
     int     currentConnectionErrorCondition() const;
 
+    const TrafficStats &trafficStats() const; // see XMPP::Client::trafficStats()
+    void                resetTrafficStats();
+    const ClientStream *clientStream() const; // null when not connected
+
     enum xmlRingType { RingXmlIn, RingXmlOut, RingSysMsg };
     class xmlRingElem {
     public:
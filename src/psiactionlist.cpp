@@ -432,6 +432,8 @@ void PsiActionList::Private::createMainWin()
 
         IconAction *actDiagQCAKeyStore = new IconAction(tr("Key Storage"), tr("&Key Storage"), 0, this);
 
+        IconAction *actDiagDnsCache = new IconAction(tr("DNS Cache"), tr("&DNS Cache"), 0, this);
+
         ActionNames actions[] = { { "help_readme", actReadme },
                                   { "help_online_wiki", actOnlineWiki },
                                   { "help_online_home", actOnlineHome },
@@ -443,6 +445,7 @@ void PsiActionList::Private::createMainWin()
                                   { "help_about_psimedia", actAboutPsiMedia },
                                   { "help_diag_qcaplugin", actDiagQCAPlugin },
                                   { "help_diag_qcakeystore", actDiagQCAKeyStore },
+                                  { "help_diag_dnscache", actDiagDnsCache },
                                   { "", nullptr } };
 
         createActionList(tr("Help"), Actions_MainWin, actions);
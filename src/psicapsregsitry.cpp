@@ -3,12 +3,29 @@
 #include "applicationinfo.h"
 #include "iodeviceopener.h"
 
+#include <QSaveFile>
+
+static QString capsFile(const QString &name) { return ApplicationInfo::homeDir(ApplicationInfo::CacheLocation) + name; }
+
 PsiCapsRegistry::PsiCapsRegistry(QObject *parent) : CapsRegistry(parent) { }
 
 void PsiCapsRegistry::saveData(const QByteArray &data)
 {
-    QFile          file(ApplicationInfo::homeDir(ApplicationInfo::CacheLocation) + "/caps.xml");
-    IODeviceOpener opener(&file, QIODevice::WriteOnly);
+    QSaveFile file(capsFile("/caps.dat"));
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning("Caps: Unable to open IO device");
+        return;
+    }
+    file.write(data);
+    if (file.commit()) {
+        QFile::remove(capsFile("/caps.xml")); // converted from older versions
+    }
+}
+
+void PsiCapsRegistry::appendData(const QByteArray &data)
+{
+    QFile          file(capsFile("/caps.dat"));
+    IODeviceOpener opener(&file, QIODevice::Append); // implies WriteOnly
     if (!opener.isOpen()) {
         qWarning("Caps: Unable to open IO device");
         return;
@@ -18,7 +35,10 @@ void PsiCapsRegistry::saveData(const QByteArray &data)
 
 QByteArray PsiCapsRegistry::loadData()
 {
-    QFile file(ApplicationInfo::homeDir(ApplicationInfo::CacheLocation) + "/caps.xml");
+    QFile file(capsFile("/caps.dat"));
+    if (!file.exists()) {
+        file.setFileName(capsFile("/caps.xml"));
+    }
     if (file.exists()) {
         IODeviceOpener opener(&file, QIODevice::ReadOnly);
         if (opener.isOpen()) {
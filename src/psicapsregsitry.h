@@ -10,6 +10,7 @@ public:
     PsiCapsRegistry(QObject *parent = nullptr);
 
     void       saveData(const QByteArray &data);
+    void       appendData(const QByteArray &data);
     QByteArray loadData();
 };
 
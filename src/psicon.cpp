@@ -89,6 +89,7 @@
 #ifdef HAVE_WEBSERVER
 #include "webserver.h"
 #endif
+#include "iris/netnames.h"
 #include "iris/xmpp_caps.h"
 #include "iris/xmpp_xmlcommon.h"
 #ifdef WHITEBOARDING
@@ -129,6 +130,7 @@
 #include <QPixmap>
 #include <QPixmapCache>
 #include <QPointer>
+#include <QSaveFile>
 #include <QSessionManager>
 
 static const char *tunePublishOptionPath          = "options.extended-presence.tune.publish";
@@ -343,6 +345,8 @@ public:
     IdleSettings idleSettings_;
 };
 
+static QString dnsCacheFile() { return ApplicationInfo::homeDir(ApplicationInfo::CacheLocation) + "/dns-cache.json"; }
+
 //----------------------------------------------------------------------------
 // PsiCon
 //----------------------------------------------------------------------------
@@ -359,10 +363,12 @@ PsiCon::PsiCon() : QObject(nullptr)
     d->defaultMenuBar = new QMenuBar(nullptr);
 
     XMPP::CapsRegistry::setInstance(new PsiCapsRegistry(this));
-    XMPP::CapsRegistry *pcr = XMPP::CapsRegistry::instance();
-    connect(pcr, SIGNAL(destroyed(QObject *)), pcr, SLOT(save()));
-    connect(pcr, SIGNAL(registered(const XMPP::CapsSpec &)), pcr, SLOT(save()));
-    pcr->load();
+    XMPP::CapsRegistry::instance()->load(); // new nodes are appended to the journal as they are registered
+
+    // reconnects after a restart skip the dns lookups which are still valid
+    QFile dnsCache(dnsCacheFile());
+    if (dnsCache.open(QIODevice::ReadOnly))
+        XMPP::NetNames::loadCache(dnsCache.readAll());
 }
 
 PsiCon::~PsiCon()
@@ -803,6 +809,12 @@ void PsiCon::deinit()
     // TuneController
     delete d->tuneManager;
 
+    QSaveFile dnsCache(dnsCacheFile());
+    if (dnsCache.open(QIODevice::WriteOnly)) {
+        dnsCache.write(XMPP::NetNames::saveCache());
+        dnsCache.commit();
+    }
+
     // save profile
     d->saveProfile(acc);
 #ifdef PSI_PLUGINS
@@ -1905,6 +1917,7 @@ void PsiCon::networkSessionOpened()
 {
     if (d->wakeupPending) {
         d->wakeupPending = false;
+        XMPP::NetNames::clearCache(); // the network may be another one now
         for (PsiAccount *account : d->contactList->enabledAccounts()) {
             account->doWakeup();
         }
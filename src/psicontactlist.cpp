@@ -206,6 +206,7 @@ void PsiContactList::removeAccount(PsiAccount *account)
 {
     emit accountRemoved(account);
     account->deleteQueueFile();
+    account->deleteRosterCacheFile();
     delete account;
     emit saveAccounts();
 }
@@ -0,0 +1,85 @@
+/*
+ * rostercache.cpp - compact on-disk copy of an account roster
+ * Copyright (C) 2026  Psi Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "rostercache.h"
+
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+
+using namespace XMPP;
+
+static const quint32 RosterCacheMagic   = 0x50535243; // "PSRC"
+static const quint8  RosterCacheVersion = 1;
+
+bool RosterCache::load(const QString &fileName, Roster &roster)
+{
+    QFile f(fileName);
+    if (!f.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream in(&f);
+    in.setVersion(QDataStream::Qt_5_10);
+    quint32 magic;
+    quint8  version;
+    quint32 count;
+    QString rosterVersion;
+    in >> magic >> version;
+    if (magic != RosterCacheMagic || version != RosterCacheVersion)
+        return false;
+    in >> rosterVersion >> count;
+
+    Roster r;
+    r.reserve(int(count));
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        QString      jid, name, subscription, ask;
+        QStringList  groups;
+        Subscription s;
+        in >> jid >> name >> subscription >> ask >> groups;
+        s.fromString(subscription);
+
+        RosterItem item;
+        item.setJid(Jid(jid));
+        item.setName(name);
+        item.setSubscription(s);
+        item.setAsk(ask);
+        item.setGroups(groups);
+        r += item;
+    }
+    if (in.status() != QDataStream::Ok)
+        return false;
+
+    r.setVersion(rosterVersion);
+    roster = r;
+    return true;
+}
+
+bool RosterCache::save(const QString &fileName, const Roster &roster)
+{
+    QSaveFile f(fileName);
+    if (!f.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream out(&f);
+    out.setVersion(QDataStream::Qt_5_10);
+    out << RosterCacheMagic << RosterCacheVersion << roster.version() << quint32(roster.count());
+    for (const RosterItem &item : roster)
+        out << item.jid().full() << item.name() << item.subscription().toString() << item.ask() << item.groups();
+    return out.status() == QDataStream::Ok && f.commit();
+}
@@ -0,0 +1,39 @@
+/*
+ * rostercache.h - compact on-disk copy of an account roster
+ * Copyright (C) 2026  Psi Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ROSTERCACHE_H
+#define ROSTERCACHE_H
+
+#include "iris/xmpp_roster.h"
+
+#include <QString>
+
+/*
+ * The roster is saved together with its XEP-0237 version, so on the next login it's shown before
+ * the connection is established and only the changes are requested from the server.
+ * Unlike the former roster-cache in accounts.xml it's a flat binary file, which stays cheap to
+ * read and write with tens of thousands of contacts.
+ */
+class RosterCache {
+public:
+    static bool load(const QString &fileName, XMPP::Roster &roster);
+    static bool save(const QString &fileName, const XMPP::Roster &roster);
+};
+
+#endif // ROSTERCACHE_H
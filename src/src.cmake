@@ -188,6 +188,7 @@ list(APPEND HEADERS
     multifiletransferitem.h
     multifiletransfermodel.h
     networkaccessmanager.h
+    partialdownload.h
     passdialog.h
     pepmanager.h
     pgpkeydlg.h
@@ -232,6 +233,7 @@ list(APPEND HEADERS
     registrationdlg.h
     resourcemenu.h
     rosteravatarframe.h
+    rostercache.h
     rosteritemexchangetask.h
     rtparse.h
     searchdlg.h
@@ -250,6 +252,7 @@ list(APPEND HEADERS
     textutil.h
     theme.h
     theme_p.h
+    trafficstatsdlg.h
     translationmanager.h
     urlbookmark.h
     userlist.h
@@ -433,6 +436,7 @@ list(APPEND SOURCES
     multifiletransferitem.cpp
     multifiletransfermodel.cpp
     networkaccessmanager.cpp
+    partialdownload.cpp
     passdialog.cpp
     pepmanager.cpp
     pgpkeydlg.cpp
@@ -472,6 +476,7 @@ list(APPEND SOURCES
     registrationdlg.cpp
     resourcemenu.cpp
     rosteravatarframe.cpp
+    rostercache.cpp
     rosteritemexchangetask.cpp
     rtparse.cpp
     searchdlg.cpp
@@ -489,6 +494,7 @@ list(APPEND SOURCES
     textutil.cpp
     theme.cpp
     theme_p.cpp
+    trafficstatsdlg.cpp
     translationmanager.cpp
     urlbookmark.cpp
     userlist.cpp
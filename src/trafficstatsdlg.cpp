@@ -0,0 +1,239 @@
+/*
+ * trafficstatsdlg.cpp - per namespace stanza traffic and iq latency of an account
+ * Copyright (C) 2026  Psi Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "trafficstatsdlg.h"
+
+#include "fileutil.h"
+#include "iconset.h"
+#include "iris/xmpp_clientstream.h"
+#include "iris/xmpp_trafficstats.h"
+#include "psiaccount.h"
+#include "psicon.h"
+#include "psicontactlist.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QHBoxLayout>
+#include <QJsonDocument>
+#include <QLabel>
+#include <QLocale>
+#include <QMessageBox>
+#include <QPushButton>
+#include <QSplitter>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+
+#define REFRESH_INTERVAL 2000 // msecs
+
+static double msecs(qint64 usecs) { return double(usecs) / 1000.0; }
+
+TrafficStatsDlg::TrafficStatsDlg(PsiAccount *_pa) : QWidget()
+{
+    setAttribute(Qt::WA_DeleteOnClose);
+    setWindowIcon(IconsetFactory::icon("psi/xml").icon());
+    pa = _pa;
+    pa->dialogRegister(this);
+    connect(pa, SIGNAL(updatedAccount()), SLOT(updateCaption()));
+    connect(pa->psi(), SIGNAL(accountCountChanged()), this, SLOT(updateCaption()));
+    updateCaption();
+
+    QVBoxLayout *vb = new QVBoxLayout(this);
+
+    lb_summary = new QLabel(this);
+    lb_summary->setTextInteractionFlags(Qt::TextSelectableByMouse);
+    vb->addWidget(lb_summary);
+
+    lb_compression = new QLabel(this);
+    lb_compression->setTextInteractionFlags(Qt::TextSelectableByMouse);
+    vb->addWidget(lb_compression);
+
+    QSplitter *splitter = new QSplitter(Qt::Vertical, this);
+    vb->addWidget(splitter, 1);
+
+    tw_traffic = new QTreeWidget(splitter);
+    tw_traffic->setRootIsDecorated(false);
+    tw_traffic->setHeaderLabels({ tr("Direction"), tr("Stanza"), tr("Namespace"), tr("Count"), tr("Bytes"),
+                                  tr("Parse, ms"), tr("Dispatch, ms"), tr("Max dispatch, ms") });
+    tw_traffic->setSortingEnabled(true);
+    tw_traffic->sortByColumn(4, Qt::DescendingOrder);
+
+    tw_iq = new QTreeWidget(splitter);
+    tw_iq->setRootIsDecorated(false);
+    tw_iq->setHeaderLabels({ tr("IQ namespace"), tr("Replies"), tr("Errors"), tr("Timeouts"), tr("Median, ms"),
+                             tr("95%, ms"), tr("Max, ms") });
+    tw_iq->setSortingEnabled(true);
+    tw_iq->sortByColumn(5, Qt::DescendingOrder);
+
+    QHBoxLayout *hb = new QHBoxLayout;
+    vb->addLayout(hb);
+    QPushButton *pb;
+
+    pb = new QPushButton(tr("&Refresh"), this);
+    connect(pb, SIGNAL(clicked()), SLOT(refresh()));
+    hb->addWidget(pb);
+
+    pb = new QPushButton(tr("Re&set"), this);
+    connect(pb, SIGNAL(clicked()), SLOT(reset()));
+    hb->addWidget(pb);
+
+    pb = new QPushButton(tr("&Export..."), this);
+    pb->setToolTip(tr("Save the statistics as JSON"));
+    connect(pb, SIGNAL(clicked()), SLOT(exportJson()));
+    hb->addWidget(pb);
+    hb->addStretch(1);
+
+    pb = new QPushButton(tr("&Close"), this);
+    connect(pb, SIGNAL(clicked()), SLOT(close()));
+    hb->addWidget(pb);
+
+    // the counters are collected all the time. only the view is updated while visible
+    refreshTimer.setInterval(REFRESH_INTERVAL);
+    connect(&refreshTimer, SIGNAL(timeout()), SLOT(refresh()));
+
+    resize(800, 600);
+}
+
+TrafficStatsDlg::~TrafficStatsDlg() { pa->dialogUnregister(this); }
+
+void TrafficStatsDlg::updateCaption()
+{
+    if (pa->psi()->contactList()->enabledAccounts().count() > 1)
+        setWindowTitle(pa->name() + ": " + tr("Traffic Statistics"));
+    else
+        setWindowTitle(tr("Traffic Statistics"));
+}
+
+void TrafficStatsDlg::showEvent(QShowEvent *e)
+{
+    refresh();
+    refreshTimer.start();
+    QWidget::showEvent(e);
+}
+
+void TrafficStatsDlg::hideEvent(QHideEvent *e)
+{
+    refreshTimer.stop();
+    QWidget::hideEvent(e);
+}
+
+void TrafficStatsDlg::refresh()
+{
+    const XMPP::TrafficStats &stats = pa->trafficStats();
+
+    if (stats.since()) {
+        const auto &parse    = stats.parseTimes();
+        const auto &dispatch = stats.dispatchTimes();
+        lb_summary->setText(
+            tr("Since %1. Per incoming stanza: parse median %2 ms, 99% %3 ms; dispatch median %4 ms, 99% %5 ms.")
+                .arg(QLocale().toString(QDateTime::fromMSecsSinceEpoch(stats.since()), QLocale::ShortFormat))
+                .arg(msecs(parse.percentile(0.5)))
+                .arg(msecs(parse.percentile(0.99)))
+                .arg(msecs(dispatch.percentile(0.5)))
+                .arg(msecs(dispatch.percentile(0.99))));
+    } else {
+        lb_summary->setText(tr("No stanzas yet."));
+    }
+
+    // counted by the compression layer for the current connection. not affected by reset
+    auto stream = pa->clientStream();
+    if (stream && stream->isCompressed()) {
+        const auto c = stream->compressionStats();
+        lb_compression->setText(
+            tr("Stream compression: out %1 to %2 bytes (%3:1), %4 ms deflating; in %5 to %6 bytes (%7:1), "
+               "%8 ms inflating.")
+                .arg(c.plainOut)
+                .arg(c.compressedOut)
+                .arg(c.outRatio(), 0, 'f', 2)
+                .arg(msecs(c.deflateNsecs / 1000))
+                .arg(c.compressedIn)
+                .arg(c.plainIn)
+                .arg(c.inRatio(), 0, 'f', 2)
+                .arg(msecs(c.inflateNsecs / 1000)));
+    } else {
+        lb_compression->setText(tr("Stream compression is not active."));
+    }
+
+    tw_traffic->setSortingEnabled(false);
+    tw_traffic->clear();
+    using Counters  = QHash<XMPP::TrafficStats::Key, XMPP::TrafficStats::Counters>;
+    auto addTraffic = [this](const QString &direction, const Counters &hash, bool incoming) {
+        for (auto it = hash.cbegin(); it != hash.cend(); ++it) {
+            auto item = new QTreeWidgetItem(tw_traffic);
+            item->setText(0, direction);
+            item->setText(1, it.key().first);
+            item->setText(2, it.key().second);
+            item->setData(3, Qt::DisplayRole, qulonglong(it->stanzas));
+            item->setData(4, Qt::DisplayRole, qulonglong(it->bytes));
+            if (incoming) {
+                item->setData(5, Qt::DisplayRole, msecs(it->parse));
+                item->setData(6, Qt::DisplayRole, msecs(it->dispatch));
+                item->setData(7, Qt::DisplayRole, msecs(it->maxDispatch));
+            }
+        }
+    };
+    addTraffic(tr("in"), stats.incoming(), true);
+    addTraffic(tr("out"), stats.outgoing(), false);
+    tw_traffic->setSortingEnabled(true);
+
+    tw_iq->setSortingEnabled(false);
+    tw_iq->clear();
+    for (auto it = stats.iq().cbegin(); it != stats.iq().cend(); ++it) {
+        auto item = new QTreeWidgetItem(tw_iq);
+        item->setText(0, it.key());
+        item->setData(1, Qt::DisplayRole, qulonglong(it->latency.count));
+        item->setData(2, Qt::DisplayRole, qulonglong(it->errors));
+        item->setData(3, Qt::DisplayRole, qulonglong(it->timeouts));
+        item->setData(4, Qt::DisplayRole, msecs(it->latency.percentile(0.5)));
+        item->setData(5, Qt::DisplayRole, msecs(it->latency.percentile(0.95)));
+        item->setData(6, Qt::DisplayRole, msecs(it->latency.max));
+    }
+    tw_iq->setSortingEnabled(true);
+}
+
+void TrafficStatsDlg::reset()
+{
+    pa->resetTrafficStats();
+    refresh();
+}
+
+void TrafficStatsDlg::exportJson()
+{
+    QString fileName = FileUtil::getSaveFileName(this, tr("Export Traffic Statistics"), "traffic-stats.json",
+                                                 tr("JSON files (*.json)"));
+    if (fileName.isEmpty())
+        return;
+
+    QJsonObject json = pa->trafficStats().toJson();
+    json.insert(QStringLiteral("account"), pa->jid().bare());
+    auto stream = pa->clientStream();
+    if (stream && stream->isCompressed()) {
+        const auto c = stream->compressionStats();
+        json.insert(QStringLiteral("compression"),
+                    QJsonObject { { QStringLiteral("plainOut"), c.plainOut },
+                                  { QStringLiteral("compressedOut"), c.compressedOut },
+                                  { QStringLiteral("compressedIn"), c.compressedIn },
+                                  { QStringLiteral("plainIn"), c.plainIn },
+                                  { QStringLiteral("deflateUs"), c.deflateNsecs / 1000 },
+                                  { QStringLiteral("inflateUs"), c.inflateNsecs / 1000 } });
+    }
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(QJsonDocument(json).toJson()) < 0)
+        QMessageBox::warning(this, tr("Error!"), tr("Failed to write %1: %2").arg(fileName, file.errorString()));
+}
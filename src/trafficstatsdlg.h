@@ -0,0 +1,55 @@
+/*
+ * trafficstatsdlg.h - per namespace stanza traffic and iq latency of an account
+ * Copyright (C) 2026  Psi Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TRAFFICSTATSDLG_H
+#define TRAFFICSTATSDLG_H
+
+#include <QTimer>
+#include <QWidget>
+
+class PsiAccount;
+class QLabel;
+class QTreeWidget;
+
+class TrafficStatsDlg : public QWidget {
+    Q_OBJECT
+public:
+    TrafficStatsDlg(PsiAccount *);
+    ~TrafficStatsDlg();
+
+private slots:
+    void updateCaption();
+    void refresh();
+    void reset();
+    void exportJson();
+
+protected:
+    void showEvent(QShowEvent *) override;
+    void hideEvent(QHideEvent *) override;
+
+private:
+    PsiAccount  *pa;
+    QLabel      *lb_summary;
+    QLabel      *lb_compression;
+    QTreeWidget *tw_traffic;
+    QTreeWidget *tw_iq;
+    QTimer       refreshTimer;
+};
+
+#endif // TRAFFICSTATSDLG_H
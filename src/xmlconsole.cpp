@@ -33,6 +33,7 @@
 #include <QMessageBox>
 #include <QPushButton>
 #include <QScrollBar>
+#include <QSignalBlocker>
 #include <QTextEdit>
 #include <QTextFrame>
 #include <QVBoxLayout>
@@ -47,8 +48,8 @@ XmlConsole::XmlConsole(PsiAccount *_pa) : QWidget()
     pa = _pa;
     pa->dialogRegister(this);
     connect(pa, SIGNAL(updatedAccount()), SLOT(updateCaption()));
-    connect(pa->client(), SIGNAL(xmlIncoming(const QString &)), SLOT(client_xmlIncoming(const QString &)));
-    connect(pa->client(), SIGNAL(xmlOutgoing(const QString &)), SLOT(client_xmlOutgoing(const QString &)));
+    // the client serializes stanzas for us only while we are listening. see setLiveXml()
+    connect(ui_.ck_enable, &QCheckBox::toggled, this, &XmlConsole::setLiveXml);
     connect(pa->psi(), SIGNAL(accountCountChanged()), this, SLOT(updateCaption()));
     updateCaption();
 
@@ -64,6 +65,7 @@ XmlConsole::XmlConsole(PsiAccount *_pa) : QWidget()
     connect(ui_.pb_input, SIGNAL(clicked()), SLOT(insertXml()));
     connect(ui_.pb_close, SIGNAL(clicked()), SLOT(close()));
     connect(ui_.pb_dumpRingbuf, SIGNAL(clicked()), SLOT(dumpRingbuf()));
+    connect(ui_.pb_stats, &QPushButton::clicked, pa, &PsiAccount::showTrafficStats);
 
     resize(560, 400);
 }
@@ -82,6 +84,19 @@ void XmlConsole::updateCaption()
 
 void XmlConsole::enable() { ui_.ck_enable->setChecked(true); }
 
+void XmlConsole::setLiveXml(bool enabled)
+{
+    if (enabled) {
+        connect(pa->client(), &XMPP::Client::xmlIncoming, this, &XmlConsole::client_xmlIncoming,
+                Qt::UniqueConnection);
+        connect(pa->client(), &XMPP::Client::xmlOutgoing, this, &XmlConsole::client_xmlOutgoing,
+                Qt::UniqueConnection);
+    } else {
+        disconnect(pa->client(), &XMPP::Client::xmlIncoming, this, &XmlConsole::client_xmlIncoming);
+        disconnect(pa->client(), &XMPP::Client::xmlOutgoing, this, &XmlConsole::client_xmlOutgoing);
+    }
+}
+
 bool XmlConsole::filtered(const QString &str) const
 {
     if (ui_.ck_enable->isChecked()) {
@@ -115,6 +130,7 @@ void XmlConsole::dumpRingbuf()
 {
     QList<PsiAccount::xmlRingElem> buf        = pa->dumpRingbuf();
     bool                           enablesave = ui_.ck_enable->isChecked();
+    QSignalBlocker                 blocker(ui_.ck_enable);
     ui_.ck_enable->setChecked(true);
     QString stamp;
     for (const PsiAccount::xmlRingElem &el : std::as_const(buf)) {